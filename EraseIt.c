@@ -2,30 +2,41 @@
  #include <stdio.h>
  #include <ctype.h>
 
- #include "pico/stdlib.h"
- #include "pico/bootrom.h"
- #include "hardware/timer.h"
- #include "hardware/pwm.h"
- #include "hardware/clocks.h"
-
+ #include "lib/hal.h"
  #include "lib/rgb.h"
  #include "lib/joystick.h"
  #include "lib/oledgfx.h"
  #include "lib/push_button.h"
  #include "lib/ws2812b.h"
  #include "lib/mlt8530.h"
+ #include "lib/pcm_audio.h"
+ #include "lib/pcm_sfx.h"
+ #include "lib/power.h"
+ #include "lib/clockmgr.h"
+ #include "lib/dualcore.h"
+ #include "lib/workqueue.h"
+ #include "lib/profiler.h"
+ #include "lib/input_replay.h"
+ #include "lib/kvstore.h"
+ #include "lib/telemetry.h"
+ #include "lib/tlog.h"
+ #include "lib/serial_tx.h"
+ #include "lib/fmt.h"
+ #include "lib/tilecanvas.h"
+ #include "lib/oled_assets.h"
  
  // Hardware Configuration
  // ====================
  
  /// @brief I2C port used for OLED communication
- #define I2C_PORT i2c1
+ #define I2C_PORT HAL_I2C1
  
  /// @brief OLED display pin configuration
  #define OLED_SDA 14      ///< Serial data pin
  #define OLED_SCL 15      ///< Serial clock pin
  #define OLED_ADDR 0x3C   ///< I2C address of OLED
  #define OLED_BAUDRATE 400000  ///< I2C communication speed
+ #define OLED_ORIENTATION SSD1306_ROTATE_0  ///< Panel mounting; the layout is 128x64, so only the landscape ones (0, 180, mirrors) fit
  
  /// @brief Joystick pin configuration
  #define JOYSTICK_VRX 27  ///< X-axis analog input
@@ -34,7 +45,7 @@
  
  /// @brief Buzzer pin configuration
  #define BUZZER_A 10      ///< Primary buzzer pin
- #define BUZZER_B 21      ///< Secondary buzzer pin
+ #define BUZZER_B 21      ///< Secondary buzzer pin (PCM sound effects)
  
  /// @brief RGB LED pin configuration
  #define RED_PIN   13     ///< Red LED PWM pin
@@ -44,18 +55,105 @@
  // Game Constants
  // =============
  
- /// @brief Button press detection macros
- #define JOYSTICK_SW_PRESSED (gpio == 22)
- #define BUTTON_A_PRESSED (gpio == BUTTON_A)
- #define BUTTON_B_PRESSED (gpio == BUTTON_B)
- 
  /// @brief Game state definitions
  #define GAME_STATUS_WAITING 0  ///< Initial waiting state
  #define GAME_STATUS_START   1  ///< Game active state
  #define GAME_STATUS_END     3  ///< Game over state
  
+ /// @brief System clock during a round in kHz (LED matrix, I2C and audio dividers are re-derived on every switch)
+ #define GAME_CLOCK_KHZ 128000
+ 
+ /// @brief System clock in the menu in kHz; only input, the menu frame and the flash commit run here
+ #define MENU_CLOCK_KHZ 48000
+ 
+ /// @brief Gameplay frame period (input polling rate) in microseconds
+ #define FRAME_PERIOD_US 16667
+ 
+ /// @brief When 1, rounds are played on a level larger than the display that scrolls under the cursor
+ #define WORLD_ENABLED 1
+ 
+ /// @brief Level size in pixels (multiples of 8); the lit pixels of a new level must fit the 16-bit score
+ #define WORLD_WIDTH 384
+ #define WORLD_HEIGHT 128
+ 
+ /// @brief Distance from a display edge at which the cursor pushes the view, in pixels
+ #define WORLD_SCROLL_MARGIN 8
+ 
+ /// @brief View movement per frame while the cursor is inside the scroll margin, in pixels
+ #define WORLD_SCROLL_STEP 2
+ 
+ /// @brief How long the boot splash and the game over art stay on the display, in milliseconds
+ #define SPLASH_HOLD_MS 1500
+ #define GAME_OVER_HOLD_MS 1500
+ 
+ /// @brief Shortest plane duration of the 2-bit gray splash, in microseconds, counted from the end of the
+ /// plane's I2C send (plane 1 stays twice as long; each ~330-byte delta takes about 7.4 ms at 400 kHz)
+ #define SPLASH_GRAY_SLOT_US 4000
+ 
+ /// @brief RGB LED transition time per cursor update in milliseconds (a bit longer than a frame, so steps blend)
+ #define LED_FADE_MS 50
+ 
+ /// @brief Perceptual (gamma-corrected) level of the green "ready" LED in the menu
+ #define LED_READY_GREEN 72
+ 
+ /// @brief When 1, the menu puts the chip in dormant mode (wakes on buttons A/B, USB serial is lost)
+ #define MENU_DORMANT_ENABLED 0
+ 
+ /// @brief When 1, streams raw joystick readings as "t_us,x" CSV lines for tools/joystick_filter_bench.c
+ #define TRACE_JOYSTICK_ADC 0
+ 
+ /// @brief When 1, prints the busy percentage of each core once per second during a game
+ /// (off in the host build: simulated I2C and frame work take no time, so both cores would read 0%)
+#ifdef HAL_LINUX
+ #define REPORT_CORE_UTILIZATION 0
+#else
+ #define REPORT_CORE_UTILIZATION 1
+#endif
+ 
+ /// @brief Retry period for queued serial output while the menu sleeps (only armed while bytes are queued)
+ #define MENU_TX_RETRY_US 10000
+ 
+ /// @brief Serial command that dumps the profiler record (decode it with tools/profiler_decode.c)
+ #define PROFILER_DUMP_COMMAND 'p'
+ 
+ /// @brief Serial command (in the menu) that replays the last recorded round
+ #define REPLAY_START_COMMAND 'r'
+ 
+ /// @brief Serial command that dumps the last recorded round as a binary "ERP1" record
+ #define REPLAY_DUMP_COMMAND 'd'
+ 
+ /// @brief Longest wait for queued log/telemetry frames to leave before a raw dump (the host asked for it, so it is reading)
+ #define SERIAL_DUMP_FLUSH_MS 200
+ 
+ /// @brief Interval between binary telemetry records during a round (decode with tools/telemetry_decode.c)
+ #define TELEMETRY_PERIOD_US 100000
+ 
+ /// @brief Size of the round recording buffer (a 9 s round typically needs well under 2 KB)
+ #define REPLAY_BUFFER_BYTES 4096
+ 
+ /// @brief Number of best rounds (fewest pixels left) kept in flash
+ #define HIGH_SCORE_COUNT 5
+ 
+ /// @brief Keys of the persistent store (lib/kvstore.h, last flash sectors)
+ enum {
+     KV_KEY_CALIBRATION = 1,  ///< joystick_calibration_t from the boot calibration
+     KV_KEY_HIGH_SCORES = 2,  ///< Up to HIGH_SCORE_COUNT uint16_t scores, best first
+     KV_KEY_SETTINGS = 3,     ///< Reserved for user settings
+ };
+ 
+ /// @brief Profiled stages of the gameplay frame
+ enum {
+     PROF_ZONE_FRAME,     ///< Whole frame, excluding the sleep until the next deadline
+     PROF_ZONE_INPUT,     ///< Button events and deferred work
+     PROF_ZONE_JOYSTICK,  ///< Joystick sampling and mapping (frames where it moved)
+     PROF_ZONE_CURSOR,    ///< Cursor erase/update in the frame buffer
+     PROF_ZONE_BORDER,    ///< Border restore
+     PROF_ZONE_SUBMIT,    ///< Frame hand-off to core 1
+     PROF_ZONE_LEDS,      ///< Sound trigger and RGB LED fade update
+ };
+ 
  /// @brief Enable USB boot mode for firmware updates
- #define set_bootsel_mode() reset_usb_boot(0, 0)
+ #define set_bootsel_mode() hal_reboot_to_bootloader()
  
  // Global Variables
  // ================
@@ -79,6 +177,37 @@
  static ssd1306_t *ssd_global = NULL;  ///< OLED display object
  static ws2812b_t *ws_global = NULL;   ///< WS2812B LED matrix object
  
+ /// @brief Input recording of the last round and its replay state
+ static uint8_t replay_buffer[REPLAY_BUFFER_BYTES];
+ static size_t replay_length = 0;       ///< Size of the finished recording (0 if none)
+ static replay_recorder_t replay_rec;
+ static replay_player_t replay_player;
+ static volatile bool replay_active = false;  ///< The current round is fed by the recording instead of the joystick
+ static uint32_t game_frame = 0;        ///< Frame index within the current round (the recording timestamp)
+ 
+ /// @brief Joystick calibration profile (persistable) and cursor lookup tables
+ static joystick_calibration_t joy_calibration;
+ static joystick_map_t joy_map;
+ 
+ /// @brief Persistent store; changes are committed only from the menu, never during a round
+ static kv_store_t kv;
+ static uint16_t high_scores[HIGH_SCORE_COUNT];  ///< Fewest pixels left first
+ static uint8_t high_score_count = 0;
+ 
+#if WORLD_ENABLED
+ /// @brief Level of the current round (8x8 tiles, deduplicated) and the display window over it
+ static tilecanvas_t world;
+ static uint16_t world_view_x, world_view_y;
+#endif
+ 
+ /// @brief Game start jingle: arpeggio on buzzer A
+ static const buzzer_note_t START_MELODY_A[] = {
+     {BUZZER_MIDI(84), 80, 60}, {BUZZER_MIDI(88), 80, 60}, {BUZZER_MIDI(91), 140, 80}  // C6 E6 G6
+ };
+ 
+ /// @brief Minimum interval between erase crunch sounds in microseconds (length of the sample)
+ #define CRUNCH_INTERVAL_US 70000u
+ 
  // Predefined colors for WS2812B display
  static const uint8_t COLORS[] = {
      PURPLE, GREEN, BLUE_MARINE, RED, 
@@ -89,33 +218,110 @@
  // ==================
  
  /**
-  * @brief Normalizes joystick input to display coordinates
-  * @param joystick_vr Raw joystick value (0-4095)
-  * @param new_max Maximum value in target range
-  * @return Normalized value in display coordinate space
+  * @brief Loads the joystick calibration and builds the cursor mapping tables
+  * @param joy Initialized joystick
+  * @note Holding the joystick button during boot runs the calibration routine
+  */
+ static void setup_joystick_mapping(const joystick_t *joy);
+ 
+ /**
+  * @brief Inserts a finished live round into the high score table
+  * @param score Pixels left on the display (lower is better)
+  * @return Rank (1-HIGH_SCORE_COUNT), or 0 if the score did not make the table
+  * @note Only the RAM copy changes; the flash write happens in the menu
   */
- static uint16_t normalize_joystick_to_display(uint16_t joystick_vr, uint8_t new_max);
+ static uint8_t record_high_score(uint16_t score);
+ 
+ /**
+  * @brief Switches the system clock for a game state and logs the switch
+  * @param khz New clock in kHz
+  * @note Drivers re-derive their dividers through clock manager callbacks
+  */
+ static void set_state_clock(uint32_t khz);
+ 
+#if WORLD_ENABLED
+ /**
+  * @brief Builds the level from font glyphs, solid blocks and gaps, and centers the view on it
+  * @note The seed is fixed, so every round (and its replay) starts on the same level
+  */
+ static void world_generate(void);
+ 
+ /**
+  * @brief Moves the view while the cursor is inside the scroll margin of a display edge
+  * @param x Cursor X on the display
+  * @param y Cursor Y on the display
+  * @return true if the view moved
+  */
+ static bool world_scroll(int16_t x, int16_t y);
+#endif
+ 
+ /**
+  * @brief Counts the pixels still to be erased (lit pixels of the level, or of the display)
+  * @return Pixel count, saturated to 16 bits
+  */
+ static uint16_t count_remaining_pixels(void);
  
  /**
   * @brief Adjusts PWM LED value based on joystick position
-  * @param pwm_value Raw joystick value (0-4095)
-  * @return Adjusted PWM value (0-2048) for LED brightness
+  * @param pwm_value Oversampled joystick value (0-JOYSTICK_ADC_MAX)
+  * @return Perceptual LED level (0-255), gamma-corrected by the RGB fade engine
   */
- static uint16_t adjust_pwm_led_value(uint16_t pwm_value);
+ static uint8_t adjust_pwm_led_value(uint16_t pwm_value);
  
  /**
-  * @brief GPIO interrupt callback for button presses
-  * @param gpio GPIO pin that triggered interrupt
-  * @param event Type of interrupt event
+  * @brief Applies a button event (live or replayed) to the game state
+  * @param event Button event
   */
- static void gpio_irq_callback(uint gpio, uint32_t event);
+ static void apply_button_event(const pb_event_t *event);
  
  /**
-  * @brief Timer callback for game countdown
+  * @brief Drains the button event queue, recording events during a live round
+  */
+ static void handle_button_events(void);
+ 
+ /**
+  * @brief Applies the replayed events due in the current frame
+  * @param x Receives the replayed cursor X, if any
+  * @param y Receives the replayed cursor Y, if any
+  * @return true if the recording moved the cursor in this frame
+  */
+ static bool replay_poll_frame(uint8_t *x, uint8_t *y);
+ 
+ /**
+  * @brief Wake-up condition for the menu: a button event or deferred work is pending
+  * @return true if the main loop has something to do
+  */
+ static bool input_or_work_pending(void);
+ 
+ /**
+  * @brief Wake-up condition for the menu wait: a button event, deferred work or a serial command is pending
+  * @return true if the menu loop has something to do
+  */
+ static bool menu_wake_pending(void);
+ 
+ /**
+  * @brief Wake-up condition for an untimed menu wait: also true once a button has an edge left to settle
+  * @return true if the menu loop has something to do or must arm a settle timeout
+  */
+ static bool menu_wake_or_unsettled_button(void);
+ 
+ /**
+  * @brief Deferred countdown step, posted by the timer IRQ and run by the main loop
+  * @param arg Unused
+  */
+ static void countdown_tick_work(uint32_t arg);
+ 
+ /**
+  * @brief Handles the serial commands (profiler dump, replay start and replay dump), if one arrived
+  */
+ static void poll_serial_commands(void);
+ 
+ /**
+  * @brief Timer callback for game countdown (only posts the deferred countdown step)
   * @param t Pointer to repeating timer structure
   * @return Always returns true to continue timer
   */
- bool repeating_timer_callback(struct repeating_timer *t);
+ bool repeating_timer_callback(hal_repeating_timer_t *t);
  
  // Main Application
  // ================
@@ -126,95 +332,306 @@
   */
  int main()
  {
-     // Initialize system clock to 128MHz (required for LED matrix timing)
-     set_sys_clock_khz(128000, false);
-     stdio_init_all();  // Initialize USB/UART communication
+     // Boot at the gameplay clock; drivers register with the clock manager as they are initialized
+     clockmgr_init(GAME_CLOCK_KHZ);
+     hal_stdio_init();  // Initialize USB/UART communication
+     tlog_init();  // Log messages are queued as tokens and sent by tlog_drain() from the main loop
  
      // Hardware objects
      rgb_t rgb;
      joystick_t joy;
      ssd1306_t ssd;
-     struct repeating_timer timer;
+     hal_repeating_timer_t timer;
      
      // Game state variables
-     uint16_t adj_led_red_pwm_value, adj_led_blue_pwm_value;
+     uint8_t adj_led_red_pwm_value, adj_led_blue_pwm_value;
      uint8_t joystick_vrx_norm, joystick_vry_norm;
      uint16_t joystick_vrx, joystick_vry;
+     uint16_t joystick_raw_x, joystick_raw_y;
+     int16_t cursor_x, cursor_y;
+     uint64_t frame_deadline;
+     uint32_t last_crunch_us = 0;
+     uint32_t frame_start_us;
+     uint32_t frame_us;
+     telemetry_sample_t telemetry_sample = {0};
+     telemetry_stats_t telemetry_stats;
+     tlog_stats_t log_stats;
+#if REPORT_CORE_UTILIZATION
+     uint16_t core_permille[2];
+#endif
+     uint32_t framebuffer_hash;
+     bool sample_ready;
+     bool moved;
+     work_stats_t work_stats;
      char cleared_bits_buffer[16];
  
      // Initialize hardware components
      rgb_init_all(&rgb, RED_PIN, GREEN_PIN, BLUE_PIN, 1.0, 2048);
+     rgb_fade_init(&rgb);
      joystick_init_all(&joy, JOYSTICK_VRX, JOYSTICK_VRY, JOYSTICK_PB, 120);
      oledgfx_init_all(&ssd, I2C_PORT, OLED_BAUDRATE, OLED_SDA, OLED_SCL, OLED_ADDR);
+     ssd1306_set_orientation(&ssd, OLED_ORIENTATION);  // Before dualcore_init, which copies it
      ssd_global = &ssd;  // Store global reference to OLED
+     if(!kv_mount(&kv, hal_flash_size() - KV_AREA_BYTES)) {
+         TLOG(STORE_UNAVAILABLE);
+     }
+     int stored = kv_get(&kv, KV_KEY_HIGH_SCORES, high_scores, sizeof(high_scores));
+     high_score_count = stored > 0 ? (uint8_t) (stored / sizeof(high_scores[0])) : 0;
+     setup_joystick_mapping(&joy);
  
      // Configure buttons and interrupts
      pb_config(JOYSTICK_PB, true);
      pb_config_btn_a();
      pb_config_btn_b();
-     pb_set_irq_callback(&gpio_irq_callback);
-     pb_enable_irq(BUTTON_A);
-     pb_enable_irq(JOYSTICK_PB);
-     pb_enable_irq(BUTTON_B);
+     pb_debounce_enable(BUTTON_A, PB_DEBOUNCE_DEFAULT_MS, PB_LONG_PRESS_DEFAULT_MS, PB_DOUBLE_PRESS_DEFAULT_MS);
+     pb_debounce_enable(JOYSTICK_PB, PB_DEBOUNCE_DEFAULT_MS, PB_LONG_PRESS_DEFAULT_MS, PB_DOUBLE_PRESS_DEFAULT_MS);
+     pb_debounce_enable(BUTTON_B, PB_DEBOUNCE_DEFAULT_MS, PB_LONG_PRESS_DEFAULT_MS, PB_DOUBLE_PRESS_DEFAULT_MS);
  
-     // Initialize buzzers
+     // Initialize buzzer A (melodies); buzzer B is set up by dualcore_init for PCM effects
      buzzer_init(BUZZER_A);
-     buzzer_init(BUZZER_B);
  
      // Initialize WS2812B LED matrix
-     ws_global = init_ws2812b(pio0, WS2812B_PIN);
+     ws_global = init_ws2812b(HAL_PIO0, WS2812B_PIN);
      ws2812b_turn_off_all(ws_global);
-     pwm_set_gpio_level(GREEN_PIN, 128);  // Set initial green LED state
  
-     printf("System initialized...\n");
+     // From here on core 1 owns the I2C display flush, the LED matrix and PCM audio (BUZZER_B)
+     dualcore_init(&ssd, ws_global, BUZZER_B);
+ 
+     // Boot splash, decompressed from flash straight into the frame buffer. Shown in
+     // 2-bit gray, the art at full brightness and its 2-pixel frame at a third
+     oledgfx_clear_screen(&ssd);
+     oledgfx_draw_asset(&ssd, &OLED_ASSET_SPLASH, 0, 0);
+     if(ssd1306_gray_init(&ssd, 2)) {
+         ssd1306_gray_from_mono(&ssd, 3);
+         for(uint8_t i = 0; i < 2; i++) {
+             for(uint8_t x = 0; x < WIDTH; x++) {
+                 ssd1306_gray_pixel(&ssd, x, i, 1);
+                 ssd1306_gray_pixel(&ssd, x, HEIGHT - 1 - i, 1);
+             }
+             for(uint8_t y = 0; y < HEIGHT; y++) {
+                 ssd1306_gray_pixel(&ssd, i, y, 1);
+                 ssd1306_gray_pixel(&ssd, WIDTH - 1 - i, y, 1);
+             }
+         }
+         dualcore_submit_gray(&ssd, SPLASH_GRAY_SLOT_US);
+     } else {
+         dualcore_submit_frame(&ssd);
+     }
+     hal_sleep_ms(SPLASH_HOLD_MS);
+     dualcore_gray_stats_t gray_stats;
+     if(dualcore_poll_gray_stats(&gray_stats)) {
+         // The plane cycle rate and how long each plane was fully shown, measured on core 1 with the real I2C time
+         TLOG(GRAY_REFRESH, gray_stats.rate_hz, gray_stats.max_cycle_us, gray_stats.bytes_per_cycle, gray_stats.flicker_free,
+              gray_stats.plane_on_us[0], gray_stats.plane_on_us[1]);
+     }
+     ssd1306_gray_init(&ssd, 0);  // The next submitted frame stops the plane cycle
+     rgb_set_color(0, LED_READY_GREEN, 0);  // Set initial green LED state
+ 
+     // Cycle profiler (compiled out with PROFILER_ENABLED=0)
+     profiler_init();
+     profiler_register_zone(PROF_ZONE_FRAME, "frame");
+     profiler_register_zone(PROF_ZONE_INPUT, "input");
+     profiler_register_zone(PROF_ZONE_JOYSTICK, "joystick");
+     profiler_register_zone(PROF_ZONE_CURSOR, "cursor");
+     profiler_register_zone(PROF_ZONE_BORDER, "border");
+     profiler_register_zone(PROF_ZONE_SUBMIT, "submit");
+     profiler_register_zone(PROF_ZONE_LEDS, "leds");
+ 
+     telemetry_init(TELEMETRY_PERIOD_US);
+ 
+     TLOG(SYSTEM_INITIALIZED);
  
      // Main game loop
      while(true) {
          if(game_status == GAME_STATUS_START) {
              // Game active state
-             buzzer_beep(BUZZER_A, 100, 2000);
-             printf("Game started\n");
+             set_state_clock(GAME_CLOCK_KHZ);
+             // Start jingle on buzzer A; the alarm-driven sequencer plays it while the game runs,
+             // and buzzer B stays with the PCM effects on core 1
+             buzzer_stop(BUZZER_A);
+             dualcore_stop_sound();
+             buzzer_play(BUZZER_A, START_MELODY_A, count_of(START_MELODY_A));
+             TLOG(GAME_STARTED);
              
              // Initialize countdown display
-             ws2812b_draw(ws_global, NUMERIC_GLYPHS[timer_counter], COLORS[timer_counter], 1);
+             dualcore_matrix_draw(NUMERIC_GLYPHS[timer_counter], COLORS[timer_counter], 1);
              
              // Start 1-second countdown timer
-             add_repeating_timer_ms(1000, repeating_timer_callback, NULL, &timer);
+             hal_repeating_timer_add_ms(1000, repeating_timer_callback, NULL, &timer);
              
+#if WORLD_ENABLED
+             // Build the level and show the window at its center
+             world_generate();
+             tilecanvas_render(&world, ssd_global, world_view_x, world_view_y);
+             dualcore_submit_frame(ssd_global);
+#else
              // Fill display with random pixels to erase
              oledgfx_random_fill_display(ssd_global);
+#endif
+             oledgfx_reset_cursor();  // The first cursor draw must not erase where the last round ended
+ 
+             // Live rounds are recorded; a replayed round leaves the recording untouched
+             game_frame = 0;
+             if(!replay_active) {
+                 replay_length = 0;
+                 replay_recorder_init(&replay_rec, replay_buffer, sizeof(replay_buffer), FRAME_PERIOD_US);
+             }
  
-             // Gameplay loop
+             // Gameplay loop: input is polled once per frame, the display is only
+             // flushed when the cursor actually moved, and the core sleeps (WFE)
+             // until the next frame deadline in between
+             cursor_x = cursor_y = INVALID_CURSOR;
+             frame_deadline = hal_time_us();
              while(game_status == GAME_STATUS_START) {
-                 // Draw game border
-                 oledgfx_draw_border(&ssd, BORDER_LIGHT);
- 
-                 // Read and process joystick input
-                 joystick_vrx = joystick_get_x(&joy);
-                 joystick_vry = joystick_get_y(&joy);
-         
-                 // Normalize joystick values for display coordinates
-                 joystick_vrx_norm = normalize_joystick_to_display(joystick_vrx, 127 - CURSOR_SIDE - BORDER_LIGHT);
-                 joystick_vry_norm = (63 - CURSOR_SIDE) - normalize_joystick_to_display(joystick_vry, 63 - CURSOR_SIDE - BORDER_LIGHT);
-         
-                 // Update cursor position and refresh display
-                 oledgfx_update_cursor(&ssd, joystick_vrx_norm, joystick_vry_norm);
-                 oledgfx_render(&ssd);
-     
-                 // Update LED brightness based on joystick position
-                 adj_led_red_pwm_value = adjust_pwm_led_value(joystick_vrx);
-                 adj_led_blue_pwm_value = adjust_pwm_led_value(joystick_vry);
-                 pwm_set_gpio_level(BLUE_PIN, adj_led_blue_pwm_value);
-                 pwm_set_gpio_level(RED_PIN, adj_led_red_pwm_value);
+                 // The recording ends on the first frame the live round never ran; with
+                 // the view scrolling on its own, even an idle extra frame would diverge
+                 if(replay_active && game_frame == replay_player.summary.frames) {
+                     game_status = GAME_STATUS_END;
+                     break;
+                 }
+                 frame_deadline += FRAME_PERIOD_US;
+                 frame_start_us = hal_time_us32();
+                 PROFILE_BEGIN(PROF_ZONE_FRAME);
+                 PROFILE_BEGIN(PROF_ZONE_INPUT);
+                 handle_button_events();
+                 work_dispatch(0);  // Countdown steps posted by the timer IRQ
+                 PROFILE_END(PROF_ZONE_INPUT);
+ 
+                 sample_ready = false;
+                 if(replay_active) {
+                     // The recording replaces the joystick (and any recorded button events)
+                     sample_ready = replay_poll_frame(&joystick_vrx_norm, &joystick_vry_norm);
+                 }
+                 else if(joystick_is_moving(&joy) || cursor_x == INVALID_CURSOR) {
+#if TRACE_JOYSTICK_ADC
+                     joystick_read_raw(&joy, &joystick_raw_x, &joystick_raw_y);
+                     printf("%lu,%u\n", (unsigned long) hal_time_us32(), joystick_raw_x);
+#endif
+                     // Map calibrated joystick values straight to display coordinates
+                     PROFILE_BEGIN(PROF_ZONE_JOYSTICK);
+                     joystick_read_smoothed(&joy, hal_time_us32(), &joystick_raw_x, &joystick_raw_y);
+                     joystick_map_apply(&joy_map, joystick_raw_x, joystick_raw_y, &joystick_vrx_norm, &joystick_vry_norm);
+                     PROFILE_END(PROF_ZONE_JOYSTICK);
+                     sample_ready = true;
+                 }
+ 
+                 moved = false;
+                 if(sample_ready && (joystick_vrx_norm != cursor_x || joystick_vry_norm != cursor_y)) {
+                     cursor_x = joystick_vrx_norm;
+                     cursor_y = joystick_vry_norm;
+                     if(!replay_active) replay_record_cursor(&replay_rec, game_frame, cursor_x, cursor_y);
+                     moved = true;
+                 }
+#if WORLD_ENABLED
+                 // A cursor held at an edge keeps scrolling without new joystick samples
+                 if(cursor_x != INVALID_CURSOR && world_scroll(cursor_x, cursor_y)) moved = true;
+#endif
+ 
+                 if(moved) {
+                     // Update cursor position, restore the border it may have crossed and refresh display
+                     PROFILE_BEGIN(PROF_ZONE_CURSOR);
+#if WORLD_ENABLED
+                     // Erase under the cursor in the level, then redraw the window with the cursor on top
+                     tilecanvas_fill_rect(&world, world_view_x + cursor_x, world_view_y + cursor_y, CURSOR_SIDE, CURSOR_SIDE, false);
+                     tilecanvas_render(&world, &ssd, world_view_x, world_view_y);
+                     oledgfx_draw_cursor(&ssd, cursor_x, cursor_y);
+#else
+                     oledgfx_update_cursor(&ssd, cursor_x, cursor_y);
+#endif
+                     PROFILE_END(PROF_ZONE_CURSOR);
+                     PROFILE_BEGIN(PROF_ZONE_BORDER);
+                     oledgfx_draw_border(&ssd, BORDER_LIGHT);
+                     PROFILE_END(PROF_ZONE_BORDER);
+                     PROFILE_BEGIN(PROF_ZONE_SUBMIT);
+                     dualcore_submit_frame(&ssd);  // Core 1 flushes it; this core never waits on I2C
+                     PROFILE_END(PROF_ZONE_SUBMIT);
+ 
+                     // Erase crunch, retriggered at most once per sample length
+                     PROFILE_BEGIN(PROF_ZONE_LEDS);
+                     if(hal_time_us32() - last_crunch_us >= CRUNCH_INTERVAL_US) {
+                         dualcore_play_sound(&PCM_SFX_CRUNCH, PCM_VOLUME_MAX * 3 / 4);
+                         last_crunch_us = hal_time_us32();
+                     }
+ 
+                     // Update LED brightness based on joystick position
+                     joystick_vrx = joystick_get_x(&joy);
+                     joystick_vry = joystick_get_y(&joy);
+                     adj_led_red_pwm_value = adjust_pwm_led_value(joystick_vrx);
+                     adj_led_blue_pwm_value = adjust_pwm_led_value(joystick_vry);
+                     rgb_fade_to(adj_led_red_pwm_value, 0, adj_led_blue_pwm_value, LED_FADE_MS);  // Ramp runs in the PWM wrap IRQ
+                     PROFILE_END(PROF_ZONE_LEDS);
+                 }
+ 
+                 game_frame++;
+                 PROFILE_END(PROF_ZONE_FRAME);
+                 frame_us = hal_time_us32() - frame_start_us;
+                 dualcore_account_busy(frame_us);
+ 
+                 // Telemetry only encodes into a RAM ring; the drain takes what the serial accepts right now
+                 if(telemetry_due(frame_start_us)) {
+                     telemetry_sample.time_us = frame_start_us;
+                     telemetry_sample.pixels = count_remaining_pixels();
+                     telemetry_sample.cursor_x = (uint8_t) cursor_x;
+                     telemetry_sample.cursor_y = (uint8_t) cursor_y;
+                     telemetry_sample.frame_us = (uint16_t) (frame_us > UINT16_MAX ? UINT16_MAX : frame_us);
+                     telemetry_push(&telemetry_sample);
+                 }
+                 telemetry_drain();
+                 tlog_drain();
+                 poll_serial_commands();
+#if REPORT_CORE_UTILIZATION
+                 if(dualcore_poll_utilization(core_permille)) {
+                     TLOG(CORE_UTILIZATION, core_permille[0] / 10, core_permille[0] % 10,
+                          core_permille[1] / 10, core_permille[1] % 10);
+                 }
+#endif
+                 hal_sleep_until_us(frame_deadline);  // WFE-based wait, returns immediately if the flush overran
              }
              
-             printf("Game ended\n");
-             buzzer_beep(BUZZER_A, 2000, 200);
-             cleared_display_bits = oledgfx_count_lit_pixels(ssd_global);
-             printf("%u pixels remain\n", cleared_display_bits);
+             TLOG(GAME_ENDED);
+             dualcore_play_sound(&PCM_SFX_GAME_OVER, PCM_VOLUME_MAX);
+             cleared_display_bits = count_remaining_pixels();
+             TLOG(PIXELS_REMAIN, cleared_display_bits);
+#if WORLD_ENABLED
+             TLOG(WORLD_STATS, world.unique_used, world.full_tiles, world.overflows);
+#endif
+             telemetry_sample.time_us = hal_time_us32();  // Final record with the round's score
+             telemetry_sample.pixels = cleared_display_bits;
+             telemetry_push(&telemetry_sample);
+             framebuffer_hash = replay_hash(ssd_global->ram_buffer, ssd_global->bufsize);
+             if(replay_active) {
+                 // Same input must give the same framebuffer and score
+                 bool match = framebuffer_hash == replay_player.summary.framebuffer_hash &&
+                              cleared_display_bits == replay_player.summary.score;
+                 if(match) TLOG(REPLAY_MATCHES, game_frame);
+                 else TLOG(REPLAY_MISMATCH, game_frame);
+                 replay_active = false;
+             }
+             else {
+                 replay_length = replay_record_end(&replay_rec, game_frame, cleared_display_bits, framebuffer_hash);
+                 if(replay_rec.truncated) TLOG(ROUND_RECORDED_TRUNCATED, replay_length);
+                 else TLOG(ROUND_RECORDED, replay_length);
+                 uint8_t rank = record_high_score(cleared_display_bits);
+                 if(rank) TLOG(NEW_HIGH_SCORE, rank, cleared_display_bits);
+             }
+             work_get_stats(&work_stats);
+             TLOG(WORK_STATS, work_stats.max_isr_us, work_stats.max_depth[WORK_PRIO_HIGH],
+                  work_stats.max_depth[WORK_PRIO_NORMAL], work_stats.max_depth[WORK_PRIO_LOW],
+                  work_stats.dropped);
+             telemetry_get_stats(&telemetry_stats);
+             TLOG(TELEMETRY_STATS, telemetry_stats.records, telemetry_stats.dropped);
+             tlog_get_stats(&log_stats);
+             TLOG(LOG_STATS, log_stats.written, log_stats.dropped);
          }
          else if(game_status == GAME_STATUS_WAITING) {
-             // Waiting for game start state
+             // Waiting for game start state: draw the menu once, then sleep until a button event
+             joystick_pause(&joy);  // Stop ADC conversions and the DMA traffic they generate
+ 
+             // Flash writes stall both cores (XIP off), so pending changes are only committed here
+             if(kv_dirty(&kv) && !kv_commit(&kv)) {
+                 TLOG(FLASH_WRITE_FAILED);
+             }
+             set_state_clock(MENU_CLOCK_KHZ);  // Lower power while idling in the menu
              oledgfx_clear_screen(ssd_global);
              oledgfx_draw_border(ssd_global, BORDER_THICK);
              
@@ -225,22 +642,50 @@
              ssd1306_draw_string(ssd_global, "SW reestart", 20, 32);
              
              // Display remaining pixels from previous game
-             sprintf(cleared_bits_buffer, "%u pel reman", cleared_display_bits);
+             fmt_render(cleared_bits_buffer, sizeof(cleared_bits_buffer), "%u pel reman", (const uint32_t[]) { cleared_display_bits }, 1);
              ssd1306_draw_string(ssd_global, cleared_bits_buffer, 5, 40);
-             ssd1306_send_data(ssd_global);
+             if(high_score_count) {
+                 fmt_render(cleared_bits_buffer, sizeof(cleared_bits_buffer), "rec %u pel", (const uint32_t[]) { high_scores[0] }, 1);
+                 ssd1306_draw_string(ssd_global, cleared_bits_buffer, 5, 48);
+             }
+             dualcore_submit_frame(ssd_global);
              
-             sleep_ms(50);  // Reduce CPU usage in waiting state
+#if MENU_DORMANT_ENABLED
+             // Core 1 sends the menu frame and parks before the clocks stop; the PCM stream is halted first
+             dualcore_stop_sound();
+             power_dormant_until_gpio((1u << BUTTON_A) | (1u << BUTTON_B));
+#endif
+             while(game_status == GAME_STATUS_WAITING) {
+                 handle_button_events();
+                 work_dispatch(0);
+                 telemetry_drain();
+                 tlog_drain();
+                 poll_serial_commands();
+                 if(game_status != GAME_STATUS_WAITING) break;
+                 // Wake on a button event, deferred work or a serial command. A timeout is armed only while a
+                 // bounced edge or a long press has to settle, or queued serial output waits for the host;
+                 // an edge ignored after this check ends the untimed wait so the next pass arms one
+                 uint32_t timeout_us = pb_settle_timeout_us();
+                 if(serial_tx_pending() && (timeout_us == 0 || timeout_us > MENU_TX_RETRY_US)) timeout_us = MENU_TX_RETRY_US;
+                 power_wait_until(timeout_us ? &menu_wake_pending : &menu_wake_or_unsettled_button, timeout_us);
+             }
+             joystick_resume(&joy);
          }
          else if(game_status == GAME_STATUS_END) {
              // Game over state - cleanup
-             cancel_repeating_timer(&timer);
+             hal_repeating_timer_cancel(&timer);
              timer_counter = 9;  // Reset countdown
              
-             // Turn off LEDs
-             pwm_set_gpio_level(BLUE_PIN, 0);
-             pwm_set_gpio_level(RED_PIN, 0);
-             pwm_set_gpio_level(GREEN_PIN, 128);
-             ws2812b_turn_off_all(ws_global);
+             // Fade red/blue out and the green "ready" LED back in
+             rgb_fade_to(0, LED_READY_GREEN, 0, 300);
+             dualcore_matrix_off();
+ 
+             // Game over art (centered) while the game over sound plays
+             oledgfx_clear_screen(ssd_global);
+             oledgfx_draw_asset(ssd_global, &OLED_ASSET_GAME_OVER,
+                                (WIDTH - OLED_ASSET_GAME_OVER.width) / 2, (ssd_global->pages - OLED_ASSET_GAME_OVER.pages) / 2);
+             dualcore_submit_frame(ssd_global);
+             hal_sleep_ms(GAME_OVER_HOLD_MS);
              
              // Return to waiting state
              game_status = GAME_STATUS_WAITING;
@@ -253,47 +698,248 @@
  // Helper Functions Implementation
  // ===============================
  
- static uint16_t normalize_joystick_to_display(uint16_t joystick_vr, uint8_t new_max)
+ static void set_state_clock(uint32_t khz)
  {
-     return (joystick_vr * new_max) / 4095;
+     clockmgr_stats_t stats;
+ 
+     if(khz == clockmgr_get_khz()) return;
+     if(!clockmgr_set_khz(khz)) {
+         TLOG(CLOCK_UNAVAILABLE, khz);
+         return;
+     }
+     clockmgr_get_stats(&stats);
+     TLOG(CLOCK_CHANGED, khz, stats.last_switch_us);
  }
  
- static void gpio_irq_callback(uint gpio, uint32_t event)
+#if WORLD_ENABLED
+ static void world_generate(void)
  {
-     if(pb_is_debounce_delay_over()) {
-         if(BUTTON_B_PRESSED) {
-             // Enter USB boot mode for firmware updates
-             set_bootsel_mode();
+     static const char glyphs[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+     uint32_t seed = 0x2545F491u;
+ 
+     tilecanvas_init(&world, WORLD_WIDTH, WORLD_HEIGHT);
+     for(uint16_t ty = 0; ty < WORLD_HEIGHT / 8; ty++) {
+         for(uint16_t tx = 0; tx < WORLD_WIDTH / 8; tx++) {
+             seed = seed * 1664525u + 1013904223u;  // LCG: cheap and identical on every build
+             uint8_t r = (uint8_t) (seed >> 24);
+             if(r < 16) tilecanvas_put_tile(&world, tx, ty, ~0ull);  // Solid block
+             else if(r >= 48) tilecanvas_put_tile(&world, tx, ty, tilecanvas_tile(ssd1306_glyph(glyphs[r % (sizeof(glyphs) - 1)])));
          }
-         else if(BUTTON_A_PRESSED) {
-             // Start game
-             game_status = GAME_STATUS_START;
-             pwm_set_gpio_level(GREEN_PIN, 0);  // Turn off green LED
+     }
+     world_view_x = (WORLD_WIDTH - WIDTH) / 2;
+     world_view_y = (WORLD_HEIGHT - HEIGHT) / 2;
+ }
+ 
+ static bool world_scroll(int16_t x, int16_t y)
+ {
+     int32_t view_x = world_view_x, view_y = world_view_y;
+ 
+     if(x <= WORLD_SCROLL_MARGIN) view_x -= WORLD_SCROLL_STEP;
+     else if(x + CURSOR_SIDE >= WIDTH - WORLD_SCROLL_MARGIN) view_x += WORLD_SCROLL_STEP;
+     if(y <= BORDER_LIGHT + WORLD_SCROLL_MARGIN) view_y -= WORLD_SCROLL_STEP;
+     else if(y + CURSOR_SIDE >= HEIGHT - WORLD_SCROLL_MARGIN) view_y += WORLD_SCROLL_STEP;
+ 
+     if(view_x < 0) view_x = 0;
+     if(view_x > WORLD_WIDTH - WIDTH) view_x = WORLD_WIDTH - WIDTH;
+     if(view_y < 0) view_y = 0;
+     if(view_y > WORLD_HEIGHT - HEIGHT) view_y = WORLD_HEIGHT - HEIGHT;
+     if(view_x == world_view_x && view_y == world_view_y) return false;
+ 
+     world_view_x = (uint16_t) view_x;
+     world_view_y = (uint16_t) view_y;
+     return true;
+ }
+#endif
+ 
+ static uint16_t count_remaining_pixels(void)
+ {
+#if WORLD_ENABLED
+     uint32_t lit = tilecanvas_count_lit(&world);
+     return lit > UINT16_MAX ? UINT16_MAX : (uint16_t) lit;
+#else
+     return oledgfx_count_lit_pixels(ssd_global);
+#endif
+ }
+ 
+ static void setup_joystick_mapping(const joystick_t *joy)
+ {
+     joystick_calibration_default(joy, &joy_calibration);
+ 
+     joystick_calibration_t stored;
+     if(kv_get(&kv, KV_KEY_CALIBRATION, &stored, sizeof(stored)) == (int) sizeof(stored) &&
+        joystick_calibration_is_valid(&stored)) {
+         joy_calibration = stored;
+         TLOG(CALIBRATION_LOADED);
+     }
+ 
+     if(pb_is_button_pressed(JOYSTICK_PB)) {
+         // Calibration requested: release the stick, then sweep it to the stops.
+         // "Solte" stays alone on screen until the rest phase has measured the center
+         joystick_calibration_t measured = joy_calibration;
+         oledgfx_clear_screen(ssd_global);
+         ssd1306_draw_string(ssd_global, "Calibrar", 30, 16);
+         ssd1306_draw_string(ssd_global, "Solte", 40, 32);
+         ssd1306_send_data(ssd_global);
+         hal_sleep_ms(1000);  // Time to let go of the stick after holding the button
+         joystick_calibrate_rest(joy, &measured, 1000);
+         ssd1306_draw_string(ssd_global, "Gire tudo", 24, 40);
+         ssd1306_send_data(ssd_global);
+         joystick_calibrate_sweep(joy, &measured, 4000);
+         TLOG(CALIBRATED, measured.min_x, measured.center_x, measured.max_x,
+              measured.min_y, measured.center_y, measured.max_y,
+              measured.deadzone);
+         if(joystick_calibration_is_valid(&measured)) {
+             joy_calibration = measured;
+             kv_set(&kv, KV_KEY_CALIBRATION, &joy_calibration, sizeof(joy_calibration));
+         } else {
+             TLOG(CALIBRATION_REJECTED);  // Keeps the stored or default profile
          }
-         else if(JOYSTICK_SW_PRESSED) {
-             // End game
-             game_status = GAME_STATUS_END;
+     }
+ 
+     // Cursor must stay inside the border; Y grows downwards on the display
+     joystick_map_build(&joy_map, &joy_calibration,
+                        0, 127 - CURSOR_SIDE - BORDER_LIGHT,
+                        63 - CURSOR_SIDE, BORDER_LIGHT);
+ }
+ 
+ static uint8_t record_high_score(uint16_t score)
+ {
+     uint8_t rank = high_score_count;
+ 
+     while(rank > 0 && score < high_scores[rank - 1]) rank--;
+     if(rank >= HIGH_SCORE_COUNT) return 0;
+ 
+     if(high_score_count < HIGH_SCORE_COUNT) high_score_count++;
+     for(uint8_t i = high_score_count - 1; i > rank; i--) high_scores[i] = high_scores[i - 1];
+     high_scores[rank] = score;
+     kv_set(&kv, KV_KEY_HIGH_SCORES, high_scores, high_score_count * sizeof(high_scores[0]));
+     return (uint8_t) (rank + 1);
+ }
+ 
+ static void handle_button_events(void)
+ {
+     pb_event_t event;
+ 
+     while(pb_get_event(&event)) {
+         if(game_status == GAME_STATUS_START && !replay_active) {
+             replay_record_button(&replay_rec, game_frame, event.gpio, (uint8_t) event.type);
          }
+         apply_button_event(&event);
+     }
+ }
+ 
+ static void apply_button_event(const pb_event_t *event)
+ {
+     if(event->type != PB_EVENT_PRESS) return;
+ 
+     if(event->gpio == BUTTON_B) {
+         // Enter USB boot mode for firmware updates, keeping scores not yet written
+         kv_commit(&kv);
+         set_bootsel_mode();
+     }
+     else if(event->gpio == BUTTON_A) {
+         // Start game
+         game_status = GAME_STATUS_START;
+         rgb_set_color(0, 0, 0);  // Turn off green LED
+     }
+     else if(event->gpio == JOYSTICK_PB) {
+         // End game
+         game_status = GAME_STATUS_END;
      }
  }
  
- static uint16_t adjust_pwm_led_value(uint16_t pwm_value)
+ static uint8_t adjust_pwm_led_value(uint16_t pwm_value)
  {
-     // Convert joystick position to LED brightness
-     return (pwm_value >= 2048) ? (pwm_value - 2048) : (2048 - pwm_value);
+     // Convert joystick position to LED brightness (14-bit offset from center scaled to a 0-255 perceptual level)
+     uint16_t offset = (pwm_value >= JOYSTICK_ADC_CENTER) ? (pwm_value - JOYSTICK_ADC_CENTER) : (JOYSTICK_ADC_CENTER - pwm_value);
+     offset >>= 5;
+     return (offset > 255) ? 255 : (uint8_t) offset;
  }
  
- bool repeating_timer_callback(struct repeating_timer *t) {
+ static bool input_or_work_pending(void)
+ {
+     return pb_has_event() || work_pending();
+ }
+ 
+ static bool menu_wake_pending(void)
+ {
+     return input_or_work_pending() || hal_serial_readable();
+ }
+ 
+ static bool menu_wake_or_unsettled_button(void)
+ {
+     return menu_wake_pending() || pb_settle_timeout_us() != 0;
+ }
+ 
+ static void countdown_tick_work(uint32_t arg)
+ {
+     (void) arg;
+     if(game_status != GAME_STATUS_START || timer_counter == 0) return;  // Stale tick after the game ended
+ 
      // Update countdown display
      timer_counter--;
-     ws2812b_draw(ws_global, NUMERIC_GLYPHS[timer_counter], COLORS[timer_counter], 1);
+     dualcore_matrix_draw(NUMERIC_GLYPHS[timer_counter], COLORS[timer_counter], 1);
+     dualcore_play_sound(&PCM_SFX_TICK, PCM_VOLUME_MAX);
      
-     // End game when countdown reaches 0
-     if(timer_counter == 0) {
-         cancel_repeating_timer(t);
+     // End game when countdown reaches 0 (the END state cancels the timer and resets the counter);
+     // a replayed round ends on the recorded frame instead, so frame overruns cannot cut it short
+     if(timer_counter == 0 && !replay_active) {
          game_status = GAME_STATUS_END;
-         timer_counter = 9;  // Reset for next game
      }
+ }
+ 
+ static bool replay_poll_frame(uint8_t *x, uint8_t *y)
+ {
+     replay_event_t event;
+     pb_event_t button;
+     bool moved = false;
+ 
+     while(replay_next(&replay_player, game_frame, &event)) {
+         if(event.type == REPLAY_EVENT_CURSOR) {
+             *x = event.x;
+             *y = event.y;
+             moved = true;
+         }
+         else if(event.type == REPLAY_EVENT_BUTTON) {
+             button.gpio = event.gpio;
+             button.type = event.button_event;
+             button.time_us = 0;
+             apply_button_event(&button);
+         }
+         else {
+             game_status = GAME_STATUS_END;
+         }
+     }
+     return moved;
+ }
+ 
+ static void poll_serial_commands(void)
+ {
+     // Non-blocking: the serial link is polled once per frame (or per menu wake-up)
+     int command = hal_getc_nonblocking();
+ 
+     // Raw dumps bypass the shared TX queue, so queued frames go out first instead of being split
+     if(command == PROFILER_DUMP_COMMAND && serial_tx_flush(SERIAL_DUMP_FLUSH_MS)) {
+         profiler_dump();
+     }
+     else if(command == REPLAY_DUMP_COMMAND && replay_length && serial_tx_flush(SERIAL_DUMP_FLUSH_MS)) {
+         // Raw binary record, found by its "ERP1" magic on the host
+         for(size_t i = 0; i < replay_length; i++) hal_putc_raw(replay_buffer[i]);
+         hal_flush();
+     }
+     else if(command == REPLAY_START_COMMAND && game_status == GAME_STATUS_WAITING &&
+             replay_length && replay_player_init(&replay_player, replay_buffer, replay_length)) {
+         replay_active = true;
+         game_status = GAME_STATUS_START;
+         rgb_set_color(0, 0, 0);
+         TLOG(REPLAYING);
+     }
+ }
+ 
+ bool repeating_timer_callback(hal_repeating_timer_t *t) {
+     uint32_t isr_start = work_isr_begin();
+     work_post(WORK_PRIO_HIGH, countdown_tick_work, 0);
+     work_isr_end(isr_start);
      
      return true;  // Continue timer
  }
\ No newline at end of file
@@ -0,0 +1,202 @@
+/**
+ * @file eraseit_bench.c
+ * @brief Firmware de medidas no RP2040: uma bateria fixa, resultados em CSV pela USB.
+ *
+ * Complementa os microbenchmarks do host com o que só aparece na placa:
+ * faltas na cache do XIP, tempo de fio do I2C e espera na FIFO do PIO. Mede
+ * o envio do quadro inteiro (também girado em 90°, com a transposição em
+ * software), de 8 colunas e das diferenças entre dois planos de tons de
+ * cinza (a troca de plano da tela de abertura) ao display, o preenchimento, o
+ * texto, o cursor e a descompressão de uma tela inteira (lida da flash) no
+ * framebuffer, um quadro da matriz WS2812 e a leitura do
+ * joystick no ring do ADC, com o mesmo relógio do jogo.
+ *
+ * Cada caso roda `reps` amostras de `batch` operações cronometradas pelo
+ * timer de microssegundos; operações rápidas usam lotes maiores para ficar
+ * acima da resolução do timer. A bateria roda a cada caractere recebido pela
+ * serial e imprime, por caso:
+ *     caso,reps,batch,min_us,media_us,max_us,ciclos
+ * onde os tempos são por operação e `ciclos` é a média em ciclos de clk_sys.
+ * Linhas iniciadas por '#' são comentários (relógio e data da compilação),
+ * de modo que capturas de builds diferentes podem ser comparadas direto.
+ *
+ * Compilação: alvo `EraseIt_bench` do CMake (com PICO_SDK_PATH).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../lib/hal.h"
+#include "../lib/ssd1306.h"
+#include "../lib/oledgfx.h"
+#include "../lib/oled_assets.h"
+#include "../lib/ws2812b.h"
+#include "../lib/ws2812b_definitions.h"
+#include "../lib/joystick.h"
+
+/** @brief Mesmos pinos, endereço e relógio de EraseIt.c. */
+#define BENCH_SYS_CLOCK_KHZ 128000
+#define OLED_SDA 14
+#define OLED_SCL 15
+#define OLED_ADDR 0x3C
+#define OLED_BAUDRATE 400000
+#define JOYSTICK_VRX 27
+#define JOYSTICK_VRY 26
+#define JOYSTICK_PB 22
+#define WS2812B_PIN 7
+
+#define BENCH_PARTIAL_COLUMNS 8  ///< Colunas enviadas no envio parcial (um cursor)
+#define BENCH_PROMPT_MS 2000     ///< Intervalo entre os convites enquanto ninguém envia nada
+
+/** @brief Um caso da bateria. */
+typedef struct
+{
+    const char *name;
+    uint16_t reps;
+    uint16_t batch;
+    void (*run)(uint32_t i);
+} bench_case_t;
+
+static ssd1306_t ssd;
+static ssd1306_t ssd_rotated; // Mesmo framebuffer, visto em 64x128
+static uint8_t gray_planes[2][WIDTH * HEIGHT / 8 + 1]; // Abertura com e sem a moldura
+static uint8_t gray_shown[WIDTH * HEIGHT / 8 + 1];
+static ws2812b_t *ws;
+static joystick_t joy;
+static volatile uint32_t sink;
+
+static uint8_t bench_coord(uint32_t i, uint8_t range)
+{
+    // Posições espalhadas e reproduzíveis (hash multiplicativo do índice)
+    return (uint8_t) (((i * 2654435761u) >> 16) % range);
+}
+
+static void run_flush_full(uint32_t i)
+{
+    (void) i;
+    ssd1306_send_data(&ssd);
+}
+
+static void run_flush_rotated(uint32_t i)
+{
+    (void) i;
+    ssd1306_send_data(&ssd_rotated);
+}
+
+static void run_flush_partial(uint32_t i)
+{
+    uint8_t x = (uint8_t) ((i * BENCH_PARTIAL_COLUMNS) % WIDTH);
+    ssd1306_send_columns(&ssd, x, (uint8_t) (x + BENCH_PARTIAL_COLUMNS - 1));
+}
+
+static void run_gray_delta(uint32_t i) { sink = (uint32_t) ssd1306_send_delta(&ssd, gray_shown, gray_planes[(i + 1) & 1]); }
+
+static void run_fill(uint32_t i) { ssd1306_fill(&ssd, (bool) (i & 1)); }
+
+static void run_text(uint32_t i) { ssd1306_draw_string(&ssd, "1234 pel reman", 8, (uint8_t) (8 * (i & 7))); }
+
+static void run_cursor(uint32_t i) { oledgfx_update_cursor(&ssd, bench_coord(i, WIDTH - 8), bench_coord(i + 7, HEIGHT - 8)); }
+
+static void run_asset(uint32_t i)
+{
+    (void) i;
+    oledgfx_draw_asset(&ssd, &OLED_ASSET_SPLASH, 0, 0);
+}
+
+static void run_ws2812_frame(uint32_t i) { ws2812b_draw(ws, NUMERIC_GLYPHS[i % 10], (uint8_t) (i % 7), 50); }
+
+static void run_adc_read(uint32_t i)
+{
+    uint16_t x, y;
+    (void) i;
+    joystick_read_raw(&joy, &x, &y);
+    sink = x + y;
+}
+
+static const bench_case_t cases[] = {
+    { "flush_full", 50, 1, run_flush_full },
+    { "flush_rotated", 50, 1, run_flush_rotated },
+    { "flush_partial", 200, 1, run_flush_partial },
+    { "gray_delta", 100, 1, run_gray_delta },
+    { "fill", 200, 10, run_fill },
+    { "text", 200, 10, run_text },
+    { "cursor", 200, 10, run_cursor },
+    { "asset", 200, 10, run_asset },
+    { "ws2812_frame", 100, 1, run_ws2812_frame },
+    { "adc_read", 200, 10, run_adc_read },
+};
+
+static void bench_run_case(const bench_case_t *c)
+{
+    uint32_t min_us = UINT32_MAX, max_us = 0;
+    uint64_t sum_us = 0;
+    uint32_t i = 0;
+
+    for (uint16_t r = 0; r < c->reps; r++)
+    {
+        uint32_t start = hal_time_us32();
+        for (uint16_t b = 0; b < c->batch; b++) c->run(i++);
+        uint32_t elapsed = hal_time_us32() - start;
+        if (elapsed < min_us) min_us = elapsed;
+        if (elapsed > max_us) max_us = elapsed;
+        sum_us += elapsed;
+    }
+
+    float mean_us = (float) sum_us / ((float) c->reps * c->batch);
+    printf("%s,%u,%u,%.3f,%.3f,%.3f,%.0f\n", c->name, c->reps, c->batch,
+           (float) min_us / c->batch, mean_us, (float) max_us / c->batch,
+           mean_us * (float) hal_clock_sys_hz() / 1e6f);
+}
+
+static void bench_run_all(void)
+{
+    printf("# EraseIt_bench clk_sys_hz=%lu build=%s %s\n", (unsigned long) hal_clock_sys_hz(), __DATE__, __TIME__);
+    printf("caso,reps,batch,min_us,media_us,max_us,ciclos\n");
+    for (size_t c = 0; c < count_of(cases); c++)
+    {
+        oledgfx_random_fill_display(&ssd); // Todos os casos partem do mesmo framebuffer
+        oledgfx_reset_cursor();
+        bench_run_case(&cases[c]);
+    }
+    ws2812b_turn_off_all(ws);
+    printf("# fim\n");
+    hal_flush();
+}
+
+int main(void)
+{
+    hal_set_sys_clock_khz(BENCH_SYS_CLOCK_KHZ, false);
+    hal_stdio_init();
+
+    joystick_init_all(&joy, JOYSTICK_VRX, JOYSTICK_VRY, JOYSTICK_PB, 120);
+    oledgfx_init_all(&ssd, HAL_I2C1, OLED_BAUDRATE, OLED_SDA, OLED_SCL, OLED_ADDR);
+    ws = init_ws2812b(HAL_PIO0, WS2812B_PIN);
+    // Só o tempo importa: o painel volta à orientação padrão para os outros casos
+    ssd_rotated = ssd;
+    ssd1306_set_orientation(&ssd_rotated, SSD1306_ROTATE_90);
+    ssd1306_set_orientation(&ssd, SSD1306_ROTATE_0);
+    // Planos da abertura em 2 bits: a moldura só no plano 0
+    oledgfx_draw_asset(&ssd, &OLED_ASSET_SPLASH, 0, 0);
+    memcpy(gray_planes[0], ssd.ram_buffer, ssd.bufsize);
+    ssd1306_rect(&ssd, 0, 0, WIDTH, HEIGHT, false, false);
+    ssd1306_rect(&ssd, 1, 1, WIDTH - 2, HEIGHT - 2, false, false);
+    memcpy(gray_planes[1], ssd.ram_buffer, ssd.bufsize);
+    memcpy(gray_shown, gray_planes[0], ssd.bufsize);
+
+    while (true)
+    {
+        // A USB só enumera depois do boot: a bateria espera um caractere do host
+        uint32_t waited_ms = 0;
+        while (hal_getc_nonblocking() == HAL_SERIAL_NONE)
+        {
+            if (waited_ms % BENCH_PROMPT_MS == 0) printf("# envie qualquer caractere para medir\n");
+            hal_sleep_ms(10);
+            waited_ms += 10;
+        }
+        bench_run_all();
+    }
+}
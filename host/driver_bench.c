@@ -0,0 +1,477 @@
+/**
+ * @file driver_bench.c
+ * @brief Microbenchmarks de host para os caminhos quentes dos drivers.
+ *
+ * Mede, com a HAL Linux, as funções chamadas a cada quadro ou comando:
+ * pixels, preenchimento e texto no framebuffer do SSD1306, cursor, contagem
+ * de pixels e descompressão de imagens do `oledgfx`, transposição do quadro
+ * para o painel girado em 90°, envio só das diferenças entre dois planos de
+ * tons de cinza, composição e envio de um quadro da matriz
+ * WS2812 (para o buffer de captura da HAL), deslocamentos do
+ * `ws2812b_motion` e o `parse_command` do lite5. As formas preenchidas do
+ * `raster` (círculo, hexágono, linha grossa) são medidas ao lado de versões
+ * ingênuas, que testam cada pixel do retângulo envolvente e o acendem com
+ * `ssd1306_pixel`.
+ *
+ * Cada medida repete a operação em lotes de pelo menos `--min-time` ms e
+ * informa a mediana (e o mínimo) de 7 lotes, em ns por operação, junto com os
+ * bytes movidos por operação segundo o modelo de cada caso (bytes lidos ou
+ * escritos no framebuffer, na captura ou na entrada).
+ *
+ * Compilação e uso (alvo do host, sem PICO_SDK_PATH):
+ *     cmake -S . -B build-host && cmake --build build-host
+ *     ./build-host/EraseIt_host_bench                       # tabela
+ *     ./build-host/EraseIt_host_bench --json > base.json    # registro
+ *     ./build-host/EraseIt_host_bench --baseline base.json --max-regression 10
+ *
+ * Com `--baseline`, o mínimo de cada caso é comparado ao do registro
+ * anterior (o mínimo varia menos que a mediana com a carga da máquina); com
+ * `--max-regression`, o código de saída é diferente de zero se algum caso
+ * ficar mais lento que o limite (em %).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../lib/hal_linux.h"
+#include "../lib/ssd1306.h"
+#include "../lib/oledgfx.h"
+#include "../lib/oled_assets.h"
+#include "../lib/raster.h"
+#include "../lib/ws2812b.h"
+#include "../lib/ws2812b_motion.h"
+#include "../lib/lite5.h"
+#include "../lib/ws2812b_definitions.h"
+
+#define BENCH_SAMPLES 7       ///< Lotes medidos por caso (vale a mediana)
+#define BENCH_MAX_CASES 32    ///< Casos em um registro de baseline
+#define BENCH_TABLE_LEN 256   ///< Entradas pré-sorteadas (potência de 2)
+#define BENCH_JSON_VERSION 1  ///< Versão do registro JSON
+
+/** @brief Um caso medido. */
+typedef struct
+{
+    const char *name;
+    double bytes_per_op;
+    void (*run)(uint64_t iterations);
+} bench_case_t;
+
+/** @brief Resultado de um caso. */
+typedef struct
+{
+    const char *name;
+    double ns_per_op;
+    double min_ns_per_op;
+    double bytes_per_op;
+    uint64_t iterations;
+} bench_result_t;
+
+/** @brief Caso lido de um registro anterior. */
+typedef struct
+{
+    char name[64];
+    double min_ns_per_op;
+} bench_baseline_t;
+
+static ssd1306_t ssd;
+static ssd1306_t portrait; // Mesmo framebuffer, visto em 64x128 (ROTATE_90)
+static uint8_t panel[WIDTH * HEIGHT / 8 + 1];
+static uint8_t gray_planes[2][WIDTH * HEIGHT / 8 + 1]; // Abertura com e sem a moldura
+static uint8_t gray_shown[WIDTH * HEIGHT / 8 + 1];
+static ws2812b_t *ws;
+static uint8_t coords[BENCH_TABLE_LEN][2];
+static uint8_t glyph[25];
+static uint8_t shifted[25];
+static volatile uint32_t sink;
+
+static const raster_point_t hexagon[] = { { 36, 32 }, { 50, 10 }, { 78, 10 }, { 92, 32 }, { 78, 54 }, { 50, 54 } };
+
+static const char *const commands[] = { "3r50", "0g100", "9b7", "5w25", "1m80", "7y5", "2p99", "4r0" };
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+// Casos
+// =====
+
+static void run_pixel(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++)
+    {
+        const uint8_t *c = coords[i & (BENCH_TABLE_LEN - 1)];
+        ssd1306_pixel(&ssd, c[0], c[1] & 63, (bool) (i & 1));
+    }
+}
+
+static void run_fill(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ssd1306_fill(&ssd, (bool) (i & 1));
+}
+
+static void run_draw_string(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ssd1306_draw_string(&ssd, "1234 pel reman", 8, (uint8_t) (8 * (i & 7)));
+}
+
+static void run_update_cursor(uint64_t n)
+{
+    oledgfx_reset_cursor();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        const uint8_t *c = coords[i & (BENCH_TABLE_LEN - 1)];
+        oledgfx_update_cursor(&ssd, c[0] % (WIDTH - 8), c[1] % (HEIGHT - 8));
+    }
+}
+
+static void run_count_lit(uint64_t n)
+{
+    uint32_t total = 0;
+    for (uint64_t i = 0; i < n; i++) total += oledgfx_count_lit_pixels(&ssd);
+    sink = total;
+}
+
+static void run_draw_asset(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) oledgfx_draw_asset(&ssd, &OLED_ASSET_SPLASH, 0, 0);
+}
+
+static void run_to_panel(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ssd1306_to_panel(&portrait, panel);
+    sink = panel[1 + (sink & 1023)];
+}
+
+static void run_send_delta(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) sink += (uint32_t) ssd1306_send_delta(&ssd, gray_shown, gray_planes[(i + 1) & 1]);
+}
+
+static void run_fill_circle(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) raster_fill_circle(&ssd, 64, 32, 20, (bool) (i & 1));
+}
+
+static void run_fill_circle_naive(uint64_t n)
+{
+    const int32_t cx = 64, cy = 32, r = 20;
+    for (uint64_t i = 0; i < n; i++)
+        for (int32_t y = cy - r; y <= cy + r; y++)
+            for (int32_t x = cx - r; x <= cx + r; x++)
+                if ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r + r) ssd1306_pixel(&ssd, x, y, (bool) (i & 1));
+}
+
+static void run_fill_convex(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) raster_fill_convex(&ssd, hexagon, count_of(hexagon), (bool) (i & 1));
+}
+
+static void run_fill_convex_naive(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++)
+        for (int32_t y = 10; y <= 54; y++)
+            for (int32_t x = 36; x <= 92; x++)
+            {
+                // Dentro se estiver do mesmo lado de todas as arestas (sentido horário na tela)
+                bool inside = true;
+                for (size_t e = 0; e < count_of(hexagon) && inside; e++)
+                {
+                    const raster_point_t *a = &hexagon[e], *b = &hexagon[(e + 1) % count_of(hexagon)];
+                    inside = (b->x - a->x) * (y - a->y) - (b->y - a->y) * (x - a->x) >= 0;
+                }
+                if (inside) ssd1306_pixel(&ssd, x, y, (bool) (i & 1));
+            }
+}
+
+static void run_thick_line(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) raster_thick_line(&ssd, 8, 8, 120, 56, 5, (bool) (i & 1));
+}
+
+static void run_thick_line_naive(uint64_t n)
+{
+    const int32_t x0 = 8, y0 = 8, dx = 112, dy = 48, t = 5, len2 = dx * dx + dy * dy;
+    for (uint64_t i = 0; i < n; i++)
+        for (int32_t y = y0 - t; y <= y0 + dy + t; y++)
+            for (int32_t x = x0 - t; x <= x0 + dx + t; x++)
+            {
+                // Projeção dentro do segmento e distância ao eixo de até (t - 1) / 2 pixels do lado da
+                // normal (-dy, dx) e t / 2 do outro, mais meio pixel, como em `raster_thick_line`
+                int32_t along = dx * (x - x0) + dy * (y - y0);
+                int32_t across = dx * (y - y0) - dy * (x - x0);
+                int32_t side = 2 * (across >= 0 ? (t - 1) / 2 : t / 2) + 1;
+                if (along >= 0 && along <= len2 && 4 * across * across <= side * side * len2) ssd1306_pixel(&ssd, x, y, (bool) (i & 1));
+            }
+}
+
+static void run_ws2812b_draw(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ws2812b_draw(ws, glyph, (uint8_t) (i % 7), (uint8_t) (i % 101));
+}
+
+static void run_shift_left(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ws2812b_motion_shift_left(glyph, shifted);
+    sink = shifted[12];
+}
+
+static void run_shift_right(uint64_t n)
+{
+    for (uint64_t i = 0; i < n; i++) ws2812b_motion_shift_right(glyph, shifted);
+    sink = shifted[12];
+}
+
+static void run_parse_command(uint64_t n)
+{
+    uint32_t total = 0;
+    for (uint64_t i = 0; i < n; i++)
+    {
+        Command cmd = parse_command(commands[i % count_of(commands)]);
+        total += cmd.pattern + cmd.color + cmd.intensity;
+    }
+    sink = total;
+}
+
+/**
+ * @brief Casos e bytes movidos por operação.
+ *
+ * Pixel: um byte lido e escrito. Preenchimento e contagem: o framebuffer
+ * inteiro (1024 bytes, mais o byte de controle na contagem). Texto: 8 bytes
+ * por caractere. Cursor: 8 colunas em até 2 páginas, apagadas e desenhadas.
+ * Imagem: a tela inteira escrita (a leitura dos dados comprimidos não conta).
+ * Transposição: o framebuffer lido e o quadro do painel escrito (2 x 1024).
+ * Diferenças entre planos: os bytes de fio da troca (a moldura da abertura).
+ * Formas: os pixels cobertos / 8, iguais nas versões por trechos e ingênuas
+ * do círculo e do polígono; na linha grossa, a faixa exata da versão ingênua
+ * deixa de fora as bordas de Bresenham do quadrilátero (625 contra 661).
+ * Matriz: 25 palavras de 4 bytes na captura. Deslocamento: 25 bytes lidos e
+ * 25 escritos. Comando: os bytes da entrada.
+ */
+static const bench_case_t cases[] = {
+    { "ssd1306_pixel", 2, run_pixel },
+    { "ssd1306_fill", 1024, run_fill },
+    { "ssd1306_draw_string", 14 * 8, run_draw_string },
+    { "oledgfx_update_cursor", 2 * 8 * 2, run_update_cursor },
+    { "oledgfx_count_lit_pixels", 1025, run_count_lit },
+    { "oledgfx_draw_asset", 1024, run_draw_asset },
+    { "ssd1306_to_panel", 2 * 1024, run_to_panel },
+    { "ssd1306_send_delta", 328, run_send_delta },
+    { "raster_fill_circle", 1313 / 8.0, run_fill_circle },
+    { "naive_fill_circle", 1313 / 8.0, run_fill_circle_naive },
+    { "raster_fill_convex", 1921 / 8.0, run_fill_convex },
+    { "naive_fill_convex", 1921 / 8.0, run_fill_convex_naive },
+    { "raster_thick_line", 661 / 8.0, run_thick_line },
+    { "naive_thick_line", 625 / 8.0, run_thick_line_naive },
+    { "ws2812b_draw", 25 * 4, run_ws2812b_draw },
+    { "ws2812b_motion_shift_left", 50, run_shift_left },
+    { "ws2812b_motion_shift_right", 50, run_shift_right },
+    { "parse_command", 4, run_parse_command },
+};
+
+// Medida
+// ======
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static bench_result_t measure(const bench_case_t *c, double min_time_ms)
+{
+    uint64_t target_ns = (uint64_t) (min_time_ms * 1e6);
+    uint64_t n = 1, elapsed = 0;
+
+    // Dobra o lote até ele durar um décimo do alvo e então extrapola
+    while (true)
+    {
+        uint64_t t0 = now_ns();
+        c->run(n);
+        elapsed = now_ns() - t0;
+        if (elapsed * 10 >= target_ns || n >= (1ull << 40)) break;
+        n *= 2;
+    }
+    if (elapsed < target_ns) n = (uint64_t) ((double) n * target_ns / (elapsed ? elapsed : 1)) + 1;
+
+    double samples[BENCH_SAMPLES];
+    for (int s = 0; s < BENCH_SAMPLES; s++)
+    {
+        uint64_t t0 = now_ns();
+        c->run(n);
+        samples[s] = (double) (now_ns() - t0) / (double) n;
+    }
+    qsort(samples, BENCH_SAMPLES, sizeof(samples[0]), compare_double);
+    return (bench_result_t) { c->name, samples[BENCH_SAMPLES / 2], samples[0], c->bytes_per_op, n };
+}
+
+// Conferência
+// ===========
+
+static bool lit(uint8_t x, uint8_t y)
+{
+    return ssd.ram_buffer[(y >> 3) + x * ssd.pages + 1] & (1 << (y & 7));
+}
+
+/**
+ * @brief Confere a largura de `raster_thick_line` em linhas horizontais e verticais, inclusive as pares.
+ *
+ * @return `true` se todas as espessuras de 1 a 6 cobrirem exatamente essa quantidade de pixels.
+ */
+static bool check_thick_line_width(void)
+{
+    bool ok = true;
+    for (uint8_t t = 1; t <= 6; t++)
+    {
+        memset(ssd.ram_buffer + 1, 0, ssd.bufsize - 1);
+        raster_thick_line(&ssd, 16, 32, 112, 32, t, true);
+        raster_thick_line(&ssd, 64, 8, 64, 56, t, true);
+        uint8_t across_h = 0, across_v = 0;
+        for (uint8_t y = 16; y < 48; y++) across_h += lit(32, y);
+        for (uint8_t x = 40; x < 88; x++) across_v += lit(x, 16);
+        if (across_h != t || across_v != t)
+        {
+            fprintf(stderr, "raster_thick_line: espessura %u cobriu %u pixels na horizontal e %u na vertical\n", t, across_h,
+                    across_v);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Baseline
+// ========
+
+/**
+ * @brief Lê um registro gerado por `--json` (um caso por linha).
+ *
+ * @return Casos lidos, ou -1 se o arquivo não abrir.
+ */
+static int load_baseline(const char *path, bench_baseline_t *base, int max)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) { perror(path); return -1; }
+    char line[512];
+    int count = 0;
+    while (fgets(line, sizeof(line), f) && count < max)
+    {
+        char *name = strstr(line, "\"name\": \"");
+        char *ns = strstr(line, "\"min_ns_per_op\": ");
+        if (!name || !ns) continue;
+        name += 9;
+        char *end = strchr(name, '"');
+        if (!end || (size_t) (end - name) >= sizeof(base[count].name)) continue;
+        memcpy(base[count].name, name, (size_t) (end - name));
+        base[count].name[end - name] = '\0';
+        base[count].min_ns_per_op = strtod(ns + 17, NULL);
+        count++;
+    }
+    fclose(f);
+    return count;
+}
+
+static const bench_baseline_t *find_baseline(const bench_baseline_t *base, int count, const char *name)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (strcmp(base[i].name, name) == 0) return &base[i];
+    }
+    return NULL;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "uso: %s [--json] [--filter TEXTO] [--min-time MS] [--baseline ARQ.json] [--max-regression PCT]\n", name);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    bool json = false;
+    const char *filter = NULL, *baseline_path = NULL;
+    double min_time_ms = 20.0, max_regression = 0.0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) min_time_ms = strtod(argv[++i], NULL);
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) baseline_path = argv[++i];
+        else if (strcmp(argv[i], "--max-regression") == 0 && i + 1 < argc) max_regression = strtod(argv[++i], NULL);
+        else usage(argv[0]);
+    }
+    if (min_time_ms <= 0) usage(argv[0]);
+
+    bench_baseline_t base[BENCH_MAX_CASES];
+    int base_count = 0;
+    if (baseline_path && (base_count = load_baseline(baseline_path, base, BENCH_MAX_CASES)) < 0) return EXIT_FAILURE;
+
+    // Estado comum: framebuffer meio cheio, matriz com o dígito 8, entradas sorteadas
+    ssd1306_init(&ssd, WIDTH, HEIGHT, false, HAL_LINUX_OLED_ADDRESS, HAL_I2C1);
+    if (!check_thick_line_width()) return EXIT_FAILURE;
+    oledgfx_random_fill_display(&ssd);
+    portrait = ssd;
+    ssd1306_set_orientation(&portrait, SSD1306_ROTATE_90);
+    oledgfx_draw_asset(&ssd, &OLED_ASSET_SPLASH, 0, 0);
+    memcpy(gray_planes[0], ssd.ram_buffer, ssd.bufsize);
+    ssd1306_rect(&ssd, 0, 0, WIDTH, HEIGHT, false, false);
+    ssd1306_rect(&ssd, 1, 1, WIDTH - 2, HEIGHT - 2, false, false);
+    memcpy(gray_planes[1], ssd.ram_buffer, ssd.bufsize);
+    memcpy(gray_shown, gray_planes[0], ssd.bufsize);
+    oledgfx_random_fill_display(&ssd);
+    ws = init_ws2812b(HAL_PIO0, 7);
+    memcpy(glyph, NUMERIC_GLYPHS[8], sizeof(glyph));
+    uint32_t lcg = 12345;
+    for (int i = 0; i < BENCH_TABLE_LEN; i++)
+    {
+        lcg = lcg * 1664525u + 1013904223u;
+        coords[i][0] = (uint8_t) ((lcg >> 8) % WIDTH);
+        coords[i][1] = (uint8_t) ((lcg >> 20) % HEIGHT);
+    }
+
+    // Stdout fica para o JSON; a tabela e as comparações vão para stderr nesse modo
+    FILE *table = json ? stderr : stdout;
+    bool regressed = false, first = true;
+    if (json) printf("{\n  \"suite\": \"eraseit-drivers\",\n  \"version\": %d,\n  \"benchmarks\": [\n", BENCH_JSON_VERSION);
+    fprintf(table, "%-28s %12s %14s %10s %10s%s\n", "caso", "ns/op", "mín ns/op", "bytes/op", "MB/s",
+            base_count ? "   base mín    delta" : "");
+
+    for (size_t i = 0; i < count_of(cases); i++)
+    {
+        if (filter && !strstr(cases[i].name, filter)) continue;
+        bench_result_t r = measure(&cases[i], min_time_ms);
+        double mb_per_s = r.bytes_per_op * 1e3 / r.ns_per_op;
+
+        // Larguras compensam os bytes extras dos acentos em UTF-8
+        fprintf(table, "%-28s %12.2f %13.2f %10.0f %10.1f", r.name, r.ns_per_op, r.min_ns_per_op, r.bytes_per_op, mb_per_s);
+        const bench_baseline_t *b = base_count ? find_baseline(base, base_count, r.name) : NULL;
+        if (b && b->min_ns_per_op > 0)
+        {
+            double delta = (r.min_ns_per_op / b->min_ns_per_op - 1.0) * 100.0;
+            bool slower = max_regression > 0 && delta > max_regression;
+            regressed |= slower;
+            fprintf(table, " %10.2f %+7.1f%%%s", b->min_ns_per_op, delta, slower ? "  REGRESSÃO" : "");
+        }
+        else if (base_count) fprintf(table, " %10s", "-");
+        fputc('\n', table);
+
+        if (json)
+        {
+            printf("%s    {\"name\": \"%s\", \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f, \"bytes_per_op\": %.0f, "
+                   "\"mb_per_s\": %.1f, \"iterations\": %llu}",
+                   first ? "" : ",\n", r.name, r.ns_per_op, r.min_ns_per_op, r.bytes_per_op, mb_per_s,
+                   (unsigned long long) r.iterations);
+            first = false;
+        }
+    }
+    if (json) printf("\n  ]\n}\n");
+    return regressed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file eraseit_host.c
+ * @brief Conduz o jogo compilado para o host (HAL Linux) por várias partidas.
+ *
+ * O joystick virtual faz um passeio aleatório (semente fixa, portanto sempre
+ * o mesmo), o botão A inicia cada partida e, ao fim dela, o comando 'r' da
+ * serial a reproduz; a reprodução precisa terminar com o mesmo framebuffer e
+ * a mesma pontuação ("Replay matches"). Como o tempo é simulado, cada partida
+ * de 9 s leva poucos milissegundos de CPU.
+ *
+ * Compilação e uso (sem PICO_SDK_PATH, o CMake gera o alvo do host):
+ *     cmake -S . -B build-host && cmake --build build-host
+ *     ./build-host/EraseIt_host --rounds 100 --seed 7 --quiet
+ *
+ * Com `--flash arquivo`, a flash virtual (recordes e calibração) é mantida no
+ * arquivo entre execuções. Com `--telemetry arquivo`, os registros binários de
+ * telemetria são gravados para `tools/telemetry_decode.c`; `--tx-rate N` define
+ * quantos bytes por milissegundo o computador virtual lê (0 simula um terminal
+ * que não lê, e a telemetria descarta registros em vez de atrasar o jogo).
+ *
+ * Ao fim, um resumo vai para stderr; o código de saída é diferente de zero se
+ * alguma reprodução divergir.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../lib/hal_linux.h"
+
+/** @brief Cópia dos pinos e canais usados por EraseIt.c. */
+#define BUTTON_A 5
+#define ADC_CHANNEL_VRY 0
+#define ADC_CHANNEL_VRX 1
+
+#define PRESS_MS 80          ///< Duração de um toque no botão
+#define ACTION_DELAY_MS 100  ///< Espera entre o fim de uma etapa e a próxima ação
+#define STICK_PERIOD_MS 20   ///< Período do passeio do joystick
+#define STICK_MAX_STEP 160   ///< Maior passo do joystick por período (de 4095)
+
+int eraseit_main(void);
+
+static unsigned rounds_wanted = 100;
+static unsigned rounds_done;
+static unsigned mismatches;
+static uint32_t rng_state;
+static struct timespec wall_start;
+static FILE *telemetry_file;
+
+/** @brief Posição e alvo de um eixo do joystick. */
+typedef struct
+{
+    uint8_t channel;
+    int32_t pos;
+    int32_t target;
+    int32_t step;
+} stick_axis_t;
+
+static stick_axis_t axes[2] = { { ADC_CHANNEL_VRX, 2048, 2048, 0 }, { ADC_CHANNEL_VRY, 2048, 2048, 0 } };
+
+static uint32_t rng_next(void)
+{
+    // xorshift32: independente da libc, o mesmo passeio em qualquer host
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int64_t stick_walk(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    (void) user_data;
+    for (int i = 0; i < 2; i++)
+    {
+        stick_axis_t *a = &axes[i];
+        if (a->pos == a->target)
+        {
+            a->target = (int32_t) (rng_next() % 4096);
+            a->step = 1 + (int32_t) (rng_next() % STICK_MAX_STEP);
+        }
+        int32_t delta = a->target - a->pos;
+        if (delta > a->step) delta = a->step;
+        if (delta < -a->step) delta = -a->step;
+        a->pos += delta;
+        hal_linux_adc_set(a->channel, (uint16_t) a->pos);
+    }
+    return -(int64_t) STICK_PERIOD_MS * 1000;
+}
+
+static int64_t release_button(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    hal_linux_gpio_set((uint) (uintptr_t) user_data, true);
+    return 0;
+}
+
+static int64_t press_button(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    hal_linux_gpio_set((uint) (uintptr_t) user_data, false);
+    hal_alarm_in_us(PRESS_MS * 1000u, release_button, user_data, true);
+    return 0;
+}
+
+static int64_t type_replay(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    (void) user_data;
+    hal_linux_serial_feed('r');
+    return 0;
+}
+
+static void write_telemetry(const uint8_t *data, size_t length) { fwrite(data, 1, length, telemetry_file); }
+
+static int64_t finish(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    (void) user_data;
+    struct timespec wall_end;
+    hal_linux_stats_t stats;
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    hal_linux_get_stats(&stats);
+    hal_flush();
+    if (telemetry_file) fclose(telemetry_file);
+
+    double wall_s = (double) (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+    double sim_s = hal_time_us() / 1e6;
+    fprintf(stderr, "%u partidas gravadas e reproduzidas, %u divergências\n", rounds_done, mismatches);
+    fprintf(stderr, "tempo simulado %.1f s, tempo real %.3f s (%.1f partidas/s, %.0fx o tempo real)\n",
+            sim_s, wall_s, 2.0 * rounds_done / wall_s, sim_s / wall_s);
+    fprintf(stderr, "%llu eventos, %llu bytes de I2C, %llu quadros no display, %llu blocos de áudio\n",
+            (unsigned long long) stats.events, (unsigned long long) stats.i2c_bytes,
+            (unsigned long long) stats.oled_flushes, (unsigned long long) stats.pcm_blocks);
+    fprintf(stderr, "flash: %llu setores apagados, %llu bytes gravados; %llu bytes de telemetria\n",
+            (unsigned long long) stats.flash_erases, (unsigned long long) stats.flash_programmed_bytes,
+            (unsigned long long) stats.serial_tx_bytes);
+    exit(mismatches ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/**
+ * @brief Acompanha a serial do jogo e agenda a próxima ação.
+ *
+ * As ações são alarmes: nada é feito de dentro da escrita na serial.
+ */
+static void on_line(const char *line)
+{
+    if (strncmp(line, "Round recorded", 14) == 0)
+    {
+        hal_alarm_in_us(ACTION_DELAY_MS * 1000u, type_replay, NULL, true);
+    }
+    else if (strncmp(line, "Replay ", 7) == 0)
+    {
+        if (strncmp(line + 7, "matches", 7) != 0)
+        {
+            mismatches++;
+            fprintf(stderr, "partida %u: %s\n", rounds_done + 1, line);
+        }
+        if (++rounds_done >= rounds_wanted) hal_alarm_in_us(1, finish, NULL, true);
+        else hal_alarm_in_us(ACTION_DELAY_MS * 1000u, press_button, (void *) (uintptr_t) BUTTON_A, true);
+    }
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "uso: %s [--rounds N] [--seed S] [--flash ARQUIVO] [--telemetry ARQUIVO] [--tx-rate N] [--quiet]\n", name);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long seed = 1;
+    unsigned long tx_rate = 64;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc) rounds_wanted = (unsigned) strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) seed = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--flash") == 0 && i + 1 < argc)
+        {
+            if (!hal_linux_flash_attach(argv[++i]))
+            {
+                fprintf(stderr, "não foi possível mapear %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--telemetry") == 0 && i + 1 < argc)
+        {
+            telemetry_file = fopen(argv[++i], "wb");
+            if (!telemetry_file)
+            {
+                perror(argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        else if (strcmp(argv[i], "--tx-rate") == 0 && i + 1 < argc) tx_rate = strtoul(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "--quiet") == 0) quiet = true;
+        else usage(argv[0]);
+    }
+    if (rounds_wanted == 0) usage(argv[0]);
+    rng_state = (uint32_t) seed ? (uint32_t) seed : 1u;
+
+    hal_linux_serial_set_hook(on_line, !quiet);
+    hal_linux_serial_set_tx_sink(telemetry_file ? write_telemetry : NULL, (uint32_t) tx_rate);
+    hal_alarm_in_us(STICK_PERIOD_MS * 1000u, stick_walk, NULL, true);
+    hal_alarm_in_us(ACTION_DELAY_MS * 1000u, press_button, (void *) (uintptr_t) BUTTON_A, true);
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    return eraseit_main(); // Só retorna se o jogo sair do laço principal
+}
@@ -0,0 +1,91 @@
+#include "clockmgr.h"
+
+/**
+ * @file clockmgr.c
+ * @brief Tabela de funções registradas e sequência da troca de relógio.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+static struct
+{
+    clockmgr_callback_t callback;
+    void *user;
+} clockmgr_clients[CLOCKMGR_MAX_CLIENTS];
+
+static volatile uint8_t clockmgr_client_count = 0;
+static hal_spin_lock_t *clockmgr_lock = NULL; // Registros dos dois núcleos
+static uint32_t clockmgr_khz = 0;
+static clockmgr_stats_t clockmgr_stats;
+
+void clockmgr_init(uint32_t khz)
+{
+    hal_set_sys_clock_khz(khz, true);
+    clockmgr_khz = khz;
+    clockmgr_lock = hal_spin_lock_claim();
+}
+
+bool clockmgr_register(clockmgr_callback_t callback, void *user)
+{
+    if (!clockmgr_lock) return false;
+
+    bool added = false;
+    uint32_t save = hal_spin_lock(clockmgr_lock);
+    uint8_t count = clockmgr_client_count;
+    if (count < CLOCKMGR_MAX_CLIENTS)
+    {
+        clockmgr_clients[count].callback = callback;
+        clockmgr_clients[count].user = user;
+        hal_dmb(); // Entrada completa antes de ser contada
+        clockmgr_client_count = (uint8_t) (count + 1);
+        added = true;
+    }
+    hal_spin_unlock(clockmgr_lock, save);
+    return added;
+}
+
+bool clockmgr_set_khz(uint32_t khz)
+{
+    if (khz == clockmgr_khz) return true;
+    if (!hal_sys_clock_khz_valid(khz)) return false;
+
+    uint32_t start_us = hal_time_us32();
+    uint8_t count = clockmgr_client_count;
+    uint32_t sys_hz = khz * 1000u;
+
+    for (uint8_t i = count; i-- > 0;) clockmgr_clients[i].callback(CLOCKMGR_PRE_CHANGE, sys_hz, clockmgr_clients[i].user);
+
+    // Nenhuma interrupção roda entre a troca e o último divisor refeito
+    uint32_t status = hal_irq_save();
+    hal_set_sys_clock_khz(khz, true);
+    for (uint8_t i = 0; i < count; i++) clockmgr_clients[i].callback(CLOCKMGR_POST_CHANGE, sys_hz, clockmgr_clients[i].user);
+    hal_irq_restore(status);
+
+    clockmgr_khz = khz;
+    clockmgr_stats.switches++;
+    clockmgr_stats.last_switch_us = hal_time_us32() - start_us;
+    if (clockmgr_stats.last_switch_us > clockmgr_stats.max_switch_us) clockmgr_stats.max_switch_us = clockmgr_stats.last_switch_us;
+    return true;
+}
+
+void clockmgr_dormant_until_gpio(uint32_t gpio_mask)
+{
+    uint8_t count = clockmgr_client_count;
+    uint32_t sys_hz = clockmgr_khz * 1000u;
+
+    for (uint8_t i = count; i-- > 0;) clockmgr_clients[i].callback(CLOCKMGR_PRE_CHANGE, sys_hz, clockmgr_clients[i].user);
+
+    // A HAL volta à frequência atual; nenhuma interrupção roda antes de os divisores serem refeitos
+    uint32_t status = hal_irq_save();
+    hal_dormant_until_gpio(gpio_mask, clockmgr_khz);
+    for (uint8_t i = 0; i < count; i++) clockmgr_clients[i].callback(CLOCKMGR_POST_CHANGE, sys_hz, clockmgr_clients[i].user);
+    hal_irq_restore(status);
+}
+
+uint32_t clockmgr_get_khz(void) { return clockmgr_khz; }
+
+void clockmgr_get_stats(clockmgr_stats_t *stats) { *stats = clockmgr_stats; }
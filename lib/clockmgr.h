@@ -0,0 +1,136 @@
+#ifndef CLOCKMGR_H
+#define CLOCKMGR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+
+/**
+ * @file clockmgr.h
+ * @brief Troca do relógio do sistema com os drivers avisados antes e depois.
+ *
+ * Os divisores de I2C, PWM, PIO e do timer do DMA são calculados a partir do
+ * clk_sys. Cada driver que depende dele registra uma função que é chamada
+ * duas vezes a cada troca:
+ *  - `CLOCKMGR_PRE_CHANGE`, com as interrupções habilitadas e na ordem
+ *    inversa do registro: quem usa um driver (registrado depois dele) para
+ *    antes; o driver termina o que está em curso (por exemplo, esvazia o FIFO
+ *    da matriz de LEDs);
+ *  - `CLOCKMGR_POST_CHANGE`, já no novo relógio, com as interrupções
+ *    mascaradas e na ordem do registro: os drivers refazem os divisores antes
+ *    que qualquer interrupção ou quem os usa volte a rodar. Deve ser curta
+ *    (só escrita de registradores).
+ *
+ * O jogo usa um relógio baixo no menu e o relógio cheio na partida.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Clock_Manager Gerenciador de Relógio
+ * @brief Frequência do sistema por estado do jogo, com os divisores refeitos pelos drivers.
+ * @{
+ */
+
+/**
+ * @def CLOCKMGR_MAX_CLIENTS
+ * @brief Funções que podem ser registradas.
+ */
+#define CLOCKMGR_MAX_CLIENTS 8
+
+/**
+ * @brief Momento da troca em que a função registrada é chamada.
+ */
+typedef enum
+{
+    CLOCKMGR_PRE_CHANGE,  /**< Ainda no relógio antigo: termina o trabalho em curso. */
+    CLOCKMGR_POST_CHANGE  /**< Já no relógio novo: refaz os divisores. */
+} clockmgr_event_t;
+
+/**
+ * @brief Função avisada das trocas de relógio.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio do sistema, em Hz.
+ * @param user Ponteiro passado a `clockmgr_register`.
+ */
+typedef void (*clockmgr_callback_t)(clockmgr_event_t event, uint32_t sys_hz, void *user);
+
+/**
+ * @brief Contadores do gerenciador.
+ */
+typedef struct
+{
+    uint32_t switches;       /**< Trocas feitas. */
+    uint32_t last_switch_us; /**< Duração da última troca, com as funções registradas. */
+    uint32_t max_switch_us;  /**< Maior duração de uma troca. */
+} clockmgr_stats_t;
+
+/**
+ * @brief Ajusta o relógio inicial, sem avisar ninguém, e habilita os registros.
+ *
+ * Deve ser a primeira chamada do programa, antes de iniciar os drivers.
+ *
+ * @param khz Frequência em kHz; o programa para se ela não for possível.
+ */
+void clockmgr_init(uint32_t khz);
+
+/**
+ * @brief Registra uma função para as trocas de relógio.
+ *
+ * Pode ser chamada nos dois núcleos (o áudio se registra no núcleo 1). Sem
+ * `clockmgr_init` (programas que nunca trocam o relógio), nada é registrado.
+ *
+ * @param callback Função.
+ * @param user Ponteiro repassado à função.
+ * @return `false` se a tabela estiver cheia ou o gerenciador não foi iniciado.
+ */
+bool clockmgr_register(clockmgr_callback_t callback, void *user);
+
+/**
+ * @brief Troca o relógio do sistema, avisando as funções registradas.
+ *
+ * Só no núcleo 0, fora de interrupções. Não faz nada se a frequência já for
+ * a atual.
+ *
+ * @param khz Frequência em kHz.
+ * @return `false` se o PLL não gera essa frequência (o relógio não muda).
+ */
+bool clockmgr_set_khz(uint32_t khz);
+
+/**
+ * @brief Coloca o sistema em dormant até uma borda de descida em um dos GPIOs, avisando as funções registradas.
+ *
+ * O dormant é tratado como uma troca de relógio: as funções registradas são
+ * avisadas antes (o núcleo 1 termina o que foi publicado e para, a matriz
+ * esvazia o FIFO) e, depois que a HAL restaura a árvore de relógios e a
+ * frequência atual, refazem seus divisores com as interrupções mascaradas.
+ * Só no núcleo 0, fora de interrupções.
+ *
+ * @param gpio_mask Máscara dos GPIOs que acordam o sistema.
+ */
+void clockmgr_dormant_until_gpio(uint32_t gpio_mask);
+
+/**
+ * @brief Frequência atual, em kHz.
+ *
+ * @return Última frequência ajustada pelo gerenciador.
+ */
+uint32_t clockmgr_get_khz(void);
+
+/**
+ * @brief Lê os contadores do gerenciador.
+ *
+ * @param[out] stats Destino.
+ */
+void clockmgr_get_stats(clockmgr_stats_t *stats);
+
+/** @} */ // Fim do grupo "Clock_Manager"
+
+#endif // CLOCKMGR_H
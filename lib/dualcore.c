@@ -0,0 +1,506 @@
+#include <string.h>
+#include "dualcore.h"
+#include "clockmgr.h"
+#include "workqueue.h"
+
+/**
+ * @file dualcore.c
+ * @brief Buffer triplo de quadros, fila de comandos e laço do núcleo 1.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @brief Comandos aceitos pelo núcleo 1.
+ */
+typedef enum
+{
+    DUALCORE_CMD_MATRIX_DRAW, /**< Desenha um glifo na matriz */
+    DUALCORE_CMD_MATRIX_OFF,  /**< Apaga a matriz */
+    DUALCORE_CMD_SOUND_PLAY,  /**< Toca uma amostra PCM */
+    DUALCORE_CMD_SOUND_STOP   /**< Interrompe o áudio PCM */
+} dualcore_cmd_type_t;
+
+/**
+ * @brief Comando na fila do núcleo 1.
+ */
+typedef struct
+{
+    uint8_t type;     /**< `dualcore_cmd_type_t` */
+    uint8_t arg8;     /**< Cor (matriz) */
+    uint16_t arg16;   /**< Intensidade (matriz) ou volume (áudio) */
+    const void *ptr;  /**< Glifo ou amostra */
+} dualcore_cmd_t;
+
+// Buffer triplo: "back" é do núcleo 0, "front" do núcleo 1, "ready" é trocado entre eles
+static uint8_t dualcore_frames[3][SSD1306_GRAY_MAX_BITS][DUALCORE_FRAME_MAX_BYTES];
+static uint8_t dualcore_frame_start_line[3];  // Rolagem de hardware de cada quadro
+static uint8_t dualcore_frame_bits[3];        // Planos de cada quadro (0 = monocromático, só o plano 0)
+static uint32_t dualcore_frame_slot_us[3];    // Duração do plano 0 de cada quadro em tons de cinza
+static uint8_t dualcore_back = 0, dualcore_ready = 1, dualcore_front = 2;
+static bool dualcore_fresh = false;
+static size_t dualcore_frame_bytes;
+
+static dualcore_cmd_t dualcore_queue[DUALCORE_CMD_QUEUE_LEN];
+static uint32_t dualcore_queue_head = 0, dualcore_queue_tail = 0;
+static uint32_t dualcore_dropped = 0;
+
+static hal_spin_lock_t *dualcore_lock;
+static volatile bool dualcore_pending = false;
+static volatile bool dualcore_park_request = false; // Núcleo 0 pede a pausa do núcleo 1 (troca de relógio)
+static volatile bool dualcore_parked = false;
+
+static ssd1306_t dualcore_display;  // Cópia do descritor do display, usada só pelo núcleo 1
+static ws2812b_t *dualcore_ws;
+static uint8_t dualcore_pcm_gpio;
+
+static uint32_t dualcore_busy_us[2];
+static uint32_t dualcore_window_start_us;
+
+// O que está na RAM do display, para enviar só as diferenças entre os planos
+static uint8_t dualcore_shown[DUALCORE_FRAME_MAX_BYTES];
+static bool dualcore_shown_valid = false;
+
+// Ciclo dos planos (núcleo 1) e medidas da janela atual (protegidas pelo spinlock)
+static bool dualcore_gray_active = false;
+static uint8_t dualcore_gray_plane;
+static uint32_t dualcore_gray_deadline_us;
+static uint32_t dualcore_gray_cycle_start_us;
+static uint32_t dualcore_gray_cycle_bytes;
+static bool dualcore_gray_cycle_started;
+static uint32_t dualcore_gray_sent_us;                             // Fim do envio do plano na tela
+static uint32_t dualcore_gray_cycle_on_us[SSD1306_GRAY_MAX_BITS];  // Tempo de cada plano inteiro na tela, no ciclo atual
+static uint32_t dualcore_gray_cycles, dualcore_gray_sum_us, dualcore_gray_max_us, dualcore_gray_bytes;
+static uint32_t dualcore_gray_on_sum_us[SSD1306_GRAY_MAX_BITS];
+
+/**
+ * @brief Acorda o núcleo 1 (o evento fica registrado mesmo que ele ainda não esteja em WFE).
+ */
+static void dualcore_notify(void)
+{
+    dualcore_pending = true;
+    hal_send_event();
+}
+
+/**
+ * @brief Coloca um comando na fila; seguro no laço principal e em interrupções do núcleo 0.
+ *
+ * @param cmd Comando a enfileirar.
+ */
+static void dualcore_push(const dualcore_cmd_t *cmd)
+{
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    if (dualcore_queue_head - dualcore_queue_tail < DUALCORE_CMD_QUEUE_LEN)
+    {
+        dualcore_queue[dualcore_queue_head & (DUALCORE_CMD_QUEUE_LEN - 1)] = *cmd;
+        dualcore_queue_head++;
+    }
+    else
+    {
+        dualcore_dropped++;
+    }
+    hal_spin_unlock(dualcore_lock, save);
+    dualcore_notify();
+}
+
+/**
+ * @brief Retira um comando da fila (núcleo 1).
+ *
+ * @param cmd Comando retirado.
+ * @return `false` se a fila está vazia.
+ */
+static bool dualcore_pop(dualcore_cmd_t *cmd)
+{
+    bool found = false;
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    if (dualcore_queue_tail != dualcore_queue_head)
+    {
+        *cmd = dualcore_queue[dualcore_queue_tail & (DUALCORE_CMD_QUEUE_LEN - 1)];
+        dualcore_queue_tail++;
+        found = true;
+    }
+    hal_spin_unlock(dualcore_lock, save);
+    return found;
+}
+
+/**
+ * @brief Executa um comando no núcleo 1.
+ *
+ * @param cmd Comando a executar.
+ */
+static void dualcore_execute(const dualcore_cmd_t *cmd)
+{
+    switch (cmd->type)
+    {
+    case DUALCORE_CMD_MATRIX_DRAW:
+        ws2812b_draw(dualcore_ws, (const uint8_t *) cmd->ptr, cmd->arg8, (uint8_t) cmd->arg16);
+        break;
+    case DUALCORE_CMD_MATRIX_OFF:
+        ws2812b_turn_off_all(dualcore_ws);
+        break;
+    case DUALCORE_CMD_SOUND_PLAY:
+        pcm_audio_play((const pcm_sample_t *) cmd->ptr, cmd->arg16);
+        break;
+    case DUALCORE_CMD_SOUND_STOP:
+        pcm_audio_stop_all();
+        break;
+    }
+}
+
+/**
+ * @brief Troca de relógio: segura o núcleo 1 entre dois comandos enquanto os divisores mudam.
+ *
+ * Antes da troca, o núcleo 0 espera o núcleo 1 executar os comandos e enviar
+ * o quadro já publicados; o I2C e a matriz ficam parados até depois da troca.
+ * A interrupção do áudio continua sendo atendida (para o dormant, quem chama
+ * interrompe o áudio antes).
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio (não usado).
+ * @param user Não utilizado.
+ */
+static void dualcore_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    (void) sys_hz;
+    (void) user;
+    if (event == CLOCKMGR_PRE_CHANGE)
+    {
+        dualcore_park_request = true;
+        dualcore_notify();
+        while (!dualcore_parked) hal_wait_for_event();
+    }
+    else
+    {
+        dualcore_park_request = false;
+        hal_send_event();
+    }
+}
+
+/**
+ * @brief Fim da exibição de um plano: acorda o núcleo 1 para o próximo.
+ */
+static int64_t dualcore_gray_alarm(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    (void) user_data;
+    uint32_t isr_start = work_isr_begin();
+    dualcore_notify();
+    work_isr_end(isr_start);
+    return 0;
+}
+
+/**
+ * @brief Mostra o próximo plano do quadro em tons de cinza e agenda o seguinte (núcleo 1).
+ *
+ * O plano k fica na tela por 2^k vezes a duração do plano 0, contada a partir
+ * do fim do seu envio: um envio de ~330 bytes leva ~7,4 ms a 400 kHz, mais
+ * que o plano 0 da abertura, e contá-lo desfaria os pesos 1:2. O tempo que
+ * cada plano ficou inteiro na tela (do fim do seu envio ao início do
+ * seguinte) e cada volta ao plano 0, que fecha um ciclo, vão para as medidas.
+ */
+static void dualcore_gray_step(void)
+{
+    uint8_t bits = dualcore_frame_bits[dualcore_front];
+    uint32_t now = hal_time_us32();
+
+    if (dualcore_gray_plane < bits) dualcore_gray_cycle_on_us[dualcore_gray_plane] = now - dualcore_gray_sent_us;
+    dualcore_gray_plane = (dualcore_gray_plane + 1 >= bits) ? 0 : dualcore_gray_plane + 1;
+    if (dualcore_gray_plane == 0)
+    {
+        if (dualcore_gray_cycle_started)
+        {
+            uint32_t cycle_us = now - dualcore_gray_cycle_start_us;
+            uint32_t save = hal_spin_lock(dualcore_lock);
+            dualcore_gray_cycles++;
+            dualcore_gray_sum_us += cycle_us;
+            if (cycle_us > dualcore_gray_max_us) dualcore_gray_max_us = cycle_us;
+            dualcore_gray_bytes += dualcore_gray_cycle_bytes;
+            for (uint8_t k = 0; k < bits; k++) dualcore_gray_on_sum_us[k] += dualcore_gray_cycle_on_us[k];
+            hal_spin_unlock(dualcore_lock, save);
+        }
+        dualcore_gray_cycle_started = true;
+        dualcore_gray_cycle_start_us = now;
+        dualcore_gray_cycle_bytes = 0;
+    }
+
+    uint8_t *plane = dualcore_frames[dualcore_front][dualcore_gray_plane];
+    if (dualcore_shown_valid)
+    {
+        dualcore_gray_cycle_bytes += ssd1306_send_delta(&dualcore_display, dualcore_shown, plane);
+    }
+    else
+    {
+        dualcore_display.ram_buffer = plane;
+        ssd1306_send_data(&dualcore_display);
+        memcpy(dualcore_shown, plane, dualcore_frame_bytes);
+        dualcore_shown_valid = true;
+        dualcore_gray_cycle_bytes += dualcore_frame_bytes + SSD1306_DELTA_WINDOW_COST;
+    }
+
+    dualcore_gray_sent_us = hal_time_us32();
+    uint32_t on_us = dualcore_frame_slot_us[dualcore_front] << dualcore_gray_plane;
+    dualcore_gray_deadline_us = dualcore_gray_sent_us + on_us;
+    // Sem alarme livre: o próximo plano vai na volta seguinte do laço
+    if (hal_alarm_in_us(on_us, dualcore_gray_alarm, NULL, true) < 0) dualcore_pending = true;
+}
+
+/**
+ * @brief Laço do núcleo 1: executa os comandos e envia o quadro mais recente.
+ */
+static void dualcore_core1_entry(void)
+{
+    dualcore_cmd_t cmd;
+
+    pcm_audio_init(dualcore_pcm_gpio); // A interrupção do DMA de áudio passa a ser do núcleo 1
+    // Registrado depois do display, da matriz e do áudio: é o primeiro a parar e o último a voltar
+    clockmgr_register(dualcore_clock_changed, NULL);
+
+    while (true)
+    {
+        while (!dualcore_pending) hal_wait_for_event();
+        dualcore_pending = false; // Notificações posteriores repetem a volta
+
+        uint32_t start_us = hal_time_us32();
+
+        while (dualcore_pop(&cmd)) dualcore_execute(&cmd);
+
+        bool have_frame = false;
+        uint32_t save = hal_spin_lock(dualcore_lock);
+        if (dualcore_fresh)
+        {
+            uint8_t tmp = dualcore_front;
+            dualcore_front = dualcore_ready;
+            dualcore_ready = tmp;
+            dualcore_fresh = false;
+            have_frame = true;
+        }
+        hal_spin_unlock(dualcore_lock, save);
+
+        if (have_frame)
+        {
+            dualcore_display.start_line = dualcore_frame_start_line[dualcore_front];
+            if (dualcore_frame_bits[dualcore_front] == 0)
+            {
+                dualcore_display.ram_buffer = dualcore_frames[dualcore_front][0];
+                ssd1306_send_data(&dualcore_display); // Bloqueia só o núcleo 1
+                // Transposto, o painel recebeu outra ordem de bytes: as diferenças não valem
+                memcpy(dualcore_shown, dualcore_display.ram_buffer, dualcore_frame_bytes);
+                dualcore_shown_valid = !(dualcore_display.orientation & SSD1306_TRANSPOSE);
+                dualcore_gray_active = false;
+            }
+            else if (!dualcore_gray_active)
+            {
+                // O ciclo começa já; com ele em curso, um quadro novo entra na próxima troca de plano
+                dualcore_gray_active = true;
+                dualcore_gray_plane = UINT8_MAX;
+                dualcore_gray_cycle_started = false;
+                dualcore_gray_deadline_us = hal_time_us32();
+            }
+        }
+        if (dualcore_gray_active && (int32_t) (hal_time_us32() - dualcore_gray_deadline_us) >= 0) dualcore_gray_step();
+
+        dualcore_account_busy(hal_time_us32() - start_us);
+
+        // Para só depois dos comandos e do quadro pendentes: quem pediu a pausa (troca de relógio ou
+        // dormant) encontra a tela e o áudio no estado que publicou
+        if (dualcore_park_request)
+        {
+            dualcore_parked = true;
+            hal_send_event();
+            while (dualcore_park_request) hal_wait_for_event();
+            dualcore_parked = false;
+        }
+    }
+}
+
+/**
+ * @brief Inicia o núcleo 1 com o display, a matriz e o áudio que ele passa a controlar.
+ *
+ * @param ssd Display já inicializado e orientado (`ssd1306_set_orientation` depois daqui não chega ao núcleo 1).
+ * @param ws Matriz de LEDs já inicializada.
+ * @param pcm_gpio Pino do buzzer de áudio PCM.
+ */
+void dualcore_init(const ssd1306_t *ssd, ws2812b_t *ws, uint8_t pcm_gpio)
+{
+    dualcore_lock = hal_spin_lock_claim();
+    dualcore_display = *ssd;
+    // O quadro transposto é montado no envio, pelo núcleo 1: ele precisa de um buffer próprio
+    if (ssd->panel_buffer)
+    {
+        dualcore_display.panel_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+        dualcore_display.panel_buffer[0] = 0x40;
+    }
+    dualcore_frame_bytes = (ssd->bufsize < DUALCORE_FRAME_MAX_BYTES) ? ssd->bufsize : DUALCORE_FRAME_MAX_BYTES;
+    dualcore_ws = ws;
+    dualcore_pcm_gpio = pcm_gpio;
+    dualcore_window_start_us = hal_time_us32();
+    hal_core1_launch(dualcore_core1_entry);
+}
+
+/**
+ * @brief Troca o buffer de escrita, já preenchido, pelo "pronto" e acorda o núcleo 1.
+ */
+static void dualcore_publish(void)
+{
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    uint8_t tmp = dualcore_back;
+    dualcore_back = dualcore_ready;
+    dualcore_ready = tmp;
+    dualcore_fresh = true;
+    hal_spin_unlock(dualcore_lock, save);
+    dualcore_notify();
+}
+
+/**
+ * @brief Publica o framebuffer atual do display para envio pelo núcleo 1.
+ *
+ * @param ssd Display cujo `ram_buffer` será copiado.
+ */
+void dualcore_submit_frame(const ssd1306_t *ssd)
+{
+    // A cópia é feita fora do spinlock: o buffer de escrita é exclusivo do núcleo 0
+    memcpy(dualcore_frames[dualcore_back][0], ssd->ram_buffer, dualcore_frame_bytes);
+    dualcore_frame_start_line[dualcore_back] = ssd->start_line;
+    dualcore_frame_bits[dualcore_back] = 0;
+
+    dualcore_publish();
+}
+
+/**
+ * @brief Publica os planos do modo em tons de cinza; o núcleo 1 passa a alterná-los.
+ *
+ * @param ssd Display com o modo ligado (`ssd1306_gray_init`).
+ * @param slot_us Duração do plano 0.
+ */
+void dualcore_submit_gray(const ssd1306_t *ssd, uint32_t slot_us)
+{
+    for (uint8_t k = 0; k < ssd->gray_bits; k++)
+        memcpy(dualcore_frames[dualcore_back][k], ssd1306_gray_plane(ssd, k), dualcore_frame_bytes);
+    dualcore_frame_start_line[dualcore_back] = 0;
+    dualcore_frame_bits[dualcore_back] = ssd->gray_bits;
+    dualcore_frame_slot_us[dualcore_back] = slot_us;
+
+    dualcore_publish();
+}
+
+/**
+ * @brief Pede ao núcleo 1 que desenhe um glifo na matriz de LEDs.
+ *
+ * @param glyph Glifo.
+ * @param color Cor do glifo.
+ * @param intensity Intensidade.
+ */
+void dualcore_matrix_draw(const uint8_t *glyph, uint8_t color, uint8_t intensity)
+{
+    dualcore_cmd_t cmd = { DUALCORE_CMD_MATRIX_DRAW, color, intensity, glyph };
+    dualcore_push(&cmd);
+}
+
+/**
+ * @brief Pede ao núcleo 1 que apague a matriz de LEDs.
+ */
+void dualcore_matrix_off(void)
+{
+    dualcore_cmd_t cmd = { DUALCORE_CMD_MATRIX_OFF, 0, 0, NULL };
+    dualcore_push(&cmd);
+}
+
+/**
+ * @brief Pede ao núcleo 1 que toque uma amostra PCM.
+ *
+ * @param sample Amostra.
+ * @param volume Volume em Q8.
+ */
+void dualcore_play_sound(const pcm_sample_t *sample, uint16_t volume)
+{
+    dualcore_cmd_t cmd = { DUALCORE_CMD_SOUND_PLAY, 0, volume, sample };
+    dualcore_push(&cmd);
+}
+
+/**
+ * @brief Pede ao núcleo 1 que interrompa o áudio PCM.
+ */
+void dualcore_stop_sound(void)
+{
+    dualcore_cmd_t cmd = { DUALCORE_CMD_SOUND_STOP, 0, 0, NULL };
+    dualcore_push(&cmd);
+}
+
+/**
+ * @brief Soma tempo ocupado ao núcleo que chama a função.
+ *
+ * @param busy_us Tempo ocupado em microssegundos.
+ */
+void dualcore_account_busy(uint32_t busy_us)
+{
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    dualcore_busy_us[hal_core_num()] += busy_us;
+    hal_spin_unlock(dualcore_lock, save);
+}
+
+/**
+ * @brief Fecha a janela de medição quando ela completa `DUALCORE_REPORT_PERIOD_US`.
+ *
+ * @param[out] permille Utilização de cada núcleo na janela, em milésimos.
+ * @return `true` se uma janela foi fechada.
+ */
+bool dualcore_poll_utilization(uint16_t permille[2])
+{
+    uint32_t now = hal_time_us32();
+    uint32_t window = now - dualcore_window_start_us;
+    if (window < DUALCORE_REPORT_PERIOD_US) return false;
+
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    for (uint8_t core = 0; core < 2; core++)
+    {
+        uint32_t busy = (dualcore_busy_us[core] > window) ? window : dualcore_busy_us[core];
+        permille[core] = (uint16_t) (((uint64_t) busy * 1000u) / window);
+        dualcore_busy_us[core] = 0;
+    }
+    hal_spin_unlock(dualcore_lock, save);
+
+    dualcore_window_start_us = now;
+    return true;
+}
+
+/**
+ * @brief Entrega e zera as medidas dos ciclos de planos desde a última chamada.
+ *
+ * @param[out] stats Medidas da janela.
+ * @return `false` se nenhum ciclo completo foi medido.
+ */
+bool dualcore_poll_gray_stats(dualcore_gray_stats_t *stats)
+{
+    uint32_t save = hal_spin_lock(dualcore_lock);
+    uint32_t cycles = dualcore_gray_cycles, sum_us = dualcore_gray_sum_us;
+    uint32_t max_us = dualcore_gray_max_us, bytes = dualcore_gray_bytes;
+    uint32_t on_sum_us[SSD1306_GRAY_MAX_BITS];
+    memcpy(on_sum_us, dualcore_gray_on_sum_us, sizeof on_sum_us);
+    dualcore_gray_cycles = dualcore_gray_sum_us = dualcore_gray_max_us = dualcore_gray_bytes = 0;
+    memset(dualcore_gray_on_sum_us, 0, sizeof dualcore_gray_on_sum_us);
+    hal_spin_unlock(dualcore_lock, save);
+
+    if (cycles == 0) return false;
+    for (uint8_t k = 0; k < SSD1306_GRAY_MAX_BITS; k++) stats->plane_on_us[k] = on_sum_us[k] / cycles;
+    stats->cycles = cycles;
+    stats->mean_cycle_us = sum_us / cycles;
+    stats->max_cycle_us = max_us;
+    stats->bytes_per_cycle = bytes / cycles;
+    stats->rate_hz = (uint16_t) (stats->mean_cycle_us ? 1000000u / stats->mean_cycle_us : 0);
+    stats->flicker_free = max_us <= 1000000u / DUALCORE_GRAY_FLICKER_FREE_HZ;
+    return true;
+}
+
+/**
+ * @brief Quantidade de comandos descartados por fila cheia.
+ *
+ * @return Contador de comandos descartados.
+ */
+uint32_t dualcore_dropped_commands(void)
+{
+    return dualcore_dropped;
+}
@@ -0,0 +1,184 @@
+#ifndef DUALCORE_H
+#define DUALCORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+#include "ssd1306.h"
+#include "ws2812b.h"
+#include "pcm_audio.h"
+
+/**
+ * @file dualcore.h
+ * @brief Divisão do jogo entre os dois núcleos do RP2040.
+ *
+ * O núcleo 0 produz: lê a entrada, atualiza o framebuffer do display e decide
+ * o que mostrar na matriz de LEDs e o que tocar. O núcleo 1 consome: envia os
+ * quadros ao SSD1306 pelo I2C, desenha na matriz WS2812B e atende a
+ * interrupção do áudio PCM. Nenhuma função deste módulo chamada no núcleo 0
+ * espera pelo barramento.
+ *
+ * Os quadros passam por um buffer triplo: o núcleo 0 copia o framebuffer para
+ * o buffer de escrita e troca seu índice com o do buffer "pronto"; o núcleo 1
+ * troca o "pronto" com o de leitura. As trocas de índice são protegidas por
+ * um spinlock de hardware, de modo que nenhum núcleo espera o outro terminar
+ * uma cópia ou um envio; quadros produzidos mais rápido do que o I2C consegue
+ * enviar são substituídos pelo mais recente. Os comandos da matriz e do áudio
+ * passam por uma fila curta, e o núcleo 1 dorme (WFE) enquanto não há trabalho.
+ *
+ * Um quadro em tons de cinza leva os planos de bits do display. Enquanto ele é
+ * o mais recente, o núcleo 1 mostra um plano de cada vez, o plano k por 2^k
+ * vezes a duração do plano 0 (um alarme o acorda para a troca), e envia em
+ * cada troca só os bytes que diferem do que já está na RAM do display. A
+ * duração real de cada ciclo de planos é medida: abaixo de
+ * `DUALCORE_GRAY_FLICKER_FREE_HZ` ciclos por segundo, a alternância aparece
+ * como cintilação.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Dual_Core Pipeline de Dois Núcleos
+ * @brief Quadros, matriz de LEDs e áudio no núcleo 1.
+ * @{
+ */
+
+/**
+ * @def DUALCORE_FRAME_MAX_BYTES
+ * @brief Tamanho máximo do framebuffer (128x64 em 1 bit por pixel, mais o byte de controle).
+ */
+#define DUALCORE_FRAME_MAX_BYTES (WIDTH * HEIGHT / 8 + 1)
+
+/**
+ * @def DUALCORE_CMD_QUEUE_LEN
+ * @brief Capacidade da fila de comandos para o núcleo 1 (potência de 2).
+ */
+#define DUALCORE_CMD_QUEUE_LEN 16
+
+/**
+ * @def DUALCORE_REPORT_PERIOD_US
+ * @brief Janela de medição da utilização dos núcleos.
+ */
+#define DUALCORE_REPORT_PERIOD_US 1000000u
+
+/**
+ * @def DUALCORE_GRAY_FLICKER_FREE_HZ
+ * @brief Menor taxa de ciclos de planos tida como livre de cintilação.
+ */
+#define DUALCORE_GRAY_FLICKER_FREE_HZ 60u
+
+/**
+ * @brief Medidas dos ciclos de planos em tons de cinza.
+ */
+typedef struct
+{
+    uint32_t cycles;          /**< Ciclos completos medidos */
+    uint32_t mean_cycle_us;   /**< Duração média de um ciclo */
+    uint32_t max_cycle_us;    /**< Pior ciclo */
+    uint32_t bytes_per_cycle; /**< Bytes de fio (dados e janelas) por ciclo, em média */
+    uint16_t rate_hz;         /**< Ciclos por segundo, pela média */
+    bool flicker_free;        /**< O pior ciclo coube em 1 / `DUALCORE_GRAY_FLICKER_FREE_HZ` */
+    uint32_t plane_on_us[SSD1306_GRAY_MAX_BITS]; /**< Tempo médio de cada plano inteiro na tela, do fim do seu envio ao início do seguinte (0 nos planos sem uso) */
+} dualcore_gray_stats_t;
+
+/**
+ * @brief Inicia o núcleo 1 com o display, a matriz e o áudio que ele passa a controlar.
+ *
+ * Deve ser chamada depois de inicializar o display e a matriz. A partir daqui,
+ * o núcleo 0 não deve mais chamar `ssd1306_send_data`, `ws2812b_*` nem
+ * `pcm_audio_*` diretamente.
+ *
+ * @param ssd Display já inicializado (o framebuffer continua sendo do núcleo 0).
+ * @param ws Matriz de LEDs já inicializada.
+ * @param pcm_gpio Pino do buzzer de áudio PCM, inicializado no núcleo 1.
+ */
+void dualcore_init(const ssd1306_t *ssd, ws2812b_t *ws, uint8_t pcm_gpio);
+
+/**
+ * @brief Publica o framebuffer atual do display para envio pelo núcleo 1 (não bloqueia).
+ *
+ * @param ssd Display cujo `ram_buffer` será copiado.
+ */
+void dualcore_submit_frame(const ssd1306_t *ssd);
+
+/**
+ * @brief Publica os planos do modo em tons de cinza (não bloqueia).
+ *
+ * O núcleo 1 alterna os planos até o próximo `dualcore_submit_frame`.
+ *
+ * @param ssd Display com o modo ligado (`ssd1306_gray_init`).
+ * @param slot_us Duração do plano 0, contada do fim do seu envio (o plano k fica 2^k vezes mais).
+ */
+void dualcore_submit_gray(const ssd1306_t *ssd, uint32_t slot_us);
+
+/**
+ * @brief Pede ao núcleo 1 que desenhe um glifo na matriz de LEDs.
+ *
+ * Pode ser chamada de interrupções do núcleo 0.
+ *
+ * @param glyph Glifo (deve permanecer válido; normalmente uma constante).
+ * @param color Cor do glifo.
+ * @param intensity Intensidade.
+ */
+void dualcore_matrix_draw(const uint8_t *glyph, uint8_t color, uint8_t intensity);
+
+/**
+ * @brief Pede ao núcleo 1 que apague a matriz de LEDs.
+ */
+void dualcore_matrix_off(void);
+
+/**
+ * @brief Pede ao núcleo 1 que toque uma amostra PCM. Pode ser chamada de interrupções.
+ *
+ * @param sample Amostra (deve permanecer válida).
+ * @param volume Volume em Q8.
+ */
+void dualcore_play_sound(const pcm_sample_t *sample, uint16_t volume);
+
+/**
+ * @brief Pede ao núcleo 1 que interrompa o áudio PCM.
+ */
+void dualcore_stop_sound(void);
+
+/**
+ * @brief Soma tempo ocupado ao núcleo que chama a função.
+ *
+ * O núcleo 1 contabiliza o próprio tempo; o laço do núcleo 0 informa o tempo
+ * gasto fora das esperas.
+ *
+ * @param busy_us Tempo ocupado em microssegundos.
+ */
+void dualcore_account_busy(uint32_t busy_us);
+
+/**
+ * @brief Fecha a janela de medição quando ela completa `DUALCORE_REPORT_PERIOD_US`.
+ *
+ * @param[out] permille Utilização de cada núcleo na janela, em milésimos.
+ * @return `true` se uma janela foi fechada e `permille` foi preenchido.
+ */
+bool dualcore_poll_utilization(uint16_t permille[2]);
+
+/**
+ * @brief Quantidade de comandos descartados por fila cheia.
+ *
+ * @return Contador de comandos descartados.
+ */
+uint32_t dualcore_dropped_commands(void);
+
+/**
+ * @brief Entrega e zera as medidas dos ciclos de planos desde a última chamada.
+ *
+ * @param[out] stats Medidas.
+ * @return `false` se nenhum ciclo completo foi medido.
+ */
+bool dualcore_poll_gray_stats(dualcore_gray_stats_t *stats);
+
+/** @} */ // Fim do grupo "Dual_Core"
+
+#endif // DUALCORE_H
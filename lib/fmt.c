@@ -0,0 +1,103 @@
+#include "fmt.h"
+
+/**
+ * @file fmt.c
+ * @brief Conversão de inteiros em texto por pares de dígitos.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/** @brief "00" a "99": dois dígitos por divisão. */
+static const char DIGIT_PAIRS[200] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+    "40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+    "80818283848586878889" "90919293949596979899";
+
+size_t fmt_u32(char *out, uint32_t value)
+{
+    char tmp[FMT_U32_MAX_CHARS];
+    char *p = tmp + sizeof tmp;
+    size_t n;
+
+    // Do fim para o começo, dois dígitos por vez
+    while (value >= 100)
+    {
+        uint32_t pair = (value % 100) * 2;
+        value /= 100;
+        *--p = DIGIT_PAIRS[pair + 1];
+        *--p = DIGIT_PAIRS[pair];
+    }
+    if (value >= 10)
+    {
+        *--p = DIGIT_PAIRS[value * 2 + 1];
+        *--p = DIGIT_PAIRS[value * 2];
+    }
+    else
+    {
+        *--p = (char) ('0' + value);
+    }
+
+    n = (size_t) (tmp + sizeof tmp - p);
+    for (size_t i = 0; i < n; i++) out[i] = p[i];
+    out[n] = '\0';
+    return n;
+}
+
+size_t fmt_i32(char *out, int32_t value)
+{
+    if (value >= 0) return fmt_u32(out, (uint32_t) value);
+    *out = '-';
+    return 1 + fmt_u32(out + 1, 0u - (uint32_t) value); // Também vale para INT32_MIN
+}
+
+size_t fmt_hex32(char *out, uint32_t value)
+{
+    size_t n = 1;
+    while (n < 8 && (value >> (4 * n))) n++;
+    for (size_t i = 0; i < n; i++) out[i] = "0123456789abcdef"[(value >> (4 * (n - 1 - i))) & 0xF];
+    out[n] = '\0';
+    return n;
+}
+
+size_t fmt_render(char *out, size_t capacity, const char *format, const uint32_t *args, uint8_t argc)
+{
+    char number[FMT_U32_MAX_CHARS + 1];
+    size_t len = 0;
+    uint8_t next = 0;
+
+    if (capacity == 0) return 0;
+    for (const char *f = format; *f; f++)
+    {
+        const char *text = f;
+        size_t text_len = 1;
+
+        if (*f == '%' && f[1])
+        {
+            char conv = *++f;
+            uint32_t arg = next < argc ? args[next] : 0;
+            switch (conv)
+            {
+            case 'u': text_len = fmt_u32(number, arg); text = number; next++; break;
+            case 'd': text_len = fmt_i32(number, (int32_t) arg); text = number; next++; break;
+            case 'x': text_len = fmt_hex32(number, arg); text = number; next++; break;
+            case 'c': number[0] = (char) arg; text = number; next++; break;
+            case '%': text = f; break;
+            default: text = f - 1; text_len = 2; break;
+            }
+            if (next > argc && conv != '%')
+            {
+                number[0] = '?';
+                text = number;
+                text_len = 1;
+            }
+        }
+
+        for (size_t i = 0; i < text_len && len + 1 < capacity; i++) out[len++] = text[i];
+    }
+    out[len] = '\0';
+    return len;
+}
@@ -0,0 +1,88 @@
+#ifndef FMT_H
+#define FMT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @file fmt.h
+ * @brief Formatação de inteiros sem a `printf` da newlib.
+ *
+ * Gera o texto dos números mostrados na tela e das mensagens de
+ * `lib/tlog` sem ponto flutuante, sem `va_list` e com pouca pilha: os
+ * dígitos saem de dois em dois de uma tabela, com uma divisão por 100 (que o
+ * compilador troca por multiplicação) a cada par.
+ *
+ * `fmt_render` aceita um subconjunto dos formatos da `printf`, com todos os
+ * argumentos como `uint32_t`:
+ *  - `%u` decimal sem sinal, `%d` decimal com sinal, `%x` hexadecimal;
+ *  - `%c` caractere, `%%` o próprio '%'.
+ * Largura, precisão e `l` não são aceitos; conversões desconhecidas são
+ * copiadas como estão.
+ *
+ * O módulo não depende do Pico SDK e é compilado também no host e nas
+ * ferramentas.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Fmt Formatação de Inteiros
+ * @brief Números em texto para a tela e para o registro de mensagens.
+ * @{
+ */
+
+/**
+ * @def FMT_U32_MAX_CHARS
+ * @brief Maior texto de um número de 32 bits (com sinal), sem o '\0'.
+ */
+#define FMT_U32_MAX_CHARS 11
+
+/**
+ * @brief Escreve um número decimal sem sinal.
+ *
+ * @param[out] out Destino, com espaço para `FMT_U32_MAX_CHARS + 1` bytes.
+ * @param value Número.
+ * @return Caracteres escritos, sem contar o '\0' final.
+ */
+size_t fmt_u32(char *out, uint32_t value);
+
+/**
+ * @brief Escreve um número decimal com sinal.
+ *
+ * @param[out] out Destino, com espaço para `FMT_U32_MAX_CHARS + 1` bytes.
+ * @param value Número.
+ * @return Caracteres escritos, sem contar o '\0' final.
+ */
+size_t fmt_i32(char *out, int32_t value);
+
+/**
+ * @brief Escreve um número em hexadecimal minúsculo, sem zeros à esquerda.
+ *
+ * @param[out] out Destino, com espaço para 9 bytes.
+ * @param value Número.
+ * @return Caracteres escritos, sem contar o '\0' final.
+ */
+size_t fmt_hex32(char *out, uint32_t value);
+
+/**
+ * @brief Monta um texto a partir de um formato e argumentos inteiros.
+ *
+ * @param[out] out Destino; sempre terminado em '\0' se `capacity` > 0.
+ * @param capacity Tamanho do destino.
+ * @param format Formato (veja a descrição do arquivo).
+ * @param args Argumentos, na ordem das conversões.
+ * @param argc Quantidade de argumentos; conversões além dela viram '?'.
+ * @return Caracteres escritos (truncado à capacidade), sem contar o '\0'.
+ */
+size_t fmt_render(char *out, size_t capacity, const char *format, const uint32_t *args, uint8_t argc);
+
+/** @} */ // Fim do grupo "Fmt"
+
+#endif // FMT_H
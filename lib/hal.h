@@ -0,0 +1,523 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file hal.h
+ * @brief Camada de abstração de hardware (HAL) usada pelo jogo e por `lib/`.
+ *
+ * Os módulos não chamam mais o Pico SDK diretamente: tempo, interrupções,
+ * GPIO, I2C, PWM, alarmes, núcleo 1 e serial passam por esta interface. Os
+ * mecanismos que combinam vários periféricos do RP2040 (ADC contínuo por DMA,
+ * áudio PWM por DMA em ping-pong, tick de PWM, matriz WS2812 por PIO e modo
+ * dormant) são expostos como serviços, e a configuração dos registradores fica
+ * na implementação.
+ *
+ * Há duas implementações:
+ *  - `hal_rp2040.c` (padrão): Pico SDK. As funções simples são `static inline`
+ *    neste arquivo e geram o mesmo código das chamadas diretas ao SDK;
+ *  - `hal_linux.c` (`HAL_LINUX` definido): executável nativo com tempo
+ *    simulado. O relógio só avança quando o jogo dorme (`hal_sleep_until_us`,
+ *    `hal_wait_for_interrupt`), e alarmes, ticks e blocos de áudio são eventos
+ *    de um escalonador; o núcleo 1 é uma corrotina acordada por
+ *    `hal_send_event`. O controle dos periféricos virtuais está em `hal_linux.h`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup HAL Abstração de Hardware
+ * @brief Interface comum às implementações RP2040 e Linux.
+ * @{
+ */
+
+/**
+ * @brief Resultado de `hal_getc_nonblocking` quando nada foi recebido.
+ */
+#define HAL_SERIAL_NONE (-1)
+
+#if defined(HAL_LINUX)
+
+#ifndef count_of
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#endif
+
+typedef unsigned int uint;
+
+/**
+ * @brief Barramento I2C virtual.
+ */
+typedef struct
+{
+    uint8_t index; /**< Número do barramento */
+} hal_i2c_t;
+
+extern hal_i2c_t hal_linux_i2c1;
+
+#define HAL_I2C1 (&hal_linux_i2c1)
+
+typedef uint8_t hal_pio_t;
+
+#define HAL_PIO0 ((hal_pio_t) 0)
+
+/**
+ * @brief Trava entre núcleos (na simulação, só mascara as interrupções).
+ */
+typedef struct
+{
+    uint8_t id; /**< Número da trava */
+} hal_spin_lock_t;
+
+typedef int32_t hal_alarm_id_t;
+typedef int64_t (*hal_alarm_callback_t)(hal_alarm_id_t id, void *user_data);
+
+typedef struct hal_repeating_timer hal_repeating_timer_t;
+typedef bool (*hal_repeating_timer_callback_t)(hal_repeating_timer_t *t);
+
+/**
+ * @brief Temporizador periódico (mesmos campos usados pelo SDK).
+ */
+struct hal_repeating_timer
+{
+    int64_t delay_us;                        /**< Período em microssegundos */
+    hal_alarm_id_t alarm_id;                 /**< Alarme que dispara a próxima chamada */
+    hal_repeating_timer_callback_t callback; /**< Função chamada a cada período */
+    void *user_data;                         /**< Dado livre do usuário */
+};
+
+typedef void (*hal_gpio_irq_callback_t)(uint gpio, uint32_t events);
+
+#define HAL_GPIO_IRQ_EDGE_FALL 0x4u
+#define HAL_GPIO_IRQ_EDGE_RISE 0x8u
+
+uint32_t hal_time_us32(void);
+uint64_t hal_time_us(void);
+void hal_sleep_until_us(uint64_t deadline_us);
+void hal_sleep_ms(uint32_t ms);
+
+uint32_t hal_irq_save(void);
+void hal_irq_restore(uint32_t status);
+void hal_dmb(void);
+void hal_wait_for_interrupt(void);
+
+uint hal_core_num(void);
+void hal_wait_for_event(void);
+void hal_send_event(void);
+uint32_t hal_spin_lock(hal_spin_lock_t *lock);
+void hal_spin_unlock(hal_spin_lock_t *lock, uint32_t status);
+
+void hal_gpio_init(uint gpio);
+void hal_gpio_pull_up(uint gpio);
+bool hal_gpio_get(uint gpio);
+void hal_gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled);
+void hal_gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, hal_gpio_irq_callback_t callback);
+
+void hal_i2c_write(hal_i2c_t *port, uint8_t address, const uint8_t *data, size_t length);
+void hal_i2c_set_baudrate(hal_i2c_t *port, uint baudrate);
+
+void hal_pwm_set_level(uint gpio, uint16_t level);
+void hal_pwm_set_divider_wrap(uint gpio, uint16_t div_16, uint16_t wrap);
+
+void hal_ws2812_put(hal_pio_t pio, uint sm, uint32_t grb);
+
+hal_alarm_id_t hal_alarm_in_us(uint64_t delay_us, hal_alarm_callback_t callback, void *user_data, bool fire_if_past);
+bool hal_alarm_cancel(hal_alarm_id_t id);
+bool hal_repeating_timer_add_ms(int32_t period_ms, hal_repeating_timer_callback_t callback, void *user_data, hal_repeating_timer_t *t);
+bool hal_repeating_timer_cancel(hal_repeating_timer_t *t);
+
+uint32_t hal_clock_sys_hz(void);
+bool hal_sys_clock_khz_valid(uint32_t khz);
+
+void hal_stdio_init(void);
+int hal_getc_nonblocking(void);
+void hal_putc_raw(char c);
+void hal_flush(void);
+
+uint32_t hal_cycle_counter(void);
+
+void hal_reboot_to_bootloader(void);
+
+#else // RP2040
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "hardware/i2c.h"
+#include "hardware/pwm.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+typedef i2c_inst_t hal_i2c_t;
+
+#define HAL_I2C1 i2c1
+
+typedef PIO hal_pio_t;
+
+#define HAL_PIO0 pio0
+
+typedef spin_lock_t hal_spin_lock_t;
+typedef alarm_id_t hal_alarm_id_t;
+typedef alarm_callback_t hal_alarm_callback_t;
+typedef struct repeating_timer hal_repeating_timer_t;
+typedef repeating_timer_callback_t hal_repeating_timer_callback_t;
+typedef gpio_irq_callback_t hal_gpio_irq_callback_t;
+
+#define HAL_GPIO_IRQ_EDGE_FALL GPIO_IRQ_EDGE_FALL
+#define HAL_GPIO_IRQ_EDGE_RISE GPIO_IRQ_EDGE_RISE
+
+static inline uint32_t hal_time_us32(void) { return time_us_32(); }
+static inline uint64_t hal_time_us(void) { return time_us_64(); }
+static inline void hal_sleep_until_us(uint64_t deadline_us) { sleep_until(from_us_since_boot(deadline_us)); }
+static inline void hal_sleep_ms(uint32_t ms) { sleep_ms(ms); }
+
+static inline uint32_t hal_irq_save(void) { return save_and_disable_interrupts(); }
+static inline void hal_irq_restore(uint32_t status) { restore_interrupts(status); }
+static inline void hal_dmb(void) { __dmb(); }
+static inline void hal_wait_for_interrupt(void) { __wfi(); }
+
+static inline uint hal_core_num(void) { return get_core_num(); }
+static inline void hal_wait_for_event(void) { __wfe(); }
+static inline void hal_send_event(void) { __sev(); }
+static inline uint32_t hal_spin_lock(hal_spin_lock_t *lock) { return spin_lock_blocking(lock); }
+static inline void hal_spin_unlock(hal_spin_lock_t *lock, uint32_t status) { spin_unlock(lock, status); }
+
+static inline void hal_gpio_init(uint gpio) { gpio_init(gpio); }
+static inline void hal_gpio_pull_up(uint gpio) { gpio_pull_up(gpio); }
+static inline bool hal_gpio_get(uint gpio) { return gpio_get(gpio); }
+static inline void hal_gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled) { gpio_set_irq_enabled(gpio, events, enabled); }
+static inline void hal_gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, hal_gpio_irq_callback_t callback)
+{
+    gpio_set_irq_enabled_with_callback(gpio, events, enabled, callback);
+}
+
+static inline void hal_i2c_write(hal_i2c_t *port, uint8_t address, const uint8_t *data, size_t length)
+{
+    i2c_write_blocking(port, address, data, length, false);
+}
+static inline void hal_i2c_set_baudrate(hal_i2c_t *port, uint baudrate) { i2c_set_baudrate(port, baudrate); }
+
+static inline void hal_pwm_set_level(uint gpio, uint16_t level) { pwm_set_gpio_level(gpio, level); }
+static inline void hal_pwm_set_divider_wrap(uint gpio, uint16_t div_16, uint16_t wrap)
+{
+    uint slice = pwm_gpio_to_slice_num(gpio);
+    pwm_set_clkdiv_int_frac(slice, div_16 >> 4, div_16 & 0xF);
+    pwm_set_wrap(slice, wrap);
+}
+
+static inline void hal_ws2812_put(hal_pio_t pio, uint sm, uint32_t grb) { pio_sm_put_blocking(pio, sm, grb); }
+
+static inline hal_alarm_id_t hal_alarm_in_us(uint64_t delay_us, hal_alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us(delay_us, callback, user_data, fire_if_past);
+}
+static inline bool hal_alarm_cancel(hal_alarm_id_t id) { return cancel_alarm(id); }
+static inline bool hal_repeating_timer_add_ms(int32_t period_ms, hal_repeating_timer_callback_t callback, void *user_data, hal_repeating_timer_t *t)
+{
+    return add_repeating_timer_ms(period_ms, callback, user_data, t);
+}
+static inline bool hal_repeating_timer_cancel(hal_repeating_timer_t *t) { return cancel_repeating_timer(t); }
+
+static inline uint32_t hal_clock_sys_hz(void) { return clock_get_hz(clk_sys); }
+static inline bool hal_sys_clock_khz_valid(uint32_t khz)
+{
+    uint vco_hz, postdiv1, postdiv2;
+    return check_sys_clock_khz(khz, &vco_hz, &postdiv1, &postdiv2);
+}
+
+static inline void hal_stdio_init(void) { stdio_init_all(); }
+static inline int hal_getc_nonblocking(void) { int c = getchar_timeout_us(0); return (c < 0) ? HAL_SERIAL_NONE : c; }
+static inline void hal_putc_raw(char c) { putchar_raw(c); }
+static inline void hal_flush(void) { stdio_flush(); }
+
+static inline uint32_t hal_cycle_counter(void) { return systick_hw->cvr; }
+
+void hal_reboot_to_bootloader(void);
+
+#endif // HAL_LINUX
+
+/**
+ * @brief Serviço chamado a cada fim de período (tick de PWM).
+ */
+typedef void (*hal_tick_handler_t)(void);
+
+/**
+ * @brief Serviço chamado quando um bloco do fluxo PWM termina de tocar.
+ *
+ * @param block Índice do bloco (0 ou 1) que acabou de tocar e pode ser reescrito.
+ */
+typedef void (*hal_stream_handler_t)(uint8_t block);
+
+/**
+ * @brief Inicia um barramento I2C e configura seus pinos (com pull-up).
+ *
+ * @param port Barramento.
+ * @param baudrate Velocidade em Hz.
+ * @param sda Pino de dados.
+ * @param scl Pino de relógio.
+ */
+void hal_i2c_init(hal_i2c_t *port, uint baudrate, uint8_t sda, uint8_t scl);
+
+/**
+ * @brief Troca o relógio do sistema.
+ *
+ * O relógio dos periféricos acompanha o do sistema; a UART do stdio é
+ * reconfigurada aqui para manter a taxa. Os demais divisores (I2C, PWM, PIO,
+ * DMA) são refeitos pelos drivers, avisados por `lib/clockmgr`.
+ *
+ * @param khz Frequência em kHz (veja `hal_sys_clock_khz_valid`).
+ * @param required `true` para parar o programa se a frequência não for possível.
+ */
+void hal_set_sys_clock_khz(uint32_t khz, bool required);
+
+/**
+ * @brief Prepara um pino como entrada analógica (inicia o ADC na primeira chamada).
+ *
+ * @param gpio Pino de 26 a 29.
+ */
+void hal_adc_gpio_init(uint8_t gpio);
+
+/**
+ * @brief Amostra canais do ADC continuamente em um ring buffer, sem uso da CPU.
+ *
+ * Os canais de `channel_mask` são convertidos em round-robin a partir de
+ * `first_channel`, em ordem crescente; a amostra de índice `k` vai para a
+ * posição `k % (tamanho do ring)`, de modo que cada canal ocupa sempre as
+ * mesmas posições. No RP2040, dois canais de DMA mantêm a cópia do FIFO.
+ *
+ * @param channel_mask Máscara dos canais.
+ * @param first_channel Canal da primeira conversão (o menor da máscara).
+ * @param rate_hz Conversões por segundo (somando os canais).
+ * @param ring Destino, alinhado ao próprio tamanho.
+ * @param ring_size_bits Log2 do tamanho do ring em bytes.
+ */
+void hal_adc_stream_init(uint8_t channel_mask, uint8_t first_channel, uint32_t rate_hz, volatile uint16_t *ring, uint8_t ring_size_bits);
+
+/**
+ * @brief Suspende ou retoma as conversões de `hal_adc_stream_init`.
+ *
+ * @param run `true` para converter.
+ */
+void hal_adc_stream_run(bool run);
+
+/**
+ * @brief Configura um pino como saída PWM habilitada, com nível 0.
+ *
+ * @param gpio Pino.
+ * @param div_16 Divisor do relógio em ponto fixo 8.4.
+ * @param wrap Valor de wrap do slice.
+ */
+void hal_pwm_gpio_init(uint gpio, uint16_t div_16, uint16_t wrap);
+
+/**
+ * @brief Usa um slice de PWM sem pinos como base de tempo periódica.
+ *
+ * O tick começa desabilitado; `handler` é chamado a cada wrap enquanto ele
+ * estiver habilitado por `hal_pwm_tick_set_enabled`.
+ *
+ * @param slice Slice dedicado.
+ * @param hz Frequência do tick.
+ * @param handler Função chamada na interrupção.
+ */
+void hal_pwm_tick_init(uint slice, uint32_t hz, hal_tick_handler_t handler);
+
+/**
+ * @brief Habilita ou desabilita o tick (descartando um wrap pendente ao habilitar).
+ *
+ * @param slice Slice do tick.
+ * @param enabled `true` para habilitar.
+ */
+void hal_pwm_tick_set_enabled(uint slice, bool enabled);
+
+/**
+ * @brief Refaz o divisor do tick para o relógio atual, mantendo a frequência.
+ *
+ * @param slice Slice do tick.
+ * @param hz Frequência do tick.
+ */
+void hal_pwm_tick_set_rate(uint slice, uint32_t hz);
+
+/**
+ * @brief Prepara a reprodução de amostras no nível PWM de um pino, em blocos.
+ *
+ * Cada palavra dos blocos contém o nível dos canais A e B do slice nas duas
+ * metades. Os dois blocos tocam alternadamente; ao fim de cada um, `handler`
+ * é chamado (em interrupção) para reescrevê-lo e devolvê-lo com
+ * `hal_pwm_stream_rearm`. Há um único fluxo.
+ *
+ * @param gpio Pino de saída.
+ * @param wrap Wrap da portadora (nível máximo).
+ * @param block_a Primeiro bloco.
+ * @param block_b Segundo bloco.
+ * @param block_len Palavras por bloco.
+ * @param handler Função chamada ao fim de cada bloco.
+ * @return `false` se não houver recursos livres (canais ou timers de DMA).
+ */
+bool hal_pwm_stream_init(uint gpio, uint16_t wrap, uint32_t *block_a, uint32_t *block_b, uint32_t block_len, hal_stream_handler_t handler);
+
+/**
+ * @brief Começa a tocar os dois blocos, já preenchidos, a partir do primeiro.
+ *
+ * @param sample_rate_hz Palavras por segundo.
+ */
+void hal_pwm_stream_start(uint32_t sample_rate_hz);
+
+/**
+ * @brief Refaz o ritmo do fluxo para o relógio atual, sem interrompê-lo.
+ *
+ * @param sample_rate_hz Palavras por segundo.
+ */
+void hal_pwm_stream_set_rate(uint32_t sample_rate_hz);
+
+/**
+ * @brief Devolve um bloco reescrito à fila de reprodução.
+ *
+ * @param block Índice do bloco.
+ */
+void hal_pwm_stream_rearm(uint8_t block);
+
+/**
+ * @brief Para o fluxo sem disparar o outro bloco e zera o nível do pino.
+ */
+void hal_pwm_stream_stop(void);
+
+/**
+ * @brief Carrega o programa de LEDs WS2812 em uma máquina de estados do PIO (800 kHz).
+ *
+ * @param pio Bloco PIO.
+ * @param pin Pino de dados da matriz.
+ * @return Máquina de estados usada por `hal_ws2812_put`.
+ */
+uint hal_ws2812_init(hal_pio_t pio, uint8_t pin);
+
+/**
+ * @brief Espera a máquina de estados terminar de enviar o que está no FIFO.
+ *
+ * @param pio Bloco PIO.
+ * @param sm Máquina de estados.
+ */
+void hal_ws2812_wait_idle(hal_pio_t pio, uint sm);
+
+/**
+ * @brief Refaz o divisor da máquina de estados para o relógio atual (800 kHz).
+ *
+ * @param pio Bloco PIO.
+ * @param sm Máquina de estados.
+ */
+void hal_ws2812_set_clock(hal_pio_t pio, uint sm);
+
+/**
+ * @brief Reserva uma trava entre núcleos.
+ *
+ * @return Trava inicializada.
+ */
+hal_spin_lock_t *hal_spin_lock_claim(void);
+
+/**
+ * @brief Inicia o núcleo 1 em `entry`.
+ *
+ * @param entry Laço do núcleo 1 (não retorna).
+ */
+void hal_core1_launch(void (*entry)(void));
+
+/**
+ * @brief Inicia o contador livre de ciclos lido por `hal_cycle_counter`.
+ *
+ * O contador é decrescente e de 24 bits (SysTick no RP2040).
+ */
+void hal_cycle_counter_init(void);
+
+/**
+ * @brief Indica, sem consumir, se há bytes recebidos pela serial para `hal_getc_nonblocking`.
+ *
+ * Pode ser chamada com as interrupções mascaradas (condição de `power_wait_until`).
+ *
+ * @return `true` se há ao menos um byte recebido.
+ */
+bool hal_serial_readable(void);
+
+/**
+ * @brief Envia bytes pela serial sem esperar: só o que cabe agora na transmissão.
+ *
+ * Vai para a USB (CDC) quando há um terminal conectado e para a UART do stdio
+ * caso contrário. Ao contrário de `printf`, nunca bloqueia quando o computador
+ * não está lendo; nesse caso aceita 0 bytes.
+ *
+ * @param data Bytes.
+ * @param length Quantidade.
+ * @return Bytes aceitos, do início de `data`.
+ */
+size_t hal_serial_try_write(const uint8_t *data, size_t length);
+
+/**
+ * @def HAL_FLASH_SECTOR_SIZE
+ * @brief Menor região apagável da flash, em bytes.
+ */
+#define HAL_FLASH_SECTOR_SIZE 4096u
+
+/**
+ * @def HAL_FLASH_PAGE_SIZE
+ * @brief Granularidade da gravação na flash, em bytes.
+ */
+#define HAL_FLASH_PAGE_SIZE 256u
+
+/**
+ * @brief Tamanho da flash, em bytes.
+ *
+ * @return Bytes endereçáveis por `hal_flash_map`.
+ */
+uint32_t hal_flash_size(void);
+
+/**
+ * @brief Acesso de leitura ao conteúdo da flash.
+ *
+ * @param offset Posição a partir do início da flash.
+ * @return Ponteiro para os dados (XIP no RP2040); apagado vale 0xFF.
+ */
+const uint8_t *hal_flash_map(uint32_t offset);
+
+/**
+ * @brief Apaga setores inteiros (todos os bytes passam a 0xFF).
+ *
+ * No RP2040 o XIP fica desligado durante a operação: o outro núcleo é
+ * retido em RAM e as interrupções ficam desabilitadas (dezenas de ms por
+ * setor). Deve ser chamada fora dos trechos com prazo.
+ *
+ * @param offset Início, múltiplo de `HAL_FLASH_SECTOR_SIZE`.
+ * @param length Bytes, múltiplo de `HAL_FLASH_SECTOR_SIZE`.
+ * @return `false` se o alinhamento for inválido ou o outro núcleo não puder ser retido.
+ */
+bool hal_flash_erase(uint32_t offset, uint32_t length);
+
+/**
+ * @brief Grava páginas inteiras; cada bit gravado só pode ir de 1 para 0.
+ *
+ * Bytes 0xFF não alteram o conteúdo, então uma página pode ser completada em
+ * várias gravações. Mesmas restrições de `hal_flash_erase`.
+ *
+ * @param offset Início, múltiplo de `HAL_FLASH_PAGE_SIZE`.
+ * @param data Dados em RAM.
+ * @param length Bytes, múltiplo de `HAL_FLASH_PAGE_SIZE`.
+ * @return `false` se o alinhamento for inválido ou o outro núcleo não puder ser retido.
+ */
+bool hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Dorme com todos os osciladores parados até uma borda de descida em um dos GPIOs.
+ *
+ * @param gpio_mask Máscara dos GPIOs que acordam o sistema.
+ * @param sys_khz Relógio do sistema a restaurar, em kHz.
+ */
+void hal_dormant_until_gpio(uint32_t gpio_mask, uint32_t sys_khz);
+
+/** @} */ // Fim do grupo "HAL"
+
+#endif // HAL_H
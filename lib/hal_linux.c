@@ -0,0 +1,1048 @@
+#define _GNU_SOURCE
+#include "hal.h"
+#include "hal_linux.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+/**
+ * @file hal_linux.c
+ * @brief HAL para executar o jogo como programa nativo, com tempo simulado.
+ *
+ * O relógio só avança quando o jogo espera (`hal_sleep_until_us`,
+ * `hal_wait_for_interrupt`), saltando direto para o próximo evento agendado.
+ * Tudo o que no RP2040 é interrupção vira um alarme na mesma fila: alarmes
+ * do jogo, temporizadores periódicos, ticks de PWM e o fim de cada bloco do
+ * fluxo de áudio. Os alarmes são atendidos no núcleo 0 sempre que as
+ * interrupções estão habilitadas, com PRIMASK ativo durante a chamada.
+ *
+ * O núcleo 1 é uma corrotina (ucontext) que roda até esperar por um evento
+ * (`hal_wait_for_event`) e é retomada por `hal_send_event`, de modo que o
+ * trabalho entregue a ele é feito, de forma determinística, no instante em
+ * que foi pedido.
+ *
+ * O display SSD1306 é modelado a partir dos comandos recebidos no I2C
+ * (endereçamento, faixas de coluna e página, linha inicial) e o ADC grava no
+ * ring buffer as conversões que teriam ocorrido no tempo decorrido.
+ *
+ * A flash é uma NOR virtual (gravar só zera bits, apagar volta a 0xFF) que
+ * pode ser mapeada de um arquivo para persistir entre execuções; apagar e
+ * gravar consomem o tempo da operação real com as interrupções paradas.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @def SIM_MAX_EVENTS
+ * @brief Alarmes pendentes ao mesmo tempo (o SDK usa 16 por pool).
+ */
+#define SIM_MAX_EVENTS 32
+
+/**
+ * @def SIM_CORE1_STACK_BYTES
+ * @brief Pilha da corrotina do núcleo 1.
+ */
+#define SIM_CORE1_STACK_BYTES (64 * 1024)
+
+/**
+ * @def SIM_GPIO_COUNT
+ * @brief Pinos de GPIO do RP2040.
+ */
+#define SIM_GPIO_COUNT 30
+
+/**
+ * @def SIM_SERIAL_RX_BYTES
+ * @brief Capacidade da recepção serial (potência de 2).
+ */
+#define SIM_SERIAL_RX_BYTES 64
+
+/**
+ * @def SIM_SERIAL_LINE_BYTES
+ * @brief Maior linha repassada a `hal_linux_line_hook_t`.
+ */
+#define SIM_SERIAL_LINE_BYTES 256
+
+/**
+ * @def SIM_SERIAL_TX_BYTES
+ * @brief Buffer de transmissão do CDC (CFG_TUD_CDC_TX_BUFSIZE no SDK).
+ */
+#define SIM_SERIAL_TX_BYTES 256u
+
+/**
+ * @def SIM_WS2812_LEDS
+ * @brief LEDs guardados da matriz.
+ */
+#define SIM_WS2812_LEDS 25
+
+/**
+ * @def SIM_FLASH_ERASE_US
+ * @brief Tempo de apagamento de um setor (típico da W25Q16 da Pico).
+ */
+#define SIM_FLASH_ERASE_US 45000u
+
+/**
+ * @def SIM_FLASH_PROGRAM_US
+ * @brief Tempo de gravação de uma página.
+ */
+#define SIM_FLASH_PROGRAM_US 400u
+
+/**
+ * @def SIM_PWM_SLICES
+ * @brief Slices de PWM do RP2040.
+ */
+#define SIM_PWM_SLICES 8
+
+/**
+ * @brief Alarme agendado.
+ */
+typedef struct
+{
+    bool used;
+    hal_alarm_id_t id;
+    uint64_t at;  /**< Instante em microssegundos */
+    uint64_t seq; /**< Desempate entre alarmes do mesmo instante */
+    hal_alarm_callback_t callback;
+    void *user_data;
+} sim_event_t;
+
+hal_i2c_t hal_linux_i2c1 = { 1 };
+
+static uint64_t sim_now_us;
+static uint64_t sim_seq;
+static hal_alarm_id_t sim_next_id = 1;
+static sim_event_t sim_events[SIM_MAX_EVENTS];
+static uint32_t sim_primask[2];
+static uint sim_core;
+static uint32_t sim_sys_hz = 125000000;
+static hal_linux_stats_t sim_stats;
+
+// Núcleo 1
+static ucontext_t sim_core0_context;
+static ucontext_t sim_core1_context;
+static void (*sim_core1_entry)(void);
+static bool sim_core1_waiting;
+static bool sim_event_flag[2];
+
+// GPIO
+static bool sim_gpio_level[SIM_GPIO_COUNT];
+static bool sim_gpio_driven[SIM_GPIO_COUNT];
+static bool sim_gpio_pulled_up[SIM_GPIO_COUNT];
+static uint32_t sim_gpio_irq_events[SIM_GPIO_COUNT];
+static hal_gpio_irq_callback_t sim_gpio_callback;
+static uint32_t sim_gpio_falling_edges;
+
+// ADC
+static volatile uint16_t *sim_adc_ring;
+static uint32_t sim_adc_ring_len;
+static uint32_t sim_adc_rate_hz;
+static uint8_t sim_adc_order[4];
+static uint8_t sim_adc_order_len;
+static bool sim_adc_running;
+static uint64_t sim_adc_last_us;
+static uint64_t sim_adc_run_us;
+static uint64_t sim_adc_done;
+static uint16_t sim_adc_value[4] = { 2048, 2048, 2048, 2048 };
+static uint16_t sim_adc_noise = 2;
+static uint32_t sim_adc_noise_state = 0x12345678u;
+
+// PWM
+static uint16_t sim_pwm_level[SIM_GPIO_COUNT];
+
+/**
+ * @brief Tick de PWM: alarme periódico enquanto habilitado.
+ */
+static struct
+{
+    hal_tick_handler_t handler;
+    uint32_t period_us;
+    hal_alarm_id_t alarm;
+} sim_ticks[SIM_PWM_SLICES];
+
+/**
+ * @brief Fluxo de áudio: um alarme por bloco tocado.
+ */
+static struct
+{
+    uint gpio;
+    uint32_t block_len;
+    hal_stream_handler_t handler;
+    uint32_t period_us;
+    uint8_t next_block;
+    hal_alarm_id_t alarm;
+} sim_stream;
+
+// WS2812
+static uint32_t sim_ws2812[SIM_WS2812_LEDS];
+static uint8_t sim_ws2812_next;
+
+/**
+ * @brief Estado do SSD1306 virtual.
+ */
+static struct
+{
+    uint8_t gram[8][128];
+    uint8_t mode; /**< 0 horizontal, 1 vertical, 2 página */
+    uint8_t col_start, col_end, col;
+    uint8_t page_start, page_end, page;
+    uint8_t start_line;
+    uint8_t command;
+    uint8_t args[2];
+    uint8_t args_len;
+    uint8_t args_left;
+} sim_oled = { .mode = 2, .col_end = 127, .page_end = 7 };
+
+// Serial
+static char sim_rx[SIM_SERIAL_RX_BYTES];
+static uint32_t sim_rx_head, sim_rx_tail;
+static FILE *sim_uart_out;
+static bool sim_uart_echo = true;
+static hal_linux_line_hook_t sim_uart_hook;
+static char sim_uart_line[SIM_SERIAL_LINE_BYTES];
+static size_t sim_uart_line_len;
+static hal_linux_tx_sink_t sim_tx_sink;
+static uint32_t sim_tx_rate = 64; // bytes/ms
+static uint32_t sim_tx_level;
+static uint64_t sim_tx_last_us;
+
+// Flash
+static uint8_t *sim_flash;
+
+static hal_spin_lock_t sim_spin_locks[32];
+static uint8_t sim_spin_locks_claimed;
+
+// Tempo e alarmes
+// ===============
+
+static void sim_adc_advance(uint64_t to_us);
+
+static void sim_set_now(uint64_t t)
+{
+    if (t <= sim_now_us) return;
+    sim_adc_advance(t);
+    sim_now_us = t;
+}
+
+static sim_event_t *sim_earliest(void)
+{
+    sim_event_t *best = NULL;
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        sim_event_t *e = &sim_events[i];
+        if (e->used && (!best || e->at < best->at || (e->at == best->at && e->seq < best->seq))) best = e;
+    }
+    return best;
+}
+
+static bool sim_add(hal_alarm_id_t id, uint64_t at, hal_alarm_callback_t callback, void *user_data)
+{
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        sim_event_t *e = &sim_events[i];
+        if (e->used) continue;
+        *e = (sim_event_t) { true, id, at, sim_seq++, callback, user_data };
+        return true;
+    }
+    return false;
+}
+
+static void sim_stalled(void)
+{
+    fprintf(stderr, "hal_linux: espera sem nenhum evento agendado; a simulação não pode avançar\n");
+    hal_flush();
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Atende um alarme com PRIMASK ativo e o reagenda conforme o retorno (regra do SDK).
+ */
+static void sim_fire(sim_event_t *e)
+{
+    sim_event_t ev = *e;
+    e->used = false;
+    sim_stats.events++;
+
+    uint32_t status = sim_primask[0];
+    sim_primask[0] = 1;
+    int64_t next = ev.callback(ev.id, ev.user_data);
+    sim_primask[0] = status;
+
+    if (next < 0) sim_add(ev.id, ev.at + (uint64_t) -next, ev.callback, ev.user_data);
+    else if (next > 0) sim_add(ev.id, sim_now_us + (uint64_t) next, ev.callback, ev.user_data);
+}
+
+/**
+ * @brief Atende, em ordem, os alarmes vencidos, se o núcleo 0 aceita interrupções.
+ */
+static void sim_run_due(void)
+{
+    sim_event_t *e;
+    if (sim_core != 0 || sim_primask[0]) return;
+    while ((e = sim_earliest()) && e->at <= sim_now_us) sim_fire(e);
+}
+
+uint32_t hal_time_us32(void) { return (uint32_t) sim_now_us; }
+
+uint64_t hal_time_us(void) { return sim_now_us; }
+
+void hal_sleep_until_us(uint64_t deadline_us)
+{
+    sim_event_t *e;
+    while ((e = sim_earliest()) && e->at <= deadline_us)
+    {
+        sim_set_now(e->at);
+        sim_fire(e);
+    }
+    sim_set_now(deadline_us);
+}
+
+void hal_sleep_ms(uint32_t ms) { hal_sleep_until_us(sim_now_us + (uint64_t) ms * 1000u); }
+
+uint32_t hal_irq_save(void)
+{
+    uint32_t status = sim_primask[sim_core];
+    sim_primask[sim_core] = 1;
+    return status;
+}
+
+void hal_irq_restore(uint32_t status)
+{
+    sim_primask[sim_core] = status;
+    if (!status) sim_run_due();
+}
+
+void hal_dmb(void) { __asm__ volatile("" ::: "memory"); }
+
+void hal_wait_for_interrupt(void)
+{
+    sim_event_t *e = sim_earliest();
+    if (!e) sim_stalled();
+    sim_set_now(e->at);
+    sim_run_due(); // Com PRIMASK ativo, o alarme fica para hal_irq_restore
+}
+
+hal_alarm_id_t hal_alarm_in_us(uint64_t delay_us, hal_alarm_callback_t callback, void *user_data, bool fire_if_past)
+{
+    (void) fire_if_past; // O instante nunca está no passado: o relógio não anda sozinho
+    hal_alarm_id_t id = sim_next_id++;
+    if (sim_next_id <= 0) sim_next_id = 1;
+    return sim_add(id, sim_now_us + delay_us, callback, user_data) ? id : -1;
+}
+
+bool hal_alarm_cancel(hal_alarm_id_t id)
+{
+    for (int i = 0; i < SIM_MAX_EVENTS; i++)
+    {
+        if (sim_events[i].used && sim_events[i].id == id)
+        {
+            sim_events[i].used = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int64_t sim_repeating_timer_callback(hal_alarm_id_t id, void *user_data)
+{
+    hal_repeating_timer_t *t = (hal_repeating_timer_t *) user_data;
+    (void) id;
+    if (!t->callback(t))
+    {
+        t->alarm_id = 0;
+        return 0;
+    }
+    return t->delay_us;
+}
+
+bool hal_repeating_timer_add_ms(int32_t period_ms, hal_repeating_timer_callback_t callback, void *user_data, hal_repeating_timer_t *t)
+{
+    int64_t period_us = (int64_t) period_ms * 1000;
+    t->delay_us = -(period_us < 0 ? -period_us : period_us); // Período fixo, como um delay negativo no SDK
+    t->callback = callback;
+    t->user_data = user_data;
+    t->alarm_id = hal_alarm_in_us((uint64_t) -t->delay_us, sim_repeating_timer_callback, t, true);
+    return t->alarm_id > 0;
+}
+
+bool hal_repeating_timer_cancel(hal_repeating_timer_t *t)
+{
+    bool cancelled = t->alarm_id > 0 && hal_alarm_cancel(t->alarm_id);
+    t->alarm_id = 0;
+    return cancelled;
+}
+
+// Núcleos
+// =======
+
+uint hal_core_num(void) { return sim_core; }
+
+static void sim_core1_trampoline(void)
+{
+    sim_core1_entry();
+    fprintf(stderr, "hal_linux: o laço do núcleo 1 retornou\n");
+    exit(EXIT_FAILURE);
+}
+
+static void sim_switch_to_core1(void)
+{
+    sim_core1_waiting = false;
+    sim_core = 1;
+    swapcontext(&sim_core0_context, &sim_core1_context);
+    sim_core = 0;
+}
+
+void hal_core1_launch(void (*entry)(void))
+{
+    getcontext(&sim_core1_context);
+    sim_core1_context.uc_stack.ss_sp = malloc(SIM_CORE1_STACK_BYTES);
+    sim_core1_context.uc_stack.ss_size = SIM_CORE1_STACK_BYTES;
+    sim_core1_context.uc_link = NULL;
+    if (!sim_core1_context.uc_stack.ss_sp)
+    {
+        fprintf(stderr, "hal_linux: sem memória para a pilha do núcleo 1\n");
+        exit(EXIT_FAILURE);
+    }
+    makecontext(&sim_core1_context, sim_core1_trampoline, 0);
+    sim_core1_entry = entry;
+    sim_switch_to_core1(); // Roda até a primeira espera
+}
+
+void hal_wait_for_event(void)
+{
+    uint core = sim_core;
+    if (sim_event_flag[core])
+    {
+        sim_event_flag[core] = false;
+        return;
+    }
+    if (core == 1)
+    {
+        sim_core1_waiting = true;
+        swapcontext(&sim_core1_context, &sim_core0_context);
+        sim_event_flag[1] = false;
+        return;
+    }
+    hal_wait_for_interrupt(); // No núcleo 0, WFE também termina com uma interrupção
+}
+
+void hal_send_event(void)
+{
+    sim_event_flag[0] = sim_event_flag[1] = true;
+    if (sim_core == 0 && sim_core1_waiting)
+    {
+        sim_stats.core1_wakeups++;
+        sim_switch_to_core1();
+    }
+}
+
+hal_spin_lock_t *hal_spin_lock_claim(void)
+{
+    if (sim_spin_locks_claimed >= count_of(sim_spin_locks))
+    {
+        fprintf(stderr, "hal_linux: travas esgotadas\n");
+        exit(EXIT_FAILURE);
+    }
+    hal_spin_lock_t *lock = &sim_spin_locks[sim_spin_locks_claimed];
+    lock->id = sim_spin_locks_claimed++;
+    return lock;
+}
+
+uint32_t hal_spin_lock(hal_spin_lock_t *lock)
+{
+    (void) lock; // Os núcleos nunca rodam ao mesmo tempo
+    return hal_irq_save();
+}
+
+void hal_spin_unlock(hal_spin_lock_t *lock, uint32_t status)
+{
+    (void) lock;
+    hal_irq_restore(status);
+}
+
+// GPIO
+// ====
+
+void hal_gpio_init(uint gpio)
+{
+    sim_gpio_irq_events[gpio] = 0;
+    sim_gpio_pulled_up[gpio] = false;
+    if (!sim_gpio_driven[gpio]) sim_gpio_level[gpio] = false;
+}
+
+void hal_gpio_pull_up(uint gpio)
+{
+    sim_gpio_pulled_up[gpio] = true;
+    if (!sim_gpio_driven[gpio]) sim_gpio_level[gpio] = true;
+}
+
+bool hal_gpio_get(uint gpio) { return sim_gpio_level[gpio]; }
+
+void hal_gpio_set_irq_enabled(uint gpio, uint32_t events, bool enabled)
+{
+    if (enabled) sim_gpio_irq_events[gpio] |= events;
+    else sim_gpio_irq_events[gpio] &= ~events;
+}
+
+void hal_gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, hal_gpio_irq_callback_t callback)
+{
+    sim_gpio_callback = callback;
+    hal_gpio_set_irq_enabled(gpio, events, enabled);
+}
+
+void hal_linux_gpio_set(uint gpio, bool level)
+{
+    sim_gpio_driven[gpio] = true;
+    if (sim_gpio_level[gpio] == level) return;
+    sim_gpio_level[gpio] = level;
+
+    uint32_t event = level ? HAL_GPIO_IRQ_EDGE_RISE : HAL_GPIO_IRQ_EDGE_FALL;
+    if (!level) sim_gpio_falling_edges |= 1u << gpio;
+    if ((sim_gpio_irq_events[gpio] & event) && sim_gpio_callback)
+    {
+        uint32_t status = sim_primask[0];
+        sim_primask[0] = 1;
+        sim_gpio_callback(gpio, event);
+        sim_primask[0] = status;
+    }
+}
+
+void hal_dormant_until_gpio(uint32_t gpio_mask, uint32_t sys_khz)
+{
+    // Sem osciladores, só a borda acorda; na simulação, os alarmes do host continuam (fazem o papel do
+    // mundo físico) mesmo com as interrupções mascaradas por quem chama
+    uint32_t status = sim_primask[0];
+    sim_primask[0] = 0;
+    sim_gpio_falling_edges = 0;
+    while (!(sim_gpio_falling_edges & gpio_mask)) hal_wait_for_interrupt();
+    sim_primask[0] = status;
+    hal_set_sys_clock_khz(sys_khz, true);
+}
+
+// I2C e SSD1306 virtual
+// =====================
+
+void hal_i2c_init(hal_i2c_t *port, uint baudrate, uint8_t sda, uint8_t scl)
+{
+    (void) port;
+    (void) baudrate;
+    hal_gpio_pull_up(sda);
+    hal_gpio_pull_up(scl);
+}
+
+void hal_i2c_set_baudrate(hal_i2c_t *port, uint baudrate)
+{
+    (void) port;
+    (void) baudrate;
+}
+
+static uint8_t sim_oled_arg_count(uint8_t command)
+{
+    switch (command)
+    {
+    case 0x21: // SET_COL_ADDR
+    case 0x22: // SET_PAGE_ADDR
+        return 2;
+    case 0x20: // SET_MEM_ADDR
+    case 0x81: // SET_CONTRAST
+    case 0x8D: // SET_CHARGE_PUMP
+    case 0xA8: // SET_MUX_RATIO
+    case 0xD3: // SET_DISP_OFFSET
+    case 0xD5: // SET_DISP_CLK_DIV
+    case 0xD9: // SET_PRECHARGE
+    case 0xDA: // SET_COM_PIN_CFG
+    case 0xDB: // SET_VCOM_DESEL
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void sim_oled_apply(void)
+{
+    uint8_t command = sim_oled.command;
+    if (command == 0x20) sim_oled.mode = sim_oled.args[0] & 3;
+    else if (command == 0x21)
+    {
+        sim_oled.col_start = sim_oled.col = sim_oled.args[0] & 127;
+        sim_oled.col_end = sim_oled.args[1] & 127;
+    }
+    else if (command == 0x22)
+    {
+        sim_oled.page_start = sim_oled.page = sim_oled.args[0] & 7;
+        sim_oled.page_end = sim_oled.args[1] & 7;
+    }
+    else if (command >= 0x40 && command <= 0x7F) sim_oled.start_line = command & 63;
+}
+
+static void sim_oled_command(uint8_t byte)
+{
+    if (sim_oled.args_left)
+    {
+        sim_oled.args[sim_oled.args_len++] = byte;
+        if (--sim_oled.args_left == 0) sim_oled_apply();
+        return;
+    }
+    sim_oled.command = byte;
+    sim_oled.args_len = 0;
+    sim_oled.args_left = sim_oled_arg_count(byte);
+    if (!sim_oled.args_left) sim_oled_apply();
+}
+
+static void sim_oled_data(uint8_t byte)
+{
+    sim_oled.gram[sim_oled.page][sim_oled.col] = byte;
+    if (sim_oled.mode == 1)
+    {
+        if (sim_oled.page++ < sim_oled.page_end) return;
+        sim_oled.page = sim_oled.page_start;
+        if (sim_oled.col++ >= sim_oled.col_end) sim_oled.col = sim_oled.col_start;
+    }
+    else
+    {
+        if (sim_oled.col++ < sim_oled.col_end) return;
+        sim_oled.col = sim_oled.col_start;
+        if (sim_oled.mode == 0 && sim_oled.page++ >= sim_oled.page_end) sim_oled.page = sim_oled.page_start;
+    }
+}
+
+void hal_i2c_write(hal_i2c_t *port, uint8_t address, const uint8_t *data, size_t length)
+{
+    (void) port;
+    sim_stats.i2c_bytes += length + 1;
+    if (address != HAL_LINUX_OLED_ADDRESS || length == 0) return;
+
+    if (data[0] & 0x40)
+    {
+        sim_stats.oled_flushes++;
+        sim_stats.oled_data_bytes += length - 1;
+        for (size_t i = 1; i < length; i++) sim_oled_data(data[i]);
+    }
+    else
+    {
+        for (size_t i = 1; i < length; i++) sim_oled_command(data[i]);
+    }
+}
+
+const uint8_t *hal_linux_oled_gram(void) { return &sim_oled.gram[0][0]; }
+
+uint8_t hal_linux_oled_start_line(void) { return sim_oled.start_line; }
+
+// ADC
+// ===
+
+static uint16_t sim_adc_sample(uint8_t channel)
+{
+    int32_t value = sim_adc_value[channel];
+    if (sim_adc_noise)
+    {
+        sim_adc_noise_state = sim_adc_noise_state * 1664525u + 1013904223u;
+        value += (int32_t) ((sim_adc_noise_state >> 16) % (2u * sim_adc_noise + 1u)) - sim_adc_noise;
+    }
+    if (value < 0) value = 0;
+    if (value > 4095) value = 4095;
+    return (uint16_t) value;
+}
+
+/**
+ * @brief Grava no ring as conversões do intervalo (só as últimas que ainda caberiam nele).
+ */
+static void sim_adc_advance(uint64_t to_us)
+{
+    if (!sim_adc_running) return;
+    sim_adc_run_us += to_us - sim_adc_last_us;
+    sim_adc_last_us = to_us;
+
+    uint64_t total = sim_adc_run_us * sim_adc_rate_hz / 1000000u;
+    if (total - sim_adc_done > sim_adc_ring_len) sim_adc_done = total - sim_adc_ring_len;
+    sim_stats.adc_conversions += total - sim_adc_done;
+    for (uint64_t k = sim_adc_done; k < total; k++)
+        sim_adc_ring[k % sim_adc_ring_len] = sim_adc_sample(sim_adc_order[k % sim_adc_order_len]);
+    sim_adc_done = total;
+}
+
+void hal_adc_gpio_init(uint8_t gpio) { (void) gpio; }
+
+void hal_adc_stream_init(uint8_t channel_mask, uint8_t first_channel, uint32_t rate_hz, volatile uint16_t *ring, uint8_t ring_size_bits)
+{
+    sim_adc_order_len = 0;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint8_t channel = (uint8_t) ((first_channel + i) & 3);
+        if (channel_mask & (1u << channel)) sim_adc_order[sim_adc_order_len++] = channel;
+    }
+    sim_adc_ring = ring;
+    sim_adc_ring_len = (1u << ring_size_bits) / sizeof(uint16_t);
+    sim_adc_rate_hz = rate_hz;
+
+    // O ring enche em poucos milissegundos no hardware; aqui já começa cheio
+    for (uint32_t k = 0; k < sim_adc_ring_len; k++)
+        sim_adc_ring[k] = sim_adc_sample(sim_adc_order[k % sim_adc_order_len]);
+    sim_adc_done = sim_adc_run_us = 0;
+    sim_adc_last_us = sim_now_us;
+    sim_adc_running = true;
+}
+
+void hal_adc_stream_run(bool run)
+{
+    if (run == sim_adc_running) return;
+    if (run) sim_adc_last_us = sim_now_us;
+    else sim_adc_advance(sim_now_us);
+    sim_adc_running = run;
+}
+
+void hal_linux_adc_set(uint8_t channel, uint16_t value) { sim_adc_value[channel & 3] = value > 4095 ? 4095 : value; }
+
+void hal_linux_adc_set_noise(uint16_t amplitude) { sim_adc_noise = amplitude; }
+
+// PWM
+// ===
+
+void hal_pwm_gpio_init(uint gpio, uint16_t div_16, uint16_t wrap)
+{
+    (void) div_16;
+    (void) wrap;
+    sim_pwm_level[gpio] = 0;
+}
+
+void hal_pwm_set_level(uint gpio, uint16_t level) { sim_pwm_level[gpio] = level; }
+
+void hal_pwm_set_divider_wrap(uint gpio, uint16_t div_16, uint16_t wrap)
+{
+    (void) gpio;
+    (void) div_16;
+    (void) wrap;
+}
+
+uint16_t hal_linux_pwm_level(uint gpio) { return sim_pwm_level[gpio]; }
+
+static int64_t sim_tick_callback(hal_alarm_id_t id, void *user_data)
+{
+    uint slice = (uint) (uintptr_t) user_data;
+    sim_ticks[slice].handler();
+    // O serviço pode ter desabilitado (ou reiniciado) o próprio tick
+    return sim_ticks[slice].alarm == id ? -(int64_t) sim_ticks[slice].period_us : 0;
+}
+
+void hal_pwm_tick_init(uint slice, uint32_t hz, hal_tick_handler_t handler)
+{
+    sim_ticks[slice].handler = handler;
+    sim_ticks[slice].period_us = 1000000u / hz;
+    sim_ticks[slice].alarm = 0;
+}
+
+void hal_pwm_tick_set_rate(uint slice, uint32_t hz)
+{
+    // Os ticks simulados vêm de alarmes, que não dependem do relógio do sistema
+    sim_ticks[slice].period_us = 1000000u / hz;
+}
+
+void hal_pwm_tick_set_enabled(uint slice, bool enabled)
+{
+    if (enabled && !sim_ticks[slice].alarm)
+        sim_ticks[slice].alarm = hal_alarm_in_us(sim_ticks[slice].period_us, sim_tick_callback, (void *) (uintptr_t) slice, true);
+    else if (!enabled && sim_ticks[slice].alarm)
+    {
+        hal_alarm_cancel(sim_ticks[slice].alarm);
+        sim_ticks[slice].alarm = 0;
+    }
+}
+
+static int64_t sim_stream_callback(hal_alarm_id_t id, void *user_data)
+{
+    (void) user_data;
+    uint8_t block = sim_stream.next_block;
+    sim_stream.next_block ^= 1;
+    sim_stats.pcm_blocks++;
+    sim_stream.handler(block);
+    return sim_stream.alarm == id ? -(int64_t) sim_stream.period_us : 0;
+}
+
+bool hal_pwm_stream_init(uint gpio, uint16_t wrap, uint32_t *block_a, uint32_t *block_b, uint32_t block_len, hal_stream_handler_t handler)
+{
+    (void) wrap;
+    (void) block_a;
+    (void) block_b;
+    sim_stream.gpio = gpio;
+    sim_stream.block_len = block_len;
+    sim_stream.handler = handler;
+    sim_stream.alarm = 0;
+    return true;
+}
+
+void hal_pwm_stream_start(uint32_t sample_rate_hz)
+{
+    hal_pwm_stream_stop();
+    hal_pwm_stream_set_rate(sample_rate_hz);
+    sim_stream.next_block = 0;
+    sim_stream.alarm = hal_alarm_in_us(sim_stream.period_us, sim_stream_callback, NULL, true);
+}
+
+void hal_pwm_stream_set_rate(uint32_t sample_rate_hz)
+{
+    sim_stream.period_us = (uint32_t) ((uint64_t) sim_stream.block_len * 1000000u / sample_rate_hz);
+}
+
+void hal_pwm_stream_rearm(uint8_t block) { (void) block; }
+
+void hal_pwm_stream_stop(void)
+{
+    if (sim_stream.alarm) hal_alarm_cancel(sim_stream.alarm);
+    sim_stream.alarm = 0;
+    sim_pwm_level[sim_stream.gpio] = 0;
+}
+
+// WS2812
+// ======
+
+uint hal_ws2812_init(hal_pio_t pio, uint8_t pin)
+{
+    (void) pio;
+    (void) pin;
+    return 0;
+}
+
+void hal_ws2812_wait_idle(hal_pio_t pio, uint sm)
+{
+    (void) pio;
+    (void) sm;
+}
+
+void hal_ws2812_set_clock(hal_pio_t pio, uint sm)
+{
+    (void) pio;
+    (void) sm;
+}
+
+void hal_ws2812_put(hal_pio_t pio, uint sm, uint32_t grb)
+{
+    (void) pio;
+    (void) sm;
+    sim_stats.ws2812_words++;
+    sim_ws2812[sim_ws2812_next] = grb;
+    sim_ws2812_next = (uint8_t) ((sim_ws2812_next + 1) % SIM_WS2812_LEDS);
+}
+
+const uint32_t *hal_linux_ws2812_leds(void) { return sim_ws2812; }
+
+// Flash
+// =====
+
+static void sim_flash_map_anonymous(void)
+{
+    if (sim_flash) return;
+    sim_flash = mmap(NULL, HAL_LINUX_FLASH_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (sim_flash == MAP_FAILED)
+    {
+        fprintf(stderr, "hal_linux: sem memória para a flash\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(sim_flash, 0xFF, HAL_LINUX_FLASH_BYTES);
+}
+
+bool hal_linux_flash_attach(const char *path)
+{
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size < (off_t) HAL_LINUX_FLASH_BYTES)
+    {
+        // Arquivo novo ou curto: o restante é flash apagada
+        static const uint8_t erased[HAL_FLASH_SECTOR_SIZE] = { [0 ... HAL_FLASH_SECTOR_SIZE - 1] = 0xFF };
+        for (off_t at = size; at < (off_t) HAL_LINUX_FLASH_BYTES; at += (off_t) sizeof erased - at % (off_t) sizeof erased)
+        {
+            size_t n = sizeof erased - (size_t) (at % (off_t) sizeof erased);
+            if (pwrite(fd, erased, n, at) != (ssize_t) n)
+            {
+                close(fd);
+                return false;
+            }
+        }
+    }
+
+    uint8_t *map = mmap(NULL, HAL_LINUX_FLASH_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+    if (sim_flash) munmap(sim_flash, HAL_LINUX_FLASH_BYTES);
+    sim_flash = map;
+    return true;
+}
+
+uint32_t hal_flash_size(void) { return HAL_LINUX_FLASH_BYTES; }
+
+const uint8_t *hal_flash_map(uint32_t offset)
+{
+    sim_flash_map_anonymous();
+    return sim_flash + offset;
+}
+
+bool hal_flash_erase(uint32_t offset, uint32_t length)
+{
+    if ((offset | length) % HAL_FLASH_SECTOR_SIZE || offset + length > HAL_LINUX_FLASH_BYTES) return false;
+    sim_flash_map_anonymous();
+    memset(sim_flash + offset, 0xFF, length);
+    sim_stats.flash_erases += length / HAL_FLASH_SECTOR_SIZE;
+    // Interrupções paradas: o tempo passa sem atender alarmes, que ficam atrasados
+    sim_set_now(sim_now_us + (uint64_t) (length / HAL_FLASH_SECTOR_SIZE) * SIM_FLASH_ERASE_US);
+    return true;
+}
+
+bool hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length)
+{
+    if ((offset | length) % HAL_FLASH_PAGE_SIZE || offset + length > HAL_LINUX_FLASH_BYTES) return false;
+    sim_flash_map_anonymous();
+    for (uint32_t i = 0; i < length; i++) sim_flash[offset + i] &= data[i]; // NOR: só zera bits
+    sim_stats.flash_programmed_bytes += length;
+    sim_set_now(sim_now_us + (uint64_t) (length / HAL_FLASH_PAGE_SIZE) * SIM_FLASH_PROGRAM_US);
+    return true;
+}
+
+// Relógio, contador de ciclos e bootloader
+// ========================================
+
+uint32_t hal_clock_sys_hz(void) { return sim_sys_hz; }
+
+bool hal_sys_clock_khz_valid(uint32_t khz)
+{
+    // Mesma busca do SDK: cristal de 12 MHz, VCO de 750 a 1600 MHz e pós-divisores de 1 a 7
+    for (uint32_t fbdiv = 320; fbdiv >= 16; fbdiv--)
+    {
+        uint32_t vco_khz = fbdiv * 12000u;
+        if (vco_khz < 750000u || vco_khz > 1600000u) continue;
+        for (uint32_t postdiv1 = 7; postdiv1 >= 1; postdiv1--)
+        {
+            for (uint32_t postdiv2 = postdiv1; postdiv2 >= 1; postdiv2--)
+            {
+                if (vco_khz == khz * postdiv1 * postdiv2) return true;
+            }
+        }
+    }
+    return false;
+}
+
+void hal_set_sys_clock_khz(uint32_t khz, bool required)
+{
+    if (!hal_sys_clock_khz_valid(khz))
+    {
+        if (!required) return;
+        fprintf(stderr, "hal_linux: relógio de %u kHz impossível\n", (unsigned) khz);
+        exit(EXIT_FAILURE);
+    }
+    sim_sys_hz = khz * 1000u;
+}
+
+void hal_cycle_counter_init(void) {}
+
+uint32_t hal_cycle_counter(void)
+{
+    // Tempo real do processo, em ciclos do relógio configurado (decrescente, como o SysTick)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+    return (uint32_t) -(uint32_t) (ns * (sim_sys_hz / 1000000u) / 1000u) & 0xFFFFFFu;
+}
+
+void hal_reboot_to_bootloader(void)
+{
+    hal_flush();
+    fprintf(stderr, "hal_linux: reinício no bootloader USB pedido\n");
+    exit(EXIT_SUCCESS);
+}
+
+// Serial
+// ======
+
+static ssize_t sim_uart_write(void *cookie, const char *buf, size_t size)
+{
+    (void) cookie;
+    if (sim_uart_echo) fwrite(buf, 1, size, sim_uart_out);
+    for (size_t i = 0; i < size; i++)
+    {
+        if (buf[i] == '\n')
+        {
+            sim_uart_line[sim_uart_line_len] = '\0';
+            sim_uart_line_len = 0;
+            if (sim_uart_hook) sim_uart_hook(sim_uart_line);
+        }
+        else if (buf[i] != '\r' && sim_uart_line_len < SIM_SERIAL_LINE_BYTES - 1)
+        {
+            sim_uart_line[sim_uart_line_len++] = buf[i];
+        }
+    }
+    return (ssize_t) size;
+}
+
+void hal_stdio_init(void)
+{
+    if (sim_uart_out) return;
+    sim_uart_out = fdopen(dup(STDOUT_FILENO), "w");
+    FILE *uart = fopencookie(NULL, "w", (cookie_io_functions_t) { .write = sim_uart_write });
+    if (!sim_uart_out || !uart)
+    {
+        fprintf(stderr, "hal_linux: não foi possível redirecionar a saída\n");
+        exit(EXIT_FAILURE);
+    }
+    setvbuf(uart, NULL, _IOLBF, 0); // Cada linha chega inteira ao observador
+    stdout = uart;
+}
+
+int hal_getc_nonblocking(void)
+{
+    if (sim_rx_head == sim_rx_tail) return HAL_SERIAL_NONE;
+    return (unsigned char) sim_rx[sim_rx_tail++ & (SIM_SERIAL_RX_BYTES - 1)];
+}
+
+void hal_putc_raw(char c) { fputc(c, stdout); }
+
+void hal_flush(void)
+{
+    fflush(stdout);
+    if (sim_uart_out) fflush(sim_uart_out);
+}
+
+void hal_linux_serial_feed(char c)
+{
+    if (sim_rx_head - sim_rx_tail < SIM_SERIAL_RX_BYTES) sim_rx[sim_rx_head++ & (SIM_SERIAL_RX_BYTES - 1)] = c;
+}
+
+bool hal_serial_readable(void) { return sim_rx_head != sim_rx_tail; }
+
+size_t hal_serial_try_write(const uint8_t *data, size_t length)
+{
+    // O computador esvazia o buffer à taxa configurada desde a última escrita
+    uint64_t drained = (sim_now_us - sim_tx_last_us) * sim_tx_rate / 1000u;
+    if (drained)
+    {
+        sim_tx_level = drained >= sim_tx_level ? 0 : sim_tx_level - (uint32_t) drained;
+        sim_tx_last_us = sim_now_us;
+    }
+    size_t room = SIM_SERIAL_TX_BYTES - sim_tx_level;
+    if (length > room) length = room;
+    sim_tx_level += (uint32_t) length;
+    sim_stats.serial_tx_bytes += length;
+    if (sim_tx_sink && length) sim_tx_sink(data, length);
+    return length;
+}
+
+void hal_linux_serial_set_tx_sink(hal_linux_tx_sink_t sink, uint32_t bytes_per_ms)
+{
+    sim_tx_sink = sink;
+    sim_tx_rate = bytes_per_ms;
+}
+
+void hal_linux_serial_set_hook(hal_linux_line_hook_t hook, bool echo)
+{
+    hal_stdio_init();
+    sim_uart_hook = hook;
+    sim_uart_echo = echo;
+}
+
+void hal_linux_get_stats(hal_linux_stats_t *stats) { *stats = sim_stats; }
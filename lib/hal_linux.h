@@ -0,0 +1,168 @@
+#ifndef HAL_LINUX_H
+#define HAL_LINUX_H
+
+#include "hal.h"
+
+/**
+ * @file hal_linux.h
+ * @brief Controle dos periféricos virtuais da HAL Linux (tempo simulado).
+ *
+ * Usado pelo programa que conduz o jogo no host (`host/eraseit_host.c`): ele
+ * move o joystick virtual, aperta botões, digita na serial e observa as
+ * linhas impressas pelo jogo. As ações agendadas usam `hal_alarm_in_us`, como
+ * qualquer alarme do jogo, e acontecem no instante simulado pedido.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup HAL_Linux HAL Linux
+ * @brief Periféricos virtuais e estatísticas da simulação.
+ * @{
+ */
+
+/**
+ * @def HAL_LINUX_OLED_ADDRESS
+ * @brief Endereço I2C em que o display SSD1306 virtual responde.
+ */
+#define HAL_LINUX_OLED_ADDRESS 0x3C
+
+/**
+ * @def HAL_LINUX_FLASH_BYTES
+ * @brief Tamanho da flash virtual (o da Pico W).
+ */
+#define HAL_LINUX_FLASH_BYTES (2u * 1024u * 1024u)
+
+/**
+ * @brief Função chamada a cada linha escrita na serial (sem o '\n').
+ */
+typedef void (*hal_linux_line_hook_t)(const char *line);
+
+/**
+ * @brief Contadores da simulação.
+ */
+typedef struct
+{
+    uint64_t events;            /**< Alarmes, ticks e blocos atendidos */
+    uint64_t core1_wakeups;     /**< Vezes que o núcleo 1 foi acordado por `hal_send_event` */
+    uint64_t i2c_bytes;         /**< Bytes no barramento I2C, incluindo o endereço */
+    uint64_t oled_data_bytes;   /**< Bytes escritos na GDDRAM do display */
+    uint64_t oled_flushes;      /**< Transações de dados no display */
+    uint64_t ws2812_words;      /**< Palavras enviadas à matriz de LEDs */
+    uint64_t pcm_blocks;        /**< Blocos de áudio tocados */
+    uint64_t adc_conversions;   /**< Conversões do ADC virtual */
+    uint64_t flash_erases;      /**< Setores apagados */
+    uint64_t flash_programmed_bytes; /**< Bytes gravados na flash */
+    uint64_t serial_tx_bytes;   /**< Bytes aceitos por `hal_serial_try_write` */
+} hal_linux_stats_t;
+
+/**
+ * @brief Define a leitura de um canal do ADC virtual.
+ *
+ * @param channel Canal (0 a 3).
+ * @param value Valor de 12 bits, antes do ruído.
+ */
+void hal_linux_adc_set(uint8_t channel, uint16_t value);
+
+/**
+ * @brief Define a amplitude do ruído somado a cada conversão (padrão 2).
+ *
+ * @param amplitude Desvio máximo, em unidades de 12 bits.
+ */
+void hal_linux_adc_set_noise(uint16_t amplitude);
+
+/**
+ * @brief Força o nível de um pino de entrada, gerando a interrupção da borda.
+ *
+ * @param gpio Pino.
+ * @param level Novo nível.
+ */
+void hal_linux_gpio_set(uint gpio, bool level);
+
+/**
+ * @brief Coloca um caractere na recepção da serial.
+ *
+ * @param c Caractere.
+ */
+void hal_linux_serial_feed(char c);
+
+/**
+ * @brief Registra quem observa a saída da serial.
+ *
+ * @param hook Função chamada a cada linha (NULL para nenhuma).
+ * @param echo `true` para também copiar a saída para o stdout do processo.
+ */
+void hal_linux_serial_set_hook(hal_linux_line_hook_t hook, bool echo);
+
+/**
+ * @brief Recebe os bytes aceitos por `hal_serial_try_write`.
+ */
+typedef void (*hal_linux_tx_sink_t)(const uint8_t *data, size_t length);
+
+/**
+ * @brief Define quem recebe a transmissão não bloqueante e a que taxa o computador lê.
+ *
+ * A transmissão é modelada como o buffer de 256 bytes do CDC, esvaziado à taxa
+ * dada; com 0, o computador não lê e o buffer fica cheio.
+ *
+ * @param sink Destino dos bytes (NULL para descartar).
+ * @param bytes_per_ms Taxa de leitura (padrão 64, um pacote por quadro USB).
+ */
+void hal_linux_serial_set_tx_sink(hal_linux_tx_sink_t sink, uint32_t bytes_per_ms);
+
+/**
+ * @brief Memória de vídeo do display virtual, página a página (8 x 128 bytes).
+ *
+ * @return GDDRAM, bit 0 de cada byte na linha de cima da página.
+ */
+const uint8_t *hal_linux_oled_gram(void);
+
+/**
+ * @brief Linha inicial do display virtual (`SET_DISP_START_LINE`).
+ *
+ * @return Linha de 0 a 63.
+ */
+uint8_t hal_linux_oled_start_line(void);
+
+/**
+ * @brief Nível atual de um pino PWM.
+ *
+ * @param gpio Pino.
+ * @return Último nível escrito.
+ */
+uint16_t hal_linux_pwm_level(uint gpio);
+
+/**
+ * @brief Últimas 25 palavras GRB enviadas à matriz de LEDs.
+ *
+ * @return Vetor de 25 posições, na ordem de envio.
+ */
+const uint32_t *hal_linux_ws2812_leds(void);
+
+/**
+ * @brief Mapeia a flash virtual de um arquivo, para que persista entre execuções.
+ *
+ * O arquivo é criado (ou completado) com 0xFF até `HAL_LINUX_FLASH_BYTES`.
+ * Sem esta chamada, a flash começa apagada e some ao fim do processo.
+ *
+ * @param path Caminho do arquivo.
+ * @return `false` se o arquivo não puder ser aberto ou mapeado.
+ */
+bool hal_linux_flash_attach(const char *path);
+
+/**
+ * @brief Lê os contadores da simulação.
+ *
+ * @param[out] stats Destino.
+ */
+void hal_linux_get_stats(hal_linux_stats_t *stats);
+
+/** @} */ // Fim do grupo "HAL_Linux"
+
+#endif // HAL_LINUX_H
@@ -0,0 +1,499 @@
+#include "hal.h"
+#include "pico/bootrom.h"
+#include "pico/multicore.h"
+#include "pico/flash.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/irq.h"
+#include "hardware/pll.h"
+#include "hardware/xosc.h"
+#include "../generated/ws2812b.pio.h"
+#if LIB_PICO_STDIO_USB
+#include "tusb.h"
+#endif
+#if LIB_PICO_STDIO_UART
+#include "hardware/uart.h"
+#endif
+
+/**
+ * @file hal_rp2040.c
+ * @brief Implementação da HAL sobre o Pico SDK.
+ *
+ * Os serviços deste arquivo concentram a configuração de DMA, PIO, relógios e
+ * interrupções compartilhadas que antes ficava nos módulos de `lib/`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+static bool hal_adc_ready = false;
+
+/**
+ * @brief Endereço inicial do ring do ADC, lido pelo canal DMA de controle para rearmar o canal de dados.
+ */
+static volatile uint16_t *hal_adc_ring_start;
+
+static hal_tick_handler_t hal_pwm_tick_handlers[NUM_PWM_SLICES];
+static bool hal_pwm_tick_irq_installed = false;
+
+static uint hal_stream_gpio;
+static uint32_t *hal_stream_blocks[2];
+static int hal_stream_dma_chan[2];
+static dma_channel_config hal_stream_dma_cfg[2];
+static int hal_stream_dma_timer;
+static hal_stream_handler_t hal_stream_handler;
+static volatile bool hal_stream_running = false;
+
+void hal_reboot_to_bootloader(void)
+{
+    reset_usb_boot(0, 0);
+}
+
+void hal_set_sys_clock_khz(uint32_t khz, bool required)
+{
+    if (!set_sys_clock_khz(khz, required)) return;
+#if LIB_PICO_STDIO_UART
+    // clk_peri segue o clk_sys: sem refazer o divisor, a UART do stdio mudaria de taxa
+    uart_set_baudrate(uart_default, PICO_DEFAULT_UART_BAUD_RATE);
+#endif
+}
+
+void hal_i2c_init(hal_i2c_t *port, uint baudrate, uint8_t sda, uint8_t scl)
+{
+    i2c_init(port, baudrate);
+    gpio_set_function(sda, GPIO_FUNC_I2C);
+    gpio_set_function(scl, GPIO_FUNC_I2C);
+    gpio_pull_up(sda);
+    gpio_pull_up(scl);
+}
+
+void hal_adc_gpio_init(uint8_t gpio)
+{
+    if (!hal_adc_ready)
+    {
+        adc_init();
+        hal_adc_ready = true;
+    }
+    adc_gpio_init(gpio);
+}
+
+/**
+ * @brief Coloca o ADC em execução contínua e o DMA copiando para o ring buffer.
+ *
+ * Um canal DMA de dados lê o FIFO do ADC (DREQ_ADC) e escreve no ring com
+ * wrap de `ring_size_bits`. Ao término da contagem de transferências ele
+ * encadeia para um canal de controle, que reescreve o endereço de escrita do
+ * canal de dados (registrador com gatilho) e o reinicia. Assim a amostragem
+ * nunca para e a CPU nunca é interrompida.
+ */
+void hal_adc_stream_init(uint8_t channel_mask, uint8_t first_channel, uint32_t rate_hz, volatile uint16_t *ring, uint8_t ring_size_bits)
+{
+    uint32_t ring_len = (1u << ring_size_bits) / sizeof(uint16_t);
+
+    adc_run(false);
+    adc_fifo_drain();
+    adc_select_input(first_channel);
+    adc_set_round_robin(channel_mask);
+    // FIFO habilitado, DREQ a cada amostra, sem bit de erro e sem redução para 8 bits
+    adc_fifo_setup(true, true, 1, false, false);
+    // clk_adc (48 MHz) / (1 + div) conversões por segundo
+    adc_set_clkdiv((float) clock_get_hz(clk_adc) / rate_hz - 1.0f);
+
+    hal_adc_ring_start = ring;
+    uint data_chan = (uint) dma_claim_unused_channel(true);
+    uint ctrl_chan = (uint) dma_claim_unused_channel(true);
+
+    dma_channel_config data_cfg = dma_channel_get_default_config(data_chan);
+    channel_config_set_transfer_data_size(&data_cfg, DMA_SIZE_16);
+    channel_config_set_read_increment(&data_cfg, false);
+    channel_config_set_write_increment(&data_cfg, true);
+    channel_config_set_ring(&data_cfg, true, ring_size_bits);
+    channel_config_set_dreq(&data_cfg, DREQ_ADC);
+    channel_config_set_chain_to(&data_cfg, ctrl_chan);
+
+    dma_channel_config ctrl_cfg = dma_channel_get_default_config(ctrl_chan);
+    channel_config_set_transfer_data_size(&ctrl_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl_cfg, false);
+    channel_config_set_write_increment(&ctrl_cfg, false);
+
+    dma_channel_configure(ctrl_chan, &ctrl_cfg,
+                          &dma_hw->ch[data_chan].al2_write_addr_trig,
+                          &hal_adc_ring_start, 1, false);
+    // Contagem múltipla do tamanho do ring: a posição de cada canal se mantém a cada rearme
+    dma_channel_configure(data_chan, &data_cfg,
+                          ring, &adc_hw->fifo,
+                          ring_len * 1024u, true);
+    adc_run(true);
+}
+
+void hal_adc_stream_run(bool run)
+{
+    // Parado, o canal DMA permanece armado aguardando o DREQ do ADC, sem tráfego no barramento
+    adc_run(run);
+}
+
+void hal_pwm_gpio_init(uint gpio, uint16_t div_16, uint16_t wrap)
+{
+    uint slice = pwm_gpio_to_slice_num(gpio);
+
+    gpio_set_function(gpio, GPIO_FUNC_PWM);
+    pwm_set_clkdiv_int_frac(slice, div_16 >> 4, div_16 & 0xF);
+    pwm_set_wrap(slice, wrap);
+    pwm_set_gpio_level(gpio, 0);
+    pwm_set_enabled(slice, true);
+}
+
+/**
+ * @brief Interrupção de wrap compartilhada: repassa o wrap de cada slice de tick ao seu serviço.
+ */
+static void hal_pwm_tick_irq_handler(void)
+{
+    uint32_t status = pwm_get_irq_status_mask();
+    for (uint slice = 0; slice < NUM_PWM_SLICES; slice++)
+    {
+        if (!(status & (1u << slice)) || !hal_pwm_tick_handlers[slice]) continue; // Wrap de outro slice
+        pwm_clear_irq(slice);
+        hal_pwm_tick_handlers[slice]();
+    }
+}
+
+/**
+ * @brief Divisor inteiro e wrap do tick: clk_sys / (divisor * (wrap + 1)) = hz.
+ *
+ * O menor divisor que faz o período caber nos 16 bits do contador, para que o
+ * erro fique abaixo de uma contagem em qualquer relógio (acima de 131 MHz, um
+ * wrap fixo de 1024 passaria do divisor máximo de 255 em ticks de 500 Hz).
+ */
+static void hal_pwm_tick_divider(uint32_t hz, uint32_t *div, uint32_t *wrap)
+{
+    uint32_t counts = clock_get_hz(clk_sys) / hz;
+    *div = (counts + 65535u) / 65536u;
+    if (*div == 0) *div = 1;
+    else if (*div > 255) *div = 255;
+    *wrap = counts / *div - 1;
+    if (*wrap > 0xFFFF) *wrap = 0xFFFF;
+}
+
+void hal_pwm_tick_init(uint slice, uint32_t hz, hal_tick_handler_t handler)
+{
+    uint32_t div, wrap;
+    hal_pwm_tick_divider(hz, &div, &wrap);
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_clkdiv_int(&config, div);
+    pwm_config_set_wrap(&config, (uint16_t) wrap);
+    pwm_init(slice, &config, true);
+
+    pwm_clear_irq(slice);
+    hal_pwm_tick_handlers[slice] = handler;
+    if (!hal_pwm_tick_irq_installed)
+    {
+        irq_add_shared_handler(PWM_IRQ_WRAP, hal_pwm_tick_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(PWM_IRQ_WRAP, true);
+        hal_pwm_tick_irq_installed = true;
+    }
+}
+
+void hal_pwm_tick_set_enabled(uint slice, bool enabled)
+{
+    if (enabled) pwm_clear_irq(slice);
+    pwm_set_irq_enabled(slice, enabled);
+}
+
+void hal_pwm_tick_set_rate(uint slice, uint32_t hz)
+{
+    uint32_t div, wrap;
+    hal_pwm_tick_divider(hz, &div, &wrap);
+    // O contador pode estar além do novo wrap: recomeça para não esperar uma volta de 16 bits
+    pwm_set_clkdiv_int_frac(slice, (uint8_t) div, 0);
+    pwm_set_wrap(slice, (uint16_t) wrap);
+    pwm_set_counter(slice, 0);
+}
+
+/**
+ * @brief Interrupção de fim de bloco: entrega ao serviço o bloco que acabou de tocar.
+ */
+static void hal_stream_dma_irq_handler(void)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (!dma_channel_get_irq1_status(hal_stream_dma_chan[i])) continue;
+        dma_channel_acknowledge_irq1(hal_stream_dma_chan[i]);
+        hal_stream_handler(i);
+        if (!hal_stream_running) return; // O serviço parou o fluxo
+    }
+}
+
+bool hal_pwm_stream_init(uint gpio, uint16_t wrap, uint32_t *block_a, uint32_t *block_b, uint32_t block_len, hal_stream_handler_t handler)
+{
+    hal_stream_dma_chan[0] = dma_claim_unused_channel(false);
+    hal_stream_dma_chan[1] = dma_claim_unused_channel(false);
+    hal_stream_dma_timer = dma_claim_unused_timer(false);
+    if (hal_stream_dma_chan[0] < 0 || hal_stream_dma_chan[1] < 0 || hal_stream_dma_timer < 0) return false;
+
+    hal_stream_gpio = gpio;
+    hal_stream_blocks[0] = block_a;
+    hal_stream_blocks[1] = block_b;
+    hal_stream_handler = handler;
+    uint slice = pwm_gpio_to_slice_num(gpio);
+    gpio_set_function(gpio, GPIO_FUNC_PWM);
+    pwm_config config = pwm_get_default_config();
+    pwm_config_set_wrap(&config, wrap);
+    pwm_init(slice, &config, true);
+    pwm_set_gpio_level(gpio, 0);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        // Ao terminar um bloco, o canal dispara o outro (chain_to) e gera a interrupção
+        dma_channel_config *cfg = &hal_stream_dma_cfg[i];
+        *cfg = dma_channel_get_default_config(hal_stream_dma_chan[i]);
+        channel_config_set_transfer_data_size(cfg, DMA_SIZE_32);
+        channel_config_set_read_increment(cfg, true);
+        channel_config_set_write_increment(cfg, false);
+        channel_config_set_dreq(cfg, dma_get_timer_dreq(hal_stream_dma_timer));
+        channel_config_set_chain_to(cfg, hal_stream_dma_chan[i ^ 1]);
+        dma_channel_configure(hal_stream_dma_chan[i], cfg, &pwm_hw->slice[slice].cc, hal_stream_blocks[i], block_len, false);
+    }
+
+    irq_add_shared_handler(DMA_IRQ_1, hal_stream_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+    return true;
+}
+
+void hal_pwm_stream_start(uint32_t sample_rate_hz)
+{
+    hal_pwm_stream_set_rate(sample_rate_hz);
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        dma_channel_set_config(hal_stream_dma_chan[i], &hal_stream_dma_cfg[i], false); // Restaura o encadeamento
+        dma_channel_set_read_addr(hal_stream_dma_chan[i], hal_stream_blocks[i], false);
+        dma_channel_acknowledge_irq1(hal_stream_dma_chan[i]);
+        dma_channel_set_irq1_enabled(hal_stream_dma_chan[i], true);
+    }
+    hal_stream_running = true;
+    dma_channel_start(hal_stream_dma_chan[0]);
+}
+
+void hal_pwm_stream_set_rate(uint32_t sample_rate_hz)
+{
+    // Timer do DMA: clk_sys * 1 / (clk_sys / taxa); o próximo disparo já usa a nova fração
+    dma_timer_set_fraction(hal_stream_dma_timer, 1, (uint16_t) (clock_get_hz(clk_sys) / sample_rate_hz));
+}
+
+void hal_pwm_stream_rearm(uint8_t block)
+{
+    // A contagem de transferências é recarregada no disparo; só o endereço de leitura precisa voltar
+    dma_channel_set_read_addr(hal_stream_dma_chan[block], hal_stream_blocks[block], false);
+}
+
+void hal_pwm_stream_stop(void)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        // Encadear um canal a ele mesmo desliga o encadeamento: o abort não pode disparar o outro canal
+        dma_channel_config cfg = hal_stream_dma_cfg[i];
+        channel_config_set_chain_to(&cfg, hal_stream_dma_chan[i]);
+        dma_channel_set_config(hal_stream_dma_chan[i], &cfg, false);
+    }
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        dma_channel_set_irq1_enabled(hal_stream_dma_chan[i], false);
+        dma_channel_abort(hal_stream_dma_chan[i]);
+        dma_channel_acknowledge_irq1(hal_stream_dma_chan[i]);
+    }
+    pwm_set_gpio_level(hal_stream_gpio, 0);
+    hal_stream_running = false;
+}
+
+/**
+ * @def HAL_WS2812_PIO_HZ
+ * @brief Relógio da máquina de estados: 10 ciclos por bit a 800 kHz.
+ */
+#define HAL_WS2812_PIO_HZ 8000000.0f
+
+/**
+ * @def HAL_WS2812_WORD_US
+ * @brief Tempo para deslocar a última palavra de 24 bits depois que o FIFO esvazia.
+ */
+#define HAL_WS2812_WORD_US 30u
+
+uint hal_ws2812_init(hal_pio_t pio, uint8_t pin)
+{
+    uint offset = pio_add_program(pio, &ws2812_program); // Adiciona o programa WS2812 ao PIO
+    uint sm = pio_claim_unused_sm(pio, true); // Requisita uma máquina de estado livre no PIO
+
+    pio_sm_config c = ws2812_program_get_default_config(offset);
+    sm_config_set_set_pins(&c, pin, 1);
+    pio_gpio_init(pio, pin);
+    pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+
+    sm_config_set_clkdiv(&c, clock_get_hz(clk_sys) / HAL_WS2812_PIO_HZ);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX); // FIFO de transmissão com 8 posições
+    sm_config_set_out_shift(&c, false, true, 24); // 24 bits GRB, autopull
+    sm_config_set_out_special(&c, true, false, false);
+
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+    return sm;
+}
+
+void hal_ws2812_wait_idle(hal_pio_t pio, uint sm)
+{
+    while (!pio_sm_is_tx_fifo_empty(pio, sm)) tight_loop_contents();
+    busy_wait_us_32(HAL_WS2812_WORD_US);
+}
+
+void hal_ws2812_set_clock(hal_pio_t pio, uint sm)
+{
+    pio_sm_set_clkdiv(pio, sm, clock_get_hz(clk_sys) / HAL_WS2812_PIO_HZ);
+}
+
+hal_spin_lock_t *hal_spin_lock_claim(void)
+{
+    return spin_lock_init(spin_lock_claim_unused(true));
+}
+
+bool hal_serial_readable(void)
+{
+#if LIB_PICO_STDIO_USB
+    if (tud_cdc_connected() && tud_cdc_available()) return true;
+#endif
+#if LIB_PICO_STDIO_UART
+    if (uart_is_readable(uart_default)) return true;
+#endif
+    return false;
+}
+
+size_t hal_serial_try_write(const uint8_t *data, size_t length)
+{
+    size_t sent = 0;
+#if LIB_PICO_STDIO_USB
+    // A tarefa da USB do stdio roda em interrupção neste núcleo: mascaradas, as duas não se cruzam
+    uint32_t status = save_and_disable_interrupts();
+    bool usb = tud_cdc_connected();
+    if (usb)
+    {
+        uint32_t room = tud_cdc_write_available();
+        sent = tud_cdc_write(data, (uint32_t) (length < room ? length : room));
+        tud_cdc_write_flush();
+    }
+    restore_interrupts(status);
+    if (usb) return sent;
+#endif
+#if LIB_PICO_STDIO_UART
+    while (sent < length && uart_is_writable(uart_default)) uart_putc_raw(uart_default, (char) data[sent++]);
+#endif
+    return sent;
+}
+
+/**
+ * @def HAL_FLASH_LOCKOUT_TIMEOUT_MS
+ * @brief Espera máxima para reter o outro núcleo antes de uma operação na flash.
+ */
+#define HAL_FLASH_LOCKOUT_TIMEOUT_MS 100
+
+static void (*hal_core1_entry)(void);
+
+/**
+ * @brief Início do núcleo 1: aceita ser retido em RAM durante operações na flash.
+ */
+static void hal_core1_trampoline(void)
+{
+    flash_safe_execute_core_init();
+    hal_core1_entry();
+}
+
+void hal_core1_launch(void (*entry)(void))
+{
+    hal_core1_entry = entry;
+    multicore_launch_core1(hal_core1_trampoline);
+}
+
+/**
+ * @brief Operação na flash executada por `flash_safe_execute`.
+ */
+typedef struct
+{
+    uint32_t offset;
+    const uint8_t *data; /**< NULL para apagar */
+    uint32_t length;
+} hal_flash_op_t;
+
+static void hal_flash_run_op(void *param)
+{
+    const hal_flash_op_t *op = (const hal_flash_op_t *) param;
+    if (op->data) flash_range_program(op->offset, op->data, op->length);
+    else flash_range_erase(op->offset, op->length);
+}
+
+uint32_t hal_flash_size(void) { return PICO_FLASH_SIZE_BYTES; }
+
+const uint8_t *hal_flash_map(uint32_t offset) { return (const uint8_t *) (uintptr_t) (XIP_BASE + offset); }
+
+bool hal_flash_erase(uint32_t offset, uint32_t length)
+{
+    if ((offset | length) % FLASH_SECTOR_SIZE || offset + length > PICO_FLASH_SIZE_BYTES) return false;
+    hal_flash_op_t op = { offset, NULL, length };
+    return flash_safe_execute(hal_flash_run_op, &op, HAL_FLASH_LOCKOUT_TIMEOUT_MS) == PICO_OK;
+}
+
+bool hal_flash_program(uint32_t offset, const uint8_t *data, uint32_t length)
+{
+    if ((offset | length) % FLASH_PAGE_SIZE || offset + length > PICO_FLASH_SIZE_BYTES) return false;
+    hal_flash_op_t op = { offset, data, length };
+    return flash_safe_execute(hal_flash_run_op, &op, HAL_FLASH_LOCKOUT_TIMEOUT_MS) == PICO_OK;
+}
+
+void hal_cycle_counter_init(void)
+{
+    systick_hw->csr = 0;
+    systick_hw->rvr = 0xFFFFFFu;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // Habilita, fonte = clock do processador, sem interrupção
+}
+
+/**
+ * @brief Passa todos os relógios para o cristal e desliga os PLLs.
+ */
+static void hal_run_from_xosc(void)
+{
+    uint32_t xosc_hz = XOSC_MHZ * MHZ;
+
+    clock_configure(clk_ref, CLOCKS_CLK_REF_CTRL_SRC_VALUE_XOSC_CLKSRC, 0, xosc_hz, xosc_hz);
+    clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLK_REF, 0, xosc_hz, xosc_hz);
+    clock_stop(clk_usb);
+    clock_stop(clk_adc);
+    clock_configure(clk_rtc, 0, CLOCKS_CLK_RTC_CTRL_AUXSRC_VALUE_XOSC_CLKSRC, xosc_hz, 46875);
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS, xosc_hz, xosc_hz);
+    pll_deinit(pll_sys);
+    pll_deinit(pll_usb);
+}
+
+/**
+ * @brief Entra no dormant seguindo a sequência do datasheet do RP2040 (seção 2.11.5).
+ */
+void hal_dormant_until_gpio(uint32_t gpio_mask, uint32_t sys_khz)
+{
+    uint gpio;
+
+    hal_run_from_xosc();
+
+    for (gpio = 0; gpio < 32; gpio++)
+    {
+        if (gpio_mask & (1u << gpio)) gpio_set_dormant_irq_enabled(gpio, GPIO_IRQ_EDGE_FALL, true);
+    }
+
+    xosc_dormant(); // Retorna apenas quando um dos GPIOs acordar o cristal
+
+    for (gpio = 0; gpio < 32; gpio++)
+    {
+        if (gpio_mask & (1u << gpio)) gpio_set_dormant_irq_enabled(gpio, GPIO_IRQ_EDGE_FALL, false);
+    }
+
+    // Restaura a árvore de relógios padrão (PLLs, USB, ADC) e a frequência do jogo
+    clocks_init();
+    hal_set_sys_clock_khz(sys_khz, true);
+}
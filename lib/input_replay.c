@@ -0,0 +1,237 @@
+#include "input_replay.h"
+#include <string.h>
+
+/**
+ * @file input_replay.c
+ * @brief Codificação em varints dos eventos de entrada de uma partida.
+ *
+ * Cada evento começa por um varint com (quadros desde o evento anterior << 2)
+ * | tipo. Um cursor acrescenta os deslocamentos em X e Y como varints zigzag
+ * (0, -1, 1, -2... viram 0, 1, 2, 3...), de modo que movimentos pequenos
+ * ocupam um byte por eixo; um botão acrescenta o pino e o tipo do evento.
+ * Em um quadro parado nada é gravado.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @def REPLAY_MAX_EVENT_BYTES
+ * @brief Maior evento codificado: varint de 32 bits + dois varints de 9 bits.
+ */
+#define REPLAY_MAX_EVENT_BYTES 9
+
+/**
+ * @def REPLAY_TYPE_BITS
+ * @brief Bits do tipo no primeiro varint do evento.
+ */
+#define REPLAY_TYPE_BITS 2
+
+static void put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) p[i] = (uint8_t) (value >> (8 * i));
+}
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint32_t) p[i] << (8 * i);
+    return value;
+}
+
+static size_t put_varint(uint8_t *p, uint32_t value)
+{
+    size_t n = 0;
+    while (value >= 0x80)
+    {
+        p[n++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    p[n++] = (uint8_t) value;
+    return n;
+}
+
+/**
+ * @brief Lê um varint de até 32 bits.
+ *
+ * @return Posição após o varint, ou 0 se ele ultrapassar `end`.
+ */
+static size_t get_varint(const uint8_t *data, size_t pos, size_t end, uint32_t *value)
+{
+    uint32_t v = 0;
+    for (int shift = 0; shift < 35 && pos < end; shift += 7)
+    {
+        uint8_t byte = data[pos++];
+        v |= (uint32_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            *value = v;
+            return pos;
+        }
+    }
+    return 0;
+}
+
+static inline uint32_t zigzag(int32_t v) { return ((uint32_t) v << 1) ^ (uint32_t) (v >> 31); }
+
+static inline int32_t unzigzag(uint32_t v) { return (int32_t) (v >> 1) ^ -(int32_t) (v & 1); }
+
+/**
+ * @brief Grava o início comum de todos os eventos, reservando espaço para o maior deles.
+ *
+ * @return Ponteiro para a escrita do restante do evento, ou NULL se não couber.
+ */
+static uint8_t *replay_begin_event(replay_recorder_t *rec, uint32_t frame, replay_event_type_t type)
+{
+    if (rec->finished || rec->truncated) return NULL;
+    if (rec->capacity - rec->length < REPLAY_MAX_EVENT_BYTES)
+    {
+        rec->truncated = true;
+        return NULL;
+    }
+    uint32_t delta = frame - rec->last_frame;
+    rec->last_frame = frame;
+    uint8_t *p = rec->buffer + rec->length;
+    return p + put_varint(p, (delta << REPLAY_TYPE_BITS) | (uint32_t) type);
+}
+
+bool replay_recorder_init(replay_recorder_t *rec, uint8_t *buffer, size_t capacity, uint32_t frame_period_us)
+{
+    memset(rec, 0, sizeof(*rec));
+    if (capacity < REPLAY_HEADER_BYTES) return false;
+    rec->buffer = buffer;
+    rec->capacity = capacity;
+    rec->length = REPLAY_HEADER_BYTES;
+    memset(buffer, 0, REPLAY_HEADER_BYTES);
+    memcpy(buffer, REPLAY_MAGIC, 4);
+    buffer[4] = REPLAY_VERSION;
+    put_le(buffer + 8, frame_period_us, 4);
+    return true;
+}
+
+bool replay_record_cursor(replay_recorder_t *rec, uint32_t frame, uint8_t x, uint8_t y)
+{
+    uint8_t *p = replay_begin_event(rec, frame, REPLAY_EVENT_CURSOR);
+    if (!p) return false;
+    p += put_varint(p, zigzag((int32_t) x - rec->last_x));
+    p += put_varint(p, zigzag((int32_t) y - rec->last_y));
+    rec->last_x = x;
+    rec->last_y = y;
+    rec->length = (size_t) (p - rec->buffer);
+    return true;
+}
+
+bool replay_record_button(replay_recorder_t *rec, uint32_t frame, uint8_t gpio, uint8_t button_event)
+{
+    uint8_t *p = replay_begin_event(rec, frame, REPLAY_EVENT_BUTTON);
+    if (!p) return false;
+    *p++ = gpio;
+    *p++ = button_event;
+    rec->length = (size_t) (p - rec->buffer);
+    return true;
+}
+
+size_t replay_record_end(replay_recorder_t *rec, uint32_t frame, uint16_t score, uint32_t framebuffer_hash)
+{
+    if (rec->finished) return rec->length;
+    uint8_t *p = replay_begin_event(rec, frame, REPLAY_EVENT_END);
+    if (p) rec->length = (size_t) (p - rec->buffer);
+    rec->finished = true;
+
+    uint8_t *h = rec->buffer;
+    h[5] = rec->truncated ? REPLAY_FLAG_TRUNCATED : 0;
+    put_le(h + 12, frame, 4);
+    put_le(h + 16, (uint32_t) (rec->length - REPLAY_HEADER_BYTES), 4);
+    put_le(h + 20, framebuffer_hash, 4);
+    put_le(h + 24, score, 2);
+    return rec->length;
+}
+
+bool replay_player_init(replay_player_t *player, const uint8_t *data, size_t length)
+{
+    memset(player, 0, sizeof(*player));
+    if (length < REPLAY_HEADER_BYTES || memcmp(data, REPLAY_MAGIC, 4) != 0 || data[4] != REPLAY_VERSION) return false;
+
+    uint32_t events = get_le(data + 16, 4);
+    if (events > length - REPLAY_HEADER_BYTES) return false;
+
+    player->data = data;
+    player->length = REPLAY_HEADER_BYTES + events;
+    player->pos = REPLAY_HEADER_BYTES;
+    player->summary.flags = data[5];
+    player->summary.frame_period_us = get_le(data + 8, 4);
+    player->summary.frames = get_le(data + 12, 4);
+    player->summary.framebuffer_hash = get_le(data + 20, 4);
+    player->summary.score = (uint16_t) get_le(data + 24, 2);
+    return true;
+}
+
+bool replay_next(replay_player_t *player, uint32_t frame, replay_event_t *event)
+{
+    uint32_t head, dx, dy;
+    size_t pos;
+
+    if (player->pos >= player->length || !(pos = get_varint(player->data, player->pos, player->length, &head)))
+    {
+        // Gravação truncada ou corrompida: encerra no último quadro registrado
+        if (player->pos == SIZE_MAX || frame < player->summary.frames) return false;
+        player->pos = SIZE_MAX;
+        event->frame = player->summary.frames;
+        event->type = REPLAY_EVENT_END;
+        return true;
+    }
+
+    uint32_t event_frame = player->frame + (head >> REPLAY_TYPE_BITS);
+    if (event_frame > frame) return false; // Ainda não chegou o quadro do evento
+
+    event->frame = event_frame;
+    event->type = (replay_event_type_t) (head & ((1u << REPLAY_TYPE_BITS) - 1));
+    switch (event->type)
+    {
+    case REPLAY_EVENT_CURSOR:
+        if (!(pos = get_varint(player->data, pos, player->length, &dx)) ||
+            !(pos = get_varint(player->data, pos, player->length, &dy)))
+        {
+            player->pos = player->length; // Evento incompleto: trata como fim dos dados
+            return false;
+        }
+        player->x = (uint8_t) (player->x + unzigzag(dx));
+        player->y = (uint8_t) (player->y + unzigzag(dy));
+        event->x = player->x;
+        event->y = player->y;
+        break;
+    case REPLAY_EVENT_BUTTON:
+        if (pos + 2 > player->length)
+        {
+            player->pos = player->length;
+            return false;
+        }
+        event->gpio = player->data[pos];
+        event->button_event = player->data[pos + 1];
+        pos += 2;
+        break;
+    case REPLAY_EVENT_END:
+        pos = SIZE_MAX; // Nada é lido depois do fim
+        break;
+    default:
+        player->pos = player->length;
+        return false;
+    }
+    player->frame = event_frame;
+    player->pos = pos;
+    return true;
+}
+
+uint32_t replay_hash(const uint8_t *data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,209 @@
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file input_replay.h
+ * @brief Gravação compacta e reprodução determinística da entrada de uma partida.
+ *
+ * Durante a partida, o gravador registra, por número de quadro, as posições do
+ * cursor (já convertidas para a tela, portanto independentes da calibração do
+ * joystick), os eventos de botão e o fim da partida. Cada evento ocupa poucos
+ * bytes: o intervalo em quadros desde o evento anterior e o tipo vão em um
+ * varint, e o deslocamento do cursor em dois varints zigzag. O cabeçalho guarda
+ * o período do quadro, a pontuação e um hash do framebuffer final, permitindo
+ * conferir que a reprodução chegou ao mesmo resultado byte a byte.
+ *
+ * O módulo não depende do Pico SDK e é compilado também no host.
+ *
+ * Formato (little-endian):
+ *     "ERP1" | versão u8 | flags u8 | reservado u16 | período_us u32 |
+ *     quadros u32 | bytes_de_eventos u32 | hash u32 | pontuação u16 |
+ *     reservado u16 | eventos...
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Input_Replay Gravação e Reprodução de Partidas
+ * @brief Entrada reproduzível para conferir pontuações e medir a renderização.
+ * @{
+ */
+
+/**
+ * @def REPLAY_MAGIC
+ * @brief Marca de início de uma gravação.
+ */
+#define REPLAY_MAGIC "ERP1"
+
+/**
+ * @def REPLAY_VERSION
+ * @brief Versão do formato.
+ */
+#define REPLAY_VERSION 1
+
+/**
+ * @def REPLAY_HEADER_BYTES
+ * @brief Tamanho do cabeçalho, em bytes.
+ */
+#define REPLAY_HEADER_BYTES 28
+
+/**
+ * @def REPLAY_FLAG_TRUNCATED
+ * @brief A gravação encheu o buffer; a reprodução termina antes da partida original.
+ */
+#define REPLAY_FLAG_TRUNCATED 0x01
+
+/**
+ * @brief Tipos de evento gravados.
+ */
+typedef enum
+{
+    REPLAY_EVENT_CURSOR, /**< Nova posição do cursor */
+    REPLAY_EVENT_BUTTON, /**< Evento de botão (`pb_event_type_t`) */
+    REPLAY_EVENT_END     /**< Fim da partida */
+} replay_event_type_t;
+
+/**
+ * @brief Evento decodificado.
+ */
+typedef struct
+{
+    uint32_t frame;           /**< Quadro em que o evento ocorreu */
+    replay_event_type_t type; /**< Tipo do evento */
+    uint8_t x;                /**< Cursor: coordenada X */
+    uint8_t y;                /**< Cursor: coordenada Y */
+    uint8_t gpio;             /**< Botão: pino */
+    uint8_t button_event;     /**< Botão: tipo do evento */
+} replay_event_t;
+
+/**
+ * @brief Dados do cabeçalho de uma gravação.
+ */
+typedef struct
+{
+    uint32_t frame_period_us;  /**< Período do quadro da partida gravada */
+    uint32_t frames;           /**< Quadros até o fim da partida */
+    uint32_t framebuffer_hash; /**< Hash (`replay_hash`) do framebuffer final */
+    uint16_t score;            /**< Pontuação final (pixels restantes) */
+    uint8_t flags;             /**< `REPLAY_FLAG_*` */
+} replay_summary_t;
+
+/**
+ * @brief Estado do gravador.
+ */
+typedef struct
+{
+    uint8_t *buffer;      /**< Destino (cabeçalho + eventos) */
+    size_t capacity;      /**< Tamanho do destino */
+    size_t length;        /**< Bytes usados, incluindo o cabeçalho */
+    uint32_t last_frame;  /**< Quadro do último evento */
+    uint8_t last_x;       /**< Última posição gravada do cursor */
+    uint8_t last_y;
+    bool truncated;       /**< O buffer encheu e eventos foram descartados */
+    bool finished;        /**< `replay_record_end` já foi chamada */
+} replay_recorder_t;
+
+/**
+ * @brief Estado do reprodutor.
+ */
+typedef struct
+{
+    const uint8_t *data;      /**< Gravação completa */
+    size_t length;            /**< Fim dos eventos */
+    size_t pos;               /**< Próximo evento */
+    uint32_t frame;           /**< Quadro do último evento lido */
+    uint8_t x;                /**< Última posição do cursor */
+    uint8_t y;
+    replay_summary_t summary; /**< Cabeçalho da gravação */
+} replay_player_t;
+
+/**
+ * @brief Inicia uma gravação.
+ *
+ * @param[out] rec Gravador.
+ * @param[in] buffer Destino; deve ter ao menos `REPLAY_HEADER_BYTES` bytes.
+ * @param[in] capacity Tamanho do destino.
+ * @param[in] frame_period_us Período do quadro da partida.
+ * @return `false` se o destino for pequeno demais.
+ */
+bool replay_recorder_init(replay_recorder_t *rec, uint8_t *buffer, size_t capacity, uint32_t frame_period_us);
+
+/**
+ * @brief Grava uma nova posição do cursor.
+ *
+ * @param[in,out] rec Gravador.
+ * @param[in] frame Quadro atual (não decrescente).
+ * @param[in] x Coordenada X.
+ * @param[in] y Coordenada Y.
+ * @return `false` se o buffer estiver cheio (a gravação fica truncada).
+ */
+bool replay_record_cursor(replay_recorder_t *rec, uint32_t frame, uint8_t x, uint8_t y);
+
+/**
+ * @brief Grava um evento de botão.
+ *
+ * @param[in,out] rec Gravador.
+ * @param[in] frame Quadro atual (não decrescente).
+ * @param[in] gpio Pino do botão.
+ * @param[in] button_event Tipo do evento (`pb_event_type_t`).
+ * @return `false` se o buffer estiver cheio (a gravação fica truncada).
+ */
+bool replay_record_button(replay_recorder_t *rec, uint32_t frame, uint8_t gpio, uint8_t button_event);
+
+/**
+ * @brief Grava o fim da partida e completa o cabeçalho.
+ *
+ * @param[in,out] rec Gravador.
+ * @param[in] frame Quadro em que a partida terminou.
+ * @param[in] score Pontuação final.
+ * @param[in] framebuffer_hash Hash do framebuffer final (`replay_hash`).
+ * @return Tamanho final da gravação, em bytes.
+ */
+size_t replay_record_end(replay_recorder_t *rec, uint32_t frame, uint16_t score, uint32_t framebuffer_hash);
+
+/**
+ * @brief Abre uma gravação para reprodução.
+ *
+ * @param[out] player Reprodutor.
+ * @param[in] data Gravação (deve permanecer válida durante a reprodução).
+ * @param[in] length Tamanho disponível em `data`.
+ * @return `false` se o cabeçalho for inválido ou os eventos não couberem em `length`.
+ */
+bool replay_player_init(replay_player_t *player, const uint8_t *data, size_t length);
+
+/**
+ * @brief Lê o próximo evento previsto até o quadro informado.
+ *
+ * Deve ser chamada em laço a cada quadro, até retornar `false`. Ao fim dos
+ * eventos (inclusive em gravações truncadas) gera um `REPLAY_EVENT_END` no
+ * último quadro gravado.
+ *
+ * @param[in,out] player Reprodutor.
+ * @param[in] frame Quadro atual.
+ * @param[out] event Evento lido.
+ * @return `true` se um evento foi lido.
+ */
+bool replay_next(replay_player_t *player, uint32_t frame, replay_event_t *event);
+
+/**
+ * @brief Hash FNV-1a de 32 bits, usado para comparar framebuffers.
+ *
+ * @param[in] data Dados.
+ * @param[in] length Tamanho, em bytes.
+ * @return Hash.
+ */
+uint32_t replay_hash(const uint8_t *data, size_t length);
+
+/** @} */ // Fim do grupo "Input_Replay"
+
+#endif // INPUT_REPLAY_H
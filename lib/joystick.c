@@ -1,6 +1,6 @@
 #include "joystick.h"
 #include "push_button.h"
-#include "hardware/adc.h"
+#include <stddef.h>
 
 /**
  * @file joystick.c
@@ -17,6 +17,26 @@
  * Copyright (C) 2025 Carlos Valadão
  */
 
+/**
+ * @brief Ring buffer de amostras do ADC escrito continuamente pela HAL (DMA no RP2040).
+ *
+ * Deve estar alinhado ao próprio tamanho para que o "ring" de escrita do DMA
+ * volte ao início do buffer automaticamente.
+ */
+static volatile uint16_t joystick_adc_ring[JOYSTICK_RING_LEN] __attribute__((aligned(1u << JOYSTICK_RING_BITS)));
+
+/**
+ * @def JOYSTICK_CAL_SAMPLE_MS
+ * @brief Intervalo entre leituras durante a rotina de calibração.
+ */
+#define JOYSTICK_CAL_SAMPLE_MS 5
+
+/**
+ * @def JOYSTICK_CAL_DEADZONE_MARGIN
+ * @brief Margem somada ao ruído medido em repouso ao calcular a zona morta (escala de 14 bits).
+ */
+#define JOYSTICK_CAL_DEADZONE_MARGIN 64
+
 /**
  * @defgroup Joystick Funções do Joystick
  * @brief Grupo de funções relacionadas ao controle do joystick.
@@ -48,6 +68,23 @@ static uint8_t adc_gpio_to_channel_num(uint8_t gpio) {
     }
 }
 
+/**
+ * @brief Coloca o ADC em execução contínua copiando para o ring buffer.
+ *
+ * Os dois eixos são convertidos em round-robin e a HAL copia cada conversão
+ * para o ring (no RP2040, por dois canais de DMA encadeados), de modo que a
+ * amostragem nunca para e a CPU nunca é interrompida.
+ *
+ * @param[in,out] joy Ponteiro para a estrutura do joystick.
+ */
+static void joystick_start_sampling(joystick_t *joy)
+{
+    uint8_t first_channel = (joy->channel_x < joy->channel_y) ? joy->channel_x : joy->channel_y;
+
+    hal_adc_stream_init((uint8_t) ((1u << joy->channel_x) | (1u << joy->channel_y)), first_channel,
+                        JOYSTICK_SAMPLE_RATE_HZ, joystick_adc_ring, JOYSTICK_RING_BITS);
+}
+
 /**
  * @brief Inicializa o joystick configurando os pinos e a estrutura.
  *
@@ -57,8 +94,6 @@ static uint8_t adc_gpio_to_channel_num(uint8_t gpio) {
  * @note Esta função deve ser chamada antes de realizar qualquer leitura do joystick.
  * @warning Se os pinos forem configurados incorretamente, o joystick não funcionará como esperado.
  *
- * @todo Implementar a configuração dos pinos e ADC.
- *
  * @param[in,out] joy Ponteiro para a estrutura do joystick que será inicializada.
  * @param[in] joy_vrx Canal ADC correspondente ao eixo X.
  * @param[in] joy_vry Canal ADC correspondente ao eixo Y.
@@ -66,9 +101,8 @@ static uint8_t adc_gpio_to_channel_num(uint8_t gpio) {
  */
 void joystick_init_all(joystick_t *joy, uint8_t joy_vrx, uint8_t joy_vry, uint8_t joy_pbutton, uint8_t deadzone)
 {
-    adc_init();
-    adc_gpio_init(joy_vrx);
-    adc_gpio_init(joy_vry);
+    hal_adc_gpio_init(joy_vrx);
+    hal_adc_gpio_init(joy_vry);
     pb_config(joy_pbutton, true);
     uint8_t joy_vrx_channel = adc_gpio_to_channel_num(joy_vrx);
     uint8_t joy_vry_channel = adc_gpio_to_channel_num(joy_vry);
@@ -76,13 +110,41 @@ void joystick_init_all(joystick_t *joy, uint8_t joy_vrx, uint8_t joy_vry, uint8_
     joy->channel_y = joy_vry_channel;
     joy->joy_push_button = joy_pbutton;
     joy->deadzone = (uint8_t) (deadzone);
+    // O round-robin começa pelo canal selecionado (o menor) e segue em ordem crescente
+    joy->slot_x = (joy_vrx_channel > joy_vry_channel) ? 1 : 0;
+    joy->slot_y = (uint8_t) (1 - joy->slot_x);
+    joy->ring = joystick_adc_ring;
+    one_euro_params_default(&joy->filter_params);
+    one_euro_reset(&joy->filter_x);
+    one_euro_reset(&joy->filter_y);
+    joystick_start_sampling(joy);
+}
+
+/**
+ * @brief Soma as amostras de um eixo presentes no ring buffer e decima o resultado.
+ *
+ * O ring sempre contém as `JOYSTICK_RING_LEN / 2` conversões mais recentes de
+ * cada eixo, então a soma tem custo constante e dispensa qualquer espera.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[in] slot Paridade das posições do eixo no ring (0 ou 1).
+ * @return Valor do eixo de 0 a `JOYSTICK_ADC_MAX`.
+ */
+static uint16_t joystick_read_oversampled(const joystick_t *joy, uint8_t slot)
+{
+    uint32_t sum = 0;
+    for (uint8_t i = slot; i < JOYSTICK_RING_LEN; i += 2)
+    {
+        sum += joy->ring[i];
+    }
+    return (uint16_t) (sum >> JOYSTICK_OVERSAMPLE_SHIFT);
 }
 
-static uint16_t joystick_read_filtered(uint8_t channel, uint8_t deadzone)
+static uint16_t joystick_read_filtered(const joystick_t *joy, uint8_t slot)
 {
-    adc_select_input(channel);
-    uint16_t raw_value = adc_read(); // Leitura do ADC
-    uint16_t center = 2048; // Centro do joystick em um ADC de 12 bits
+    uint16_t raw_value = joystick_read_oversampled(joy, slot);
+    uint16_t center = JOYSTICK_ADC_CENTER; // Centro do joystick na escala de 14 bits
+    uint16_t deadzone = (uint16_t) joy->deadzone << 2; // A deadzone é dada na escala de 12 bits
     // Se estiver dentro da deadzone, retorna o centro para evitar ruído
     if (raw_value > (center - deadzone) && raw_value < (center + deadzone))
     {
@@ -94,34 +156,34 @@ static uint16_t joystick_read_filtered(uint8_t channel, uint8_t deadzone)
 /**
  * @brief Obtém o valor do eixo X do joystick.
  *
- * Esta função realiza a leitura do canal ADC correspondente ao eixo X do joystick.
+ * Esta função soma as amostras mais recentes do eixo X já copiadas pelo DMA
+ * (oversampling) e as decima para 14 bits, sem acessar o ADC diretamente.
  * O valor retornado pode ser normalizado para ser usado na interface gráfica.
  *
  * @note O ADC deve estar corretamente inicializado antes da leitura.
- * @todo Implementar a leitura real do ADC.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return Valor do ADC correspondente ao eixo X (exemplo: 0 - 4095 em ADC de 12 bits).
+ * @return Valor do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
  */
 uint16_t joystick_get_x(const joystick_t *joy)
 {
-    return joystick_read_filtered(joy->channel_x, joy->deadzone);
+    return joystick_read_filtered(joy, joy->slot_x);
 }
 
 /**
  * @brief Obtém o valor do eixo Y do joystick.
  *
- * Esta função realiza a leitura do canal ADC correspondente ao eixo Y do joystick.
+ * Esta função soma as amostras mais recentes do eixo Y já copiadas pelo DMA
+ * (oversampling) e as decima para 14 bits, sem acessar o ADC diretamente.
  *
  * @note O ADC deve estar corretamente inicializado antes da leitura.
- * @todo Implementar a leitura real do ADC.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return Valor do ADC correspondente ao eixo Y (exemplo: 0 - 4095 em ADC de 12 bits).
+ * @return Valor do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
  */
 uint16_t joystick_get_y(const joystick_t *joy)
 {
-    return joystick_read_filtered(joy->channel_y, joy->deadzone);
+    return joystick_read_filtered(joy, joy->slot_y);
 }
 
 /**
@@ -131,32 +193,95 @@ uint16_t joystick_get_y(const joystick_t *joy)
  * Se o botão estiver pressionado, a função retorna `true`, caso contrário, retorna `false`.
  *
  * @note O pino do botão deve ser configurado corretamente como entrada digital com pull-up ativado.
- * @todo Implementar a leitura real do botão.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
  * @return `true` se o botão estiver pressionado, `false` caso contrário.
  */
 bool joystick_get_button(const joystick_t *joy)
 {
-    return false; // TODO: Implementar leitura do botão
+    return pb_is_button_pressed(joy->joy_push_button);
+}
+
+/**
+ * @brief Calcula a amplitude (máximo - mínimo) das amostras brutas de um eixo no ring.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[in] slot Paridade das posições do eixo no ring (0 ou 1).
+ * @return Amplitude na escala de 12 bits do ADC.
+ */
+static uint16_t joystick_window_spread(const joystick_t *joy, uint8_t slot)
+{
+    uint16_t lo = UINT16_MAX, hi = 0;
+    for (uint8_t i = slot; i < JOYSTICK_RING_LEN; i += 2)
+    {
+        uint16_t v = joy->ring[i];
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    return hi - lo;
+}
+
+/**
+ * @brief Verifica se o filtro de um eixo ainda está longe da leitura atual.
+ *
+ * @param[in] state Estado do filtro do eixo.
+ * @param[in] value Leitura atual com oversampling.
+ * @return `true` se a diferença exceder `JOYSTICK_MOTION_SETTLE`.
+ */
+static bool joystick_filter_settling(const one_euro_state_t *state, uint16_t value)
+{
+    if (!state->primed) return true;
+    int32_t diff = (int32_t) value - (state->value_q4 >> 4);
+    return (diff > JOYSTICK_MOTION_SETTLE || diff < -JOYSTICK_MOTION_SETTLE);
 }
 
 /**
- * @brief Verifica se o joystick está se movendo além da deadzone.
+ * @brief Verifica se o joystick está em movimento (ou se o cursor ainda vai se mover).
  *
- * Esta função compara o valor lido dos eixos X e Y com a deadzone definida
- * para determinar se há um movimento significativo.
+ * Dois critérios são combinados para cada eixo:
+ *  - janela: a amplitude das amostras brutas no ring (os últimos ~2 ms)
+ *    excede `JOYSTICK_MOTION_WINDOW`, o que detecta movimentos rápidos;
+ *  - limiar: a leitura com oversampling se afasta da saída do filtro
+ *    adaptativo em mais de `JOYSTICK_MOTION_SETTLE`, o que detecta movimentos
+ *    lentos e o período em que o filtro ainda está convergindo.
  *
- * @note A deadzone deve estar configurada corretamente para evitar detecção de ruídos.
- * @warning Se a deadzone for muito alta, pequenos movimentos podem ser ignorados.
- * @todo Implementar a verificação de movimento baseada na deadzone.
+ * Quando a função retorna `false`, a saída de `joystick_read_smoothed` não
+ * mudaria, e o laço principal pode dormir sem ler o joystick.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return `true` se o joystick estiver fora da deadzone, `false` caso contrário.
+ * @return `true` se houver movimento, `false` caso contrário.
  */
 bool joystick_is_moving(const joystick_t *joy)
 {
-    return false; // TODO: Implementar detecção de movimento
+    if (joystick_window_spread(joy, joy->slot_x) > JOYSTICK_MOTION_WINDOW) return true;
+    if (joystick_window_spread(joy, joy->slot_y) > JOYSTICK_MOTION_WINDOW) return true;
+    return joystick_filter_settling(&joy->filter_x, joystick_read_oversampled(joy, joy->slot_x)) ||
+           joystick_filter_settling(&joy->filter_y, joystick_read_oversampled(joy, joy->slot_y));
+}
+
+/**
+ * @brief Suspende as conversões do ADC (e, com isso, as transferências do DMA).
+ *
+ * No RP2040 o canal DMA permanece armado aguardando o DREQ do ADC, portanto
+ * não há tráfego no barramento enquanto o joystick estiver pausado.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ */
+void joystick_pause(const joystick_t *joy)
+{
+    (void) joy;
+    hal_adc_stream_run(false);
+}
+
+/**
+ * @brief Retoma as conversões do ADC após `joystick_pause`.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ */
+void joystick_resume(const joystick_t *joy)
+{
+    (void) joy;
+    hal_adc_stream_run(true);
 }
 
 /**
@@ -176,4 +301,221 @@ void joystick_set_deadzone(joystick_t *joy, uint8_t deadzone_value)
     joy->deadzone = deadzone_value;
 }
 
+/**
+ * @brief Lê os dois eixos sem aplicar a zona morta.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] x Valor do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
+ * @param[out] y Valor do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
+ */
+void joystick_read_raw(const joystick_t *joy, uint16_t *x, uint16_t *y)
+{
+    *x = joystick_read_oversampled(joy, joy->slot_x);
+    *y = joystick_read_oversampled(joy, joy->slot_y);
+}
+
+/**
+ * @brief Lê os dois eixos passando pelo filtro adaptativo One-Euro.
+ *
+ * @param[in,out] joy Ponteiro para a estrutura do joystick.
+ * @param[in] now_us Instante da leitura em microssegundos.
+ * @param[out] x Valor filtrado do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
+ * @param[out] y Valor filtrado do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
+ */
+void joystick_read_smoothed(joystick_t *joy, uint32_t now_us, uint16_t *x, uint16_t *y)
+{
+    *x = one_euro_filter(&joy->filter_x, &joy->filter_params, joystick_read_oversampled(joy, joy->slot_x), now_us);
+    *y = one_euro_filter(&joy->filter_y, &joy->filter_params, joystick_read_oversampled(joy, joy->slot_y), now_us);
+}
+
+/**
+ * @brief Ajusta os parâmetros do filtro adaptativo e reinicia seu estado.
+ *
+ * @param[in,out] joy Ponteiro para a estrutura do joystick.
+ * @param[in] params Novos parâmetros do filtro.
+ */
+void joystick_set_filter_params(joystick_t *joy, const one_euro_params_t *params)
+{
+    joy->filter_params = *params;
+    one_euro_reset(&joy->filter_x);
+    one_euro_reset(&joy->filter_y);
+}
+
+/**
+ * @brief Calcula o checksum (Fletcher-16) dos campos de um perfil de calibração.
+ *
+ * @param[in] cal Perfil de calibração.
+ * @return Checksum de todos os bytes anteriores ao campo `checksum`.
+ */
+static uint16_t joystick_calibration_checksum(const joystick_calibration_t *cal)
+{
+    const uint8_t *bytes = (const uint8_t *) cal;
+    uint16_t sum1 = 0, sum2 = 0;
+    for (size_t i = 0; i < offsetof(joystick_calibration_t, checksum); i++)
+    {
+        sum1 = (uint16_t) ((sum1 + bytes[i]) % 255u);
+        sum2 = (uint16_t) ((sum2 + sum1) % 255u);
+    }
+    return (uint16_t) ((sum2 << 8) | sum1);
+}
+
+/**
+ * @brief Calcula e grava o checksum de um perfil de calibração.
+ *
+ * @param[in,out] cal Perfil a ser selado.
+ */
+void joystick_calibration_seal(joystick_calibration_t *cal)
+{
+    cal->magic = JOYSTICK_CALIBRATION_MAGIC;
+    cal->version = JOYSTICK_CALIBRATION_VERSION;
+    cal->reserved = 0;
+    cal->checksum = joystick_calibration_checksum(cal);
+}
+
+/**
+ * @brief Verifica se um perfil de calibração é válido.
+ *
+ * @param[in] cal Perfil a ser verificado.
+ * @return `true` se assinatura, versão, checksum e faixas forem coerentes.
+ */
+bool joystick_calibration_is_valid(const joystick_calibration_t *cal)
+{
+    if (cal->magic != JOYSTICK_CALIBRATION_MAGIC || cal->version != JOYSTICK_CALIBRATION_VERSION) return false;
+    if (cal->checksum != joystick_calibration_checksum(cal)) return false;
+    // O centro precisa ficar estritamente entre os extremos, senão a interpolação divide por zero
+    return (cal->min_x < cal->center_x && cal->center_x < cal->max_x && cal->max_x <= JOYSTICK_ADC_MAX &&
+            cal->min_y < cal->center_y && cal->center_y < cal->max_y && cal->max_y <= JOYSTICK_ADC_MAX);
+}
+
+/**
+ * @brief Preenche um perfil de calibração com os valores nominais do joystick.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] cal Perfil a ser preenchido (já selado).
+ */
+void joystick_calibration_default(const joystick_t *joy, joystick_calibration_t *cal)
+{
+    cal->deadzone = (uint16_t) joy->deadzone << 2; // A deadzone é dada na escala de 12 bits
+    cal->min_x = 0;
+    cal->center_x = JOYSTICK_ADC_CENTER;
+    cal->max_x = JOYSTICK_ADC_MAX;
+    cal->min_y = 0;
+    cal->center_y = JOYSTICK_ADC_CENTER;
+    cal->max_y = JOYSTICK_ADC_MAX;
+    joystick_calibration_seal(cal);
+}
+
+/**
+ * @brief Primeira fase da calibração: joystick solto, mede centro e ruído.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] cal Perfil com centro e zona morta (sem os extremos; ainda não selado).
+ * @param[in] rest_ms Duração da fase em milissegundos.
+ */
+void joystick_calibrate_rest(const joystick_t *joy, joystick_calibration_t *cal, uint16_t rest_ms)
+{
+    uint16_t x, y;
+    uint16_t lo_x = UINT16_MAX, hi_x = 0, lo_y = UINT16_MAX, hi_y = 0;
+    uint32_t sum_x = 0, sum_y = 0, samples = 0;
+
+    for (uint16_t t = 0; t < rest_ms; t += JOYSTICK_CAL_SAMPLE_MS)
+    {
+        joystick_read_raw(joy, &x, &y);
+        sum_x += x;
+        sum_y += y;
+        samples++;
+        if (x < lo_x) lo_x = x;
+        if (x > hi_x) hi_x = x;
+        if (y < lo_y) lo_y = y;
+        if (y > hi_y) hi_y = y;
+        hal_sleep_ms(JOYSTICK_CAL_SAMPLE_MS);
+    }
+    if (samples == 0)
+    {
+        joystick_calibration_default(joy, cal);
+        return;
+    }
+    cal->center_x = (uint16_t) (sum_x / samples);
+    cal->center_y = (uint16_t) (sum_y / samples);
+    uint16_t spread = hi_x - lo_x;
+    if ((uint16_t) (hi_y - lo_y) > spread) spread = hi_y - lo_y;
+    cal->deadzone = (uint16_t) (spread * 3u / 2u + JOYSTICK_CAL_DEADZONE_MARGIN);
+}
+
+/**
+ * @brief Segunda fase da calibração: varredura até os batentes, registra os extremos.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[in,out] cal Perfil com o centro de `joystick_calibrate_rest`; sai completo e selado.
+ * @param[in] sweep_ms Duração da fase em milissegundos.
+ */
+void joystick_calibrate_sweep(const joystick_t *joy, joystick_calibration_t *cal, uint16_t sweep_ms)
+{
+    uint16_t x, y;
+    uint16_t lo_x = UINT16_MAX, hi_x = 0, lo_y = UINT16_MAX, hi_y = 0;
+
+    for (uint16_t t = 0; t < sweep_ms; t += JOYSTICK_CAL_SAMPLE_MS)
+    {
+        joystick_read_raw(joy, &x, &y);
+        if (x < lo_x) lo_x = x;
+        if (x > hi_x) hi_x = x;
+        if (y < lo_y) lo_y = y;
+        if (y > hi_y) hi_y = y;
+        hal_sleep_ms(JOYSTICK_CAL_SAMPLE_MS);
+    }
+    // Recolhe os extremos em 1/32 da meia-faixa para que as bordas da tela sejam alcançáveis
+    cal->min_x = (lo_x < cal->center_x) ? lo_x + (cal->center_x - lo_x) / 32u : 0;
+    cal->max_x = (hi_x > cal->center_x) ? hi_x - (hi_x - cal->center_x) / 32u : JOYSTICK_ADC_MAX;
+    cal->min_y = (lo_y < cal->center_y) ? lo_y + (cal->center_y - lo_y) / 32u : 0;
+    cal->max_y = (hi_y > cal->center_y) ? hi_y - (hi_y - cal->center_y) / 32u : JOYSTICK_ADC_MAX;
+    joystick_calibration_seal(cal);
+}
+
+/**
+ * @brief Preenche a tabela de um eixo com a interpolação por partes da calibração.
+ *
+ * @param[out] table Tabela de `JOYSTICK_MAP_LEN` entradas.
+ * @param[in] min Mínimo calibrado do eixo.
+ * @param[in] center Centro calibrado do eixo.
+ * @param[in] max Máximo calibrado do eixo.
+ * @param[in] lo Coordenada para o mínimo.
+ * @param[in] hi Coordenada para o máximo.
+ */
+static void joystick_map_build_axis(uint8_t *table, uint16_t min, uint16_t center, uint16_t max, uint8_t lo, uint8_t hi)
+{
+    int32_t mid = ((int32_t) lo + hi) / 2;
+    for (uint32_t i = 0; i < JOYSTICK_MAP_LEN; i++)
+    {
+        // Valor central do intervalo de leituras que cai nesta entrada
+        int32_t v = (int32_t) ((i << (14 - JOYSTICK_MAP_BITS)) + (1u << (13 - JOYSTICK_MAP_BITS)));
+        int32_t out;
+        if (v <= min) out = lo;
+        else if (v >= max) out = hi;
+        else if (v < center) out = lo + ((mid - lo) * (v - min)) / ((int32_t) center - min);
+        else out = mid + ((hi - mid) * (v - center)) / ((int32_t) max - center);
+        table[i] = (uint8_t) out;
+    }
+}
+
+/**
+ * @brief Constrói as tabelas de mapeamento a partir de um perfil de calibração.
+ *
+ * @param[out] map Tabelas a serem construídas.
+ * @param[in] cal Perfil de calibração válido.
+ * @param[in] x_lo Coordenada X para o mínimo do eixo X.
+ * @param[in] x_hi Coordenada X para o máximo do eixo X.
+ * @param[in] y_lo Coordenada Y para o mínimo do eixo Y.
+ * @param[in] y_hi Coordenada Y para o máximo do eixo Y.
+ */
+void joystick_map_build(joystick_map_t *map, const joystick_calibration_t *cal, uint8_t x_lo, uint8_t x_hi, uint8_t y_lo, uint8_t y_hi)
+{
+    joystick_map_build_axis(map->x, cal->min_x, cal->center_x, cal->max_x, x_lo, x_hi);
+    joystick_map_build_axis(map->y, cal->min_y, cal->center_y, cal->max_y, y_lo, y_hi);
+    map->center_x = cal->center_x;
+    map->center_y = cal->center_y;
+    map->deadzone_sq = (uint32_t) cal->deadzone * cal->deadzone;
+    map->rest_x = (uint8_t) (((uint16_t) x_lo + x_hi) / 2u);
+    map->rest_y = (uint8_t) (((uint16_t) y_lo + y_hi) / 2u);
+}
+
 /** @} */ // Fim do grupo "Joystick"
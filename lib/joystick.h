@@ -2,7 +2,8 @@
 #define JOYSTICK_H
 
 #include <stdint.h>
-#include "hardware/timer.h"
+#include "hal.h"
+#include "joystick_filter.h"
 
 /**
  * @file joystick.h
@@ -99,11 +100,95 @@
  */
 #define ADC_CHANNEL_4 UINT8_T_CONSTANT(3)
 
+/**
+ * @def JOYSTICK_RING_BITS
+ * @brief Log2 do tamanho, em bytes, do ring buffer preenchido pelo DMA.
+ *
+ * O canal DMA usa o recurso de "ring" do RP2040 no endereço de escrita, o que
+ * exige que o buffer tenha tamanho potência de dois e esteja alinhado a ele.
+ * 2^7 = 128 bytes = 64 amostras de 16 bits (32 por eixo).
+ */
+#define JOYSTICK_RING_BITS 7
+
+/**
+ * @def JOYSTICK_RING_LEN
+ * @brief Quantidade de amostras de 16 bits no ring buffer do ADC.
+ */
+#define JOYSTICK_RING_LEN ((1u << JOYSTICK_RING_BITS) / sizeof(uint16_t))
+
+/**
+ * @def JOYSTICK_OVERSAMPLE_SHIFT
+ * @brief Deslocamento aplicado à soma das amostras de cada eixo (decimação).
+ *
+ * A soma das 32 amostras de um eixo ocupa 17 bits; deslocando 3 bits obtém-se
+ * um valor de 14 bits (2 bits a mais que a leitura bruta do ADC).
+ */
+#define JOYSTICK_OVERSAMPLE_SHIFT 3
+
+/**
+ * @def JOYSTICK_ADC_MAX
+ * @brief Maior valor retornado por `joystick_get_x`/`joystick_get_y` (14 bits).
+ */
+#define JOYSTICK_ADC_MAX (4095u << 2)
+
+/**
+ * @def JOYSTICK_ADC_CENTER
+ * @brief Valor nominal do centro do joystick na escala de `JOYSTICK_ADC_MAX`.
+ */
+#define JOYSTICK_ADC_CENTER (2048u << 2)
+
+/**
+ * @def JOYSTICK_SAMPLE_RATE_HZ
+ * @brief Taxa total de conversões do ADC (somando os dois eixos).
+ */
+#define JOYSTICK_SAMPLE_RATE_HZ 32000u
+
+/**
+ * @def JOYSTICK_MOTION_WINDOW
+ * @brief Amplitude mínima (12 bits) das amostras de um eixo no ring para indicar movimento.
+ */
+#define JOYSTICK_MOTION_WINDOW 48
+
+/**
+ * @def JOYSTICK_MOTION_SETTLE
+ * @brief Diferença mínima (14 bits) entre leitura e saída do filtro para indicar movimento.
+ */
+#define JOYSTICK_MOTION_SETTLE 16
+
+/**
+ * @def JOYSTICK_MAP_BITS
+ * @brief Resolução (em bits) do índice das tabelas de mapeamento calibrado.
+ */
+#define JOYSTICK_MAP_BITS 12
+
+/**
+ * @def JOYSTICK_MAP_LEN
+ * @brief Quantidade de entradas de cada tabela de mapeamento (uma por eixo).
+ */
+#define JOYSTICK_MAP_LEN (1u << JOYSTICK_MAP_BITS)
+
+/**
+ * @def JOYSTICK_CALIBRATION_MAGIC
+ * @brief Assinatura de um perfil de calibração válido ("JCAL").
+ */
+#define JOYSTICK_CALIBRATION_MAGIC 0x4A43414Cu
+
+/**
+ * @def JOYSTICK_CALIBRATION_VERSION
+ * @brief Versão do layout de `joystick_calibration_t`; deve mudar junto com a estrutura.
+ */
+#define JOYSTICK_CALIBRATION_VERSION 1u
+
 /**
  * @brief Estrutura que representa um joystick analógico.
  *
  * Essa estrutura armazena os pinos de entrada analógica para os eixos X e Y, 
  * o pino do botão do joystick e o valor da zona morta (deadzone).
+ *
+ * O ADC opera em modo round-robin sobre os dois canais e a HAL copia
+ * continuamente as conversões para um ring buffer (DMA no RP2040). Como o
+ * round-robin começa sempre pelo canal de menor número, as posições pares do
+ * ring são do canal menor e as ímpares do maior; `slot_x`/`slot_y` guardam essa paridade.
  */
 typedef struct
 {
@@ -111,8 +196,55 @@ typedef struct
     uint8_t channel_y;       /**< Canal ADC correspondente ao eixo Y. */
     uint8_t joy_push_button; /**< Pino GPIO do botão do joystick. */
     uint8_t deadzone;        /**< Valor da zona morta para evitar ruídos no centro. */
+    uint8_t slot_x;          /**< Paridade (0 ou 1) das amostras do eixo X no ring. */
+    uint8_t slot_y;          /**< Paridade (0 ou 1) das amostras do eixo Y no ring. */
+    const volatile uint16_t *ring; /**< Ring buffer de amostras preenchido pela HAL. */
+    one_euro_params_t filter_params; /**< Parâmetros do filtro adaptativo. */
+    one_euro_state_t filter_x;       /**< Estado do filtro adaptativo do eixo X. */
+    one_euro_state_t filter_y;       /**< Estado do filtro adaptativo do eixo Y. */
 } joystick_t;
 
+/**
+ * @brief Perfil de calibração do joystick.
+ *
+ * Guarda, por eixo, os valores mínimo, central e máximo medidos (na escala de
+ * `JOYSTICK_ADC_MAX`) e o raio da zona morta radial. A estrutura não contém
+ * ponteiros e é selada com um checksum, podendo ser gravada e lida byte a byte
+ * de uma memória não volátil.
+ */
+typedef struct
+{
+    uint32_t magic;        /**< Deve valer `JOYSTICK_CALIBRATION_MAGIC`. */
+    uint16_t version;      /**< Deve valer `JOYSTICK_CALIBRATION_VERSION`. */
+    uint16_t deadzone;     /**< Raio da zona morta radial em torno do centro. */
+    uint16_t min_x;        /**< Menor valor medido no eixo X. */
+    uint16_t center_x;     /**< Valor de repouso do eixo X. */
+    uint16_t max_x;        /**< Maior valor medido no eixo X. */
+    uint16_t min_y;        /**< Menor valor medido no eixo Y. */
+    uint16_t center_y;     /**< Valor de repouso do eixo Y. */
+    uint16_t max_y;        /**< Maior valor medido no eixo Y. */
+    uint16_t checksum;     /**< Checksum de todos os campos anteriores. */
+    uint16_t reserved;     /**< Preenchimento; mantido em zero. */
+} joystick_calibration_t;
+
+/**
+ * @brief Tabelas de mapeamento direto de leituras do ADC para coordenadas de tela.
+ *
+ * Construídas uma única vez a partir de um `joystick_calibration_t`, permitem
+ * converter a leitura de cada eixo em coordenada com um único acesso à tabela.
+ * Os centros e a zona morta são mantidos para o teste radial.
+ */
+typedef struct
+{
+    uint8_t x[JOYSTICK_MAP_LEN]; /**< Coordenada X indexada pela leitura do eixo X. */
+    uint8_t y[JOYSTICK_MAP_LEN]; /**< Coordenada Y indexada pela leitura do eixo Y. */
+    uint16_t center_x;           /**< Centro calibrado do eixo X. */
+    uint16_t center_y;           /**< Centro calibrado do eixo Y. */
+    uint32_t deadzone_sq;        /**< Quadrado do raio da zona morta. */
+    uint8_t rest_x;              /**< Coordenada X com o joystick em repouso. */
+    uint8_t rest_y;              /**< Coordenada Y com o joystick em repouso. */
+} joystick_map_t;
+
 /**
  * @brief Inicializa o joystick, configurando os pinos ADC e o botão de push.
  *
@@ -121,7 +253,11 @@ typedef struct
  * e configura o `joy_pbutton` como entrada digital com pull-up ativado. 
  * Além disso, inicializa a estrutura `joystick_t`.
  *
+ * O ADC é deixado em execução contínua (round-robin entre os dois eixos) e o
+ * DMA mantém o ring buffer atualizado sem intervenção da CPU.
+ *
  * @note Esta função deve ser chamada antes de realizar leituras do joystick.
+ * @note Só existe um ADC no RP2040, portanto apenas um joystick pode ser inicializado.
  * @warning Se os pinos forem configurados incorretamente, o joystick pode não responder corretamente.
  *
  * @param[out] joy Ponteiro para a estrutura do joystick que será inicializada.
@@ -134,25 +270,29 @@ void joystick_init_all(joystick_t *joy, uint8_t joy_vrx, uint8_t joy_vry, uint8_
 /**
  * @brief Obtém o valor do eixo X do joystick.
  *
- * Esta função realiza a leitura do canal ADC correspondente ao eixo X do joystick.
+ * Esta função soma as amostras mais recentes do eixo X presentes no ring buffer
+ * (oversampling) e as decima para 14 bits. O custo é constante e não há espera
+ * por conversão do ADC.
  * O valor pode ser utilizado para normalização e controle gráfico.
  *
  * @note O ADC deve estar corretamente inicializado antes da leitura.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return Valor do ADC correspondente ao eixo X (exemplo: 0 - 4095 em ADC de 12 bits).
+ * @return Valor do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
  */
 uint16_t joystick_get_x(const joystick_t *joy);
 
 /**
  * @brief Obtém o valor do eixo Y do joystick.
  *
- * Esta função realiza a leitura do canal ADC correspondente ao eixo Y do joystick.
+ * Esta função soma as amostras mais recentes do eixo Y presentes no ring buffer
+ * (oversampling) e as decima para 14 bits. O custo é constante e não há espera
+ * por conversão do ADC.
  *
  * @note O ADC deve estar corretamente inicializado antes da leitura.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return Valor do ADC correspondente ao eixo Y (exemplo: 0 - 4095 em ADC de 12 bits).
+ * @return Valor do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
  */
 uint16_t joystick_get_y(const joystick_t *joy);
 
@@ -170,19 +310,33 @@ uint16_t joystick_get_y(const joystick_t *joy);
 bool joystick_get_button(const joystick_t *joy);
 
 /**
- * @brief Verifica se o joystick está se movendo além da deadzone.
- *
- * Esta função compara o valor lido dos eixos X e Y com a deadzone definida
- * para determinar se há um movimento significativo.
+ * @brief Verifica se o joystick está em movimento (ou se o cursor ainda vai se mover).
  *
- * @note A deadzone deve estar configurada corretamente para evitar detecção de ruídos.
- * @warning Se a deadzone for muito alta, pequenos movimentos podem ser ignorados.
+ * Combina um critério de janela (amplitude das amostras recentes no ring
+ * acima de `JOYSTICK_MOTION_WINDOW`) com um critério de limiar (leitura atual
+ * distante da saída do filtro adaptativo em mais de `JOYSTICK_MOTION_SETTLE`).
+ * Se retornar `false`, `joystick_read_smoothed` produziria o mesmo valor e a
+ * leitura pode ser pulada.
  *
  * @param[in] joy Ponteiro para a estrutura do joystick.
- * @return `true` se o joystick estiver fora da deadzone, `false` caso contrário.
+ * @return `true` se houver movimento, `false` caso contrário.
  */
 bool joystick_is_moving(const joystick_t *joy);
 
+/**
+ * @brief Suspende as conversões do ADC e, com elas, o tráfego de DMA.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ */
+void joystick_pause(const joystick_t *joy);
+
+/**
+ * @brief Retoma as conversões do ADC após `joystick_pause`.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ */
+void joystick_resume(const joystick_t *joy);
+
 /**
  * @brief Define o valor da zona morta (deadzone) do joystick.
  *
@@ -196,6 +350,139 @@ bool joystick_is_moving(const joystick_t *joy);
  */
 void joystick_set_deadzone(joystick_t *joy, uint8_t deadzone_value);
 
+/**
+ * @brief Lê os dois eixos sem aplicar a zona morta.
+ *
+ * Retorna os valores com oversampling, exatamente como estão no ring buffer,
+ * para uso com as tabelas calibradas de `joystick_map_t`.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] x Valor do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
+ * @param[out] y Valor do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
+ */
+void joystick_read_raw(const joystick_t *joy, uint16_t *x, uint16_t *y);
+
+/**
+ * @brief Lê os dois eixos passando pelo filtro adaptativo One-Euro.
+ *
+ * Remove o ruído residual do ADC quando o joystick está parado sem atrasar
+ * movimentos rápidos. Deve ser chamada uma vez por quadro, com o instante da
+ * leitura, pois o filtro depende do intervalo entre amostras.
+ *
+ * @param[in,out] joy Ponteiro para a estrutura do joystick (guarda o estado do filtro).
+ * @param[in] now_us Instante da leitura em microssegundos.
+ * @param[out] x Valor filtrado do eixo X, de 0 a `JOYSTICK_ADC_MAX`.
+ * @param[out] y Valor filtrado do eixo Y, de 0 a `JOYSTICK_ADC_MAX`.
+ */
+void joystick_read_smoothed(joystick_t *joy, uint32_t now_us, uint16_t *x, uint16_t *y);
+
+/**
+ * @brief Ajusta os parâmetros do filtro adaptativo e reinicia seu estado.
+ *
+ * Os valores podem ser escolhidos com a bancada `tools/joystick_filter_bench.c`.
+ *
+ * @param[in,out] joy Ponteiro para a estrutura do joystick.
+ * @param[in] params Novos parâmetros do filtro.
+ */
+void joystick_set_filter_params(joystick_t *joy, const one_euro_params_t *params);
+
+/**
+ * @brief Preenche um perfil de calibração com os valores nominais do joystick.
+ *
+ * Usa toda a faixa do ADC, centro em `JOYSTICK_ADC_CENTER` e a deadzone
+ * configurada em `joy`. Serve de ponto de partida quando não há perfil salvo.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] cal Perfil a ser preenchido (já selado).
+ */
+void joystick_calibration_default(const joystick_t *joy, joystick_calibration_t *cal);
+
+/**
+ * @brief Primeira fase da calibração: o joystick deve permanecer solto.
+ *
+ * A média das leituras define o centro e o maior desvio observado define o
+ * raio da zona morta. As fases são separadas para que a interface só peça a
+ * varredura depois desta terminar.
+ *
+ * @note Bloqueante; deve ser chamada fora do laço do jogo.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[out] cal Perfil com centro e zona morta (sem os extremos; ainda não selado).
+ * @param[in] rest_ms Duração da fase em milissegundos.
+ */
+void joystick_calibrate_rest(const joystick_t *joy, joystick_calibration_t *cal, uint16_t rest_ms);
+
+/**
+ * @brief Segunda fase da calibração: o usuário gira o joystick até os batentes.
+ *
+ * Os extremos de cada eixo são registrados e o perfil é selado; confira-o
+ * com `joystick_calibration_is_valid` antes de usá-lo ou gravá-lo.
+ *
+ * @note Bloqueante; deve ser chamada fora do laço do jogo.
+ *
+ * @param[in] joy Ponteiro para a estrutura do joystick.
+ * @param[in,out] cal Perfil de `joystick_calibrate_rest`; sai completo e selado.
+ * @param[in] sweep_ms Duração da fase em milissegundos.
+ */
+void joystick_calibrate_sweep(const joystick_t *joy, joystick_calibration_t *cal, uint16_t sweep_ms);
+
+/**
+ * @brief Calcula e grava o checksum de um perfil de calibração.
+ *
+ * @param[in,out] cal Perfil a ser selado.
+ */
+void joystick_calibration_seal(joystick_calibration_t *cal);
+
+/**
+ * @brief Verifica se um perfil de calibração (por exemplo, lido da flash) é válido.
+ *
+ * @param[in] cal Perfil a ser verificado.
+ * @return `true` se assinatura, versão, checksum e faixas forem coerentes.
+ */
+bool joystick_calibration_is_valid(const joystick_calibration_t *cal);
+
+/**
+ * @brief Constrói as tabelas de mapeamento a partir de um perfil de calibração.
+ *
+ * Cada eixo é mapeado por partes: [mínimo, centro] para [lo, meio] e
+ * [centro, máximo] para [meio, hi], saturando fora da faixa calibrada. Passar
+ * `lo > hi` inverte o eixo.
+ *
+ * @param[out] map Tabelas a serem construídas.
+ * @param[in] cal Perfil de calibração válido.
+ * @param[in] x_lo Coordenada X para o mínimo do eixo X.
+ * @param[in] x_hi Coordenada X para o máximo do eixo X.
+ * @param[in] y_lo Coordenada Y para o mínimo do eixo Y.
+ * @param[in] y_hi Coordenada Y para o máximo do eixo Y.
+ */
+void joystick_map_build(joystick_map_t *map, const joystick_calibration_t *cal, uint8_t x_lo, uint8_t x_hi, uint8_t y_lo, uint8_t y_hi);
+
+/**
+ * @brief Converte uma leitura dos dois eixos em coordenadas de tela.
+ *
+ * Leituras dentro do círculo da zona morta resultam na posição de repouso;
+ * as demais são convertidas com um acesso à tabela por eixo.
+ *
+ * @param[in] map Tabelas construídas por `joystick_map_build`.
+ * @param[in] raw_x Leitura do eixo X (0 a `JOYSTICK_ADC_MAX`).
+ * @param[in] raw_y Leitura do eixo Y (0 a `JOYSTICK_ADC_MAX`).
+ * @param[out] x Coordenada X resultante.
+ * @param[out] y Coordenada Y resultante.
+ */
+static inline void joystick_map_apply(const joystick_map_t *map, uint16_t raw_x, uint16_t raw_y, uint8_t *x, uint8_t *y)
+{
+    int32_t dx = (int32_t) raw_x - map->center_x;
+    int32_t dy = (int32_t) raw_y - map->center_y;
+    if ((uint32_t) (dx * dx + dy * dy) <= map->deadzone_sq)
+    {
+        *x = map->rest_x;
+        *y = map->rest_y;
+        return;
+    }
+    *x = map->x[raw_x >> (14 - JOYSTICK_MAP_BITS)];
+    *y = map->y[raw_y >> (14 - JOYSTICK_MAP_BITS)];
+}
+
 /** @} */ // Fim do grupo "Joystick"
 
 #endif // JOYSTICK_H
@@ -0,0 +1,124 @@
+#include "joystick_filter.h"
+
+/**
+ * @file joystick_filter.c
+ * @brief Implementação em ponto fixo do filtro One-Euro usado pelo joystick.
+ *
+ * Para uma frequência de corte fc e um intervalo entre amostras Te, o fator de
+ * suavização de um passa-baixas de primeira ordem é
+ * alpha = k / (k + 1), com k = 2*pi*fc*Te. Aqui alpha é calculado em Q12 como
+ * 4096 - 4096^2 / (k_q12 + 4096), o que exige uma única divisão de 32 bits.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @def ONE_EURO_ALPHA_ONE
+ * @brief Valor 1.0 de alpha em Q12.
+ */
+#define ONE_EURO_ALPHA_ONE 4096
+
+/**
+ * @def ONE_EURO_K_SCALE
+ * @brief 2*pi * 1e-3 (mHz) * 1e-6 (us) * 4096 (Q12) * 2^32, arredondado.
+ *
+ * Permite obter k em Q12 como (fc_mhz * te_us * ONE_EURO_K_SCALE) >> 32.
+ */
+#define ONE_EURO_K_SCALE 110536ull
+
+/**
+ * @def ONE_EURO_MAX_INTERVAL_US
+ * @brief Maior intervalo entre amostras considerado (limita k e evita estouro).
+ */
+#define ONE_EURO_MAX_INTERVAL_US 1000000u
+
+/**
+ * @brief Calcula o fator de suavização (Q12) para uma frequência de corte e um intervalo.
+ *
+ * @param cutoff_mhz Frequência de corte em mHz.
+ * @param te_us Intervalo desde a amostra anterior em microssegundos.
+ * @return alpha em Q12, de 0 (mantém o valor anterior) a 4096 (sem suavização).
+ */
+static int32_t one_euro_alpha(uint32_t cutoff_mhz, uint32_t te_us)
+{
+    uint32_t k_q12 = (uint32_t) (((uint64_t) cutoff_mhz * te_us * ONE_EURO_K_SCALE) >> 32);
+    return ONE_EURO_ALPHA_ONE - (int32_t) ((uint32_t) (ONE_EURO_ALPHA_ONE * ONE_EURO_ALPHA_ONE) / (k_q12 + ONE_EURO_ALPHA_ONE));
+}
+
+/**
+ * @brief Preenche os parâmetros com os valores padrão.
+ *
+ * @param[out] params Parâmetros a serem preenchidos.
+ */
+void one_euro_params_default(one_euro_params_t *params)
+{
+    params->min_cutoff_mhz = ONE_EURO_DEFAULT_MIN_CUTOFF_MHZ;
+    params->beta = ONE_EURO_DEFAULT_BETA;
+    params->d_cutoff_mhz = ONE_EURO_DEFAULT_D_CUTOFF_MHZ;
+}
+
+/**
+ * @brief Reinicia o estado do filtro.
+ *
+ * @param[out] state Estado a ser reiniciado.
+ */
+void one_euro_reset(one_euro_state_t *state)
+{
+    state->value_q4 = 0;
+    state->speed = 0;
+    state->last_us = 0;
+    state->primed = false;
+}
+
+/**
+ * @brief Aplica o filtro a uma nova amostra.
+ *
+ * @param[in,out] state Estado do eixo.
+ * @param[in] params Parâmetros do filtro.
+ * @param[in] value Nova amostra (escala de 14 bits).
+ * @param[in] now_us Instante da amostra em microssegundos.
+ * @return Valor filtrado, na mesma escala da entrada.
+ */
+uint16_t one_euro_filter(one_euro_state_t *state, const one_euro_params_t *params, uint16_t value, uint32_t now_us)
+{
+    int32_t input_q4 = (int32_t) value << 4;
+
+    if (!state->primed)
+    {
+        state->value_q4 = input_q4;
+        state->speed = 0;
+        state->last_us = now_us;
+        state->primed = true;
+        return value;
+    }
+
+    uint32_t te_us = now_us - state->last_us;
+    if (te_us == 0) return (uint16_t) (state->value_q4 >> 4); // Mesma amostra lida duas vezes
+    state->last_us = now_us;
+    if (te_us > ONE_EURO_MAX_INTERVAL_US) te_us = ONE_EURO_MAX_INTERVAL_US;
+
+    // Derivada bruta em contagens/s: delta (Q4) * (1e6 / Te) (Q8) >> 12
+    int32_t rate_q8 = (int32_t) ((1000000u << 8) / te_us);
+    int32_t speed = (int32_t) (((int64_t) (input_q4 - state->value_q4) * rate_q8) >> 12);
+    if (speed > ONE_EURO_MAX_SPEED) speed = ONE_EURO_MAX_SPEED;
+    else if (speed < -ONE_EURO_MAX_SPEED) speed = -ONE_EURO_MAX_SPEED;
+
+    // Derivada suavizada com corte fixo
+    int32_t alpha_d = one_euro_alpha(params->d_cutoff_mhz, te_us);
+    state->speed += ((speed - state->speed) * alpha_d) / ONE_EURO_ALPHA_ONE;
+
+    // Corte adaptativo: cresce com a velocidade
+    uint32_t abs_speed = (uint32_t) ((state->speed < 0) ? -state->speed : state->speed);
+    uint32_t cutoff = params->min_cutoff_mhz + (uint32_t) (((uint64_t) params->beta * abs_speed) >> 8);
+    if (cutoff > ONE_EURO_MAX_CUTOFF_MHZ) cutoff = ONE_EURO_MAX_CUTOFF_MHZ;
+
+    int32_t alpha = one_euro_alpha(cutoff, te_us);
+    state->value_q4 += ((input_q4 - state->value_q4) * alpha) / ONE_EURO_ALPHA_ONE;
+
+    // Arredonda de Q4 para inteiro
+    return (uint16_t) ((state->value_q4 + 8) >> 4);
+}
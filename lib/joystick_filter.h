@@ -0,0 +1,111 @@
+#ifndef JOYSTICK_FILTER_H
+#define JOYSTICK_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file joystick_filter.h
+ * @brief Filtro passa-baixas adaptativo (One-Euro) em ponto fixo para o joystick.
+ *
+ * O filtro One-Euro ajusta a frequência de corte conforme a velocidade do
+ * sinal: parado, o corte é baixo e o ruído do ADC é removido; em movimento
+ * rápido, o corte sobe e o atraso introduzido cai. Toda a aritmética é inteira
+ * (uma divisão de 32 bits e duas multiplicações de 64 bits por amostra) e o
+ * módulo não depende do Pico SDK, podendo ser compilado no host pela bancada
+ * de testes em `tools/`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Joystick_Filter Filtro One-Euro do Joystick
+ * @brief Suavização de baixa latência para as leituras do joystick.
+ * @{
+ */
+
+/**
+ * @def ONE_EURO_MAX_CUTOFF_MHZ
+ * @brief Frequência de corte máxima admitida, em mHz (evita estouro nos cálculos).
+ */
+#define ONE_EURO_MAX_CUTOFF_MHZ 500000u
+
+/**
+ * @def ONE_EURO_MAX_SPEED
+ * @brief Velocidade máxima considerada, em contagens de 14 bits por segundo.
+ */
+#define ONE_EURO_MAX_SPEED (1 << 17)
+
+/**
+ * @def ONE_EURO_DEFAULT_MIN_CUTOFF_MHZ
+ * @brief Corte mínimo padrão (joystick parado), em mHz.
+ */
+#define ONE_EURO_DEFAULT_MIN_CUTOFF_MHZ 1000u
+
+/**
+ * @def ONE_EURO_DEFAULT_BETA
+ * @brief Inclinação padrão: mHz de corte adicionados por contagem/s, em Q8.
+ */
+#define ONE_EURO_DEFAULT_BETA 256u
+
+/**
+ * @def ONE_EURO_DEFAULT_D_CUTOFF_MHZ
+ * @brief Corte padrão do filtro da derivada, em mHz.
+ */
+#define ONE_EURO_DEFAULT_D_CUTOFF_MHZ 1000u
+
+/**
+ * @brief Parâmetros ajustáveis do filtro One-Euro.
+ */
+typedef struct
+{
+    uint32_t min_cutoff_mhz; /**< Frequência de corte com o sinal parado, em mHz. */
+    uint32_t beta;           /**< Acréscimo de corte por contagem/s de velocidade, em mHz (Q8). */
+    uint32_t d_cutoff_mhz;   /**< Frequência de corte do filtro da derivada, em mHz. */
+} one_euro_params_t;
+
+/**
+ * @brief Estado do filtro para um eixo.
+ */
+typedef struct
+{
+    int32_t value_q4;  /**< Último valor filtrado em Q4 (4 bits fracionários). */
+    int32_t speed;     /**< Derivada filtrada, em contagens por segundo. */
+    uint32_t last_us;  /**< Instante da última amostra, em microssegundos. */
+    bool primed;       /**< `false` até a primeira amostra ser recebida. */
+} one_euro_state_t;
+
+/**
+ * @brief Preenche os parâmetros com os valores padrão.
+ *
+ * @param[out] params Parâmetros a serem preenchidos.
+ */
+void one_euro_params_default(one_euro_params_t *params);
+
+/**
+ * @brief Reinicia o estado do filtro; a próxima amostra é repassada sem suavização.
+ *
+ * @param[out] state Estado a ser reiniciado.
+ */
+void one_euro_reset(one_euro_state_t *state);
+
+/**
+ * @brief Aplica o filtro a uma nova amostra.
+ *
+ * @param[in,out] state Estado do eixo.
+ * @param[in] params Parâmetros do filtro.
+ * @param[in] value Nova amostra (escala de 14 bits).
+ * @param[in] now_us Instante da amostra em microssegundos (pode dar a volta em 32 bits).
+ * @return Valor filtrado, na mesma escala da entrada.
+ */
+uint16_t one_euro_filter(one_euro_state_t *state, const one_euro_params_t *params, uint16_t value, uint32_t now_us);
+
+/** @} */ // Fim do grupo "Joystick_Filter"
+
+#endif // JOYSTICK_FILTER_H
@@ -0,0 +1,368 @@
+#include "kvstore.h"
+#include "hal.h"
+#include <string.h>
+
+/**
+ * @file kvstore.c
+ * @brief Log de registros com CRC em um anel de setores da flash.
+ *
+ * As gravações passam por um buffer de uma página: cada página tocada é
+ * gravada uma única vez por operação, com 0xFF nos bytes que não mudam (na
+ * NOR, gravar 0xFF preserva o conteúdo), o que permite acrescentar registros
+ * a uma página já parcialmente usada.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @def KV_MAGIC
+ * @brief Marca de início de um setor formatado.
+ */
+#define KV_MAGIC "EKV1"
+
+/**
+ * @def KV_HEADER_BYTES
+ * @brief Cabeçalho do setor; os registros começam logo depois.
+ */
+#define KV_HEADER_BYTES 16u
+
+/**
+ * @def KV_RECORD_HEADER_BYTES
+ * @brief Chave, tamanho e CRC de cada registro.
+ */
+#define KV_RECORD_HEADER_BYTES 8u
+
+/**
+ * @def KV_KEY_END
+ * @brief Chave lida na flash apagada: fim dos registros do setor.
+ */
+#define KV_KEY_END 0xFFFFu
+
+/**
+ * @def KV_NOT_PENDING
+ * @brief Valor de `pending_len` para chave sem alteração pendente.
+ */
+#define KV_NOT_PENDING (-1)
+
+/**
+ * @brief Gravação sequencial através do buffer de página.
+ */
+typedef struct
+{
+    uint32_t sector; /**< Deslocamento do setor na flash */
+    uint32_t ofs;    /**< Próximo byte, relativo ao setor */
+    uint32_t page;   /**< Página no buffer, relativa ao setor */
+    bool ok;         /**< Todas as gravações até aqui foram aceitas */
+} kv_writer_t;
+
+static uint8_t kv_page[HAL_FLASH_PAGE_SIZE]; // Em RAM: a flash não pode ser lida durante a gravação
+
+static void put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) p[i] = (uint8_t) (value >> (8 * i));
+}
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint32_t) p[i] << (8 * i);
+    return value;
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t length)
+{
+    // CRC-32 (IEEE) bit a bit: poucos registros por gravação, sem tabela na RAM
+    for (size_t i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+    }
+    return crc;
+}
+
+static uint32_t kv_record_crc(uint16_t key, const uint8_t *value, uint16_t length)
+{
+    uint8_t head[4];
+    put_le(head, key, 2);
+    put_le(head + 2, length, 2);
+    return ~crc32_update(crc32_update(0xFFFFFFFFu, head, 4), value, length);
+}
+
+static inline uint32_t kv_record_size(uint16_t length) { return KV_RECORD_HEADER_BYTES + ((length + 3u) & ~3u); }
+
+static inline uint32_t kv_sector(const kv_store_t *kv, uint8_t sector) { return kv->base + sector * HAL_FLASH_SECTOR_SIZE; }
+
+static void writer_begin(kv_writer_t *w, uint32_t sector, uint32_t ofs)
+{
+    w->sector = sector;
+    w->ofs = ofs;
+    w->page = ofs & ~(HAL_FLASH_PAGE_SIZE - 1);
+    w->ok = true;
+    memset(kv_page, 0xFF, sizeof kv_page);
+}
+
+static void writer_flush(kv_writer_t *w)
+{
+    if (w->ofs == w->page) return;
+    w->ok &= hal_flash_program(w->sector + w->page, kv_page, HAL_FLASH_PAGE_SIZE);
+    w->page += HAL_FLASH_PAGE_SIZE;
+    memset(kv_page, 0xFF, sizeof kv_page);
+}
+
+static void writer_put(kv_writer_t *w, const uint8_t *data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        kv_page[w->ofs++ - w->page] = data[i];
+        if (w->ofs - w->page == HAL_FLASH_PAGE_SIZE) writer_flush(w);
+    }
+}
+
+/**
+ * @brief Acrescenta um registro.
+ *
+ * @return Posição do registro no setor.
+ */
+static uint16_t writer_record(kv_writer_t *w, uint16_t key, const uint8_t *value, uint16_t length)
+{
+    static const uint8_t padding[3] = { 0xFF, 0xFF, 0xFF };
+    uint16_t at = (uint16_t) w->ofs;
+    uint8_t head[KV_RECORD_HEADER_BYTES];
+    put_le(head, key, 2);
+    put_le(head + 2, length, 2);
+    put_le(head + 4, kv_record_crc(key, value, length), 4);
+    writer_put(w, head, sizeof head);
+    writer_put(w, value, length);
+    writer_put(w, padding, kv_record_size(length) - KV_RECORD_HEADER_BYTES - length);
+    return at;
+}
+
+/**
+ * @brief Lê a sequência de um setor.
+ *
+ * @return `false` se o cabeçalho não for válido.
+ */
+static bool kv_read_header(const kv_store_t *kv, uint8_t sector, uint32_t *seq)
+{
+    const uint8_t *h = hal_flash_map(kv_sector(kv, sector));
+    if (memcmp(h, KV_MAGIC, 4) != 0) return false;
+    if (get_le(h + 8, 4) != ~crc32_update(0xFFFFFFFFu, h, 8)) return false;
+    *seq = get_le(h + 4, 4);
+    return true;
+}
+
+static bool kv_write_header(kv_store_t *kv, uint8_t sector, uint32_t seq)
+{
+    uint8_t h[KV_HEADER_BYTES];
+    memcpy(h, KV_MAGIC, 4);
+    put_le(h + 4, seq, 4);
+    put_le(h + 8, ~crc32_update(0xFFFFFFFFu, h, 8), 4);
+    put_le(h + 12, 0, 4);
+
+    kv_writer_t w;
+    writer_begin(&w, kv_sector(kv, sector), 0);
+    writer_put(&w, h, sizeof h);
+    writer_flush(&w);
+    return w.ok;
+}
+
+/**
+ * @brief Percorre os registros do setor ativo, reconstruindo o índice.
+ */
+static void kv_scan(kv_store_t *kv)
+{
+    const uint8_t *sector = hal_flash_map(kv_sector(kv, kv->active));
+    uint32_t ofs = KV_HEADER_BYTES;
+
+    memset(kv->index, 0, sizeof kv->index);
+    while (ofs + KV_RECORD_HEADER_BYTES <= HAL_FLASH_SECTOR_SIZE)
+    {
+        const uint8_t *r = sector + ofs;
+        uint16_t key = (uint16_t) get_le(r, 2);
+        uint16_t length = (uint16_t) get_le(r + 2, 2);
+        if (key == KV_KEY_END) break;
+
+        if (length > KV_MAX_VALUE || ofs + kv_record_size(length) > HAL_FLASH_SECTOR_SIZE ||
+            get_le(r + 4, 4) != kv_record_crc(key, r + KV_RECORD_HEADER_BYTES, length))
+        {
+            // Gravação interrompida: o resto do setor não é confiável
+            ofs = HAL_FLASH_SECTOR_SIZE;
+            break;
+        }
+        if (key < KV_MAX_KEYS) kv->index[key] = length ? (uint16_t) ofs : 0;
+        ofs += kv_record_size(length);
+    }
+    kv->write_ofs = (uint16_t) ofs;
+}
+
+/**
+ * @brief Valor gravado de uma chave.
+ *
+ * @return Tamanho, ou -1 se a chave não estiver no setor ativo.
+ */
+static int kv_stored(const kv_store_t *kv, uint16_t key, const uint8_t **value)
+{
+    if (key >= KV_MAX_KEYS || !kv->index[key]) return -1;
+    const uint8_t *r = hal_flash_map(kv_sector(kv, kv->active) + kv->index[key]);
+    *value = r + KV_RECORD_HEADER_BYTES;
+    return (int) get_le(r + 2, 2);
+}
+
+/**
+ * @brief Copia os valores vivos, já com as alterações pendentes, para o próximo setor.
+ *
+ * No máximo `KV_MAX_KEYS` registros de `KV_MAX_VALUE` bytes: sempre cabem em um setor.
+ */
+static bool kv_compact(kv_store_t *kv)
+{
+    uint8_t next = (uint8_t) ((kv->active + 1) % KV_SECTORS);
+    uint16_t index[KV_MAX_KEYS] = { 0 };
+    kv_writer_t w;
+
+    if (!hal_flash_erase(kv_sector(kv, next), HAL_FLASH_SECTOR_SIZE)) return false;
+    writer_begin(&w, kv_sector(kv, next), KV_HEADER_BYTES);
+    for (uint16_t key = 0; key < KV_MAX_KEYS; key++)
+    {
+        const uint8_t *value;
+        int length = kv->pending_len[key];
+        if (length == KV_NOT_PENDING) length = kv_stored(kv, key, &value);
+        else value = kv->pending[key];
+        if (length > 0) index[key] = writer_record(&w, key, value, (uint16_t) length);
+    }
+    uint16_t write_ofs = (uint16_t) w.ofs;
+    writer_flush(&w);
+
+    // O cabeçalho por último: até aqui, o setor antigo continua sendo o válido
+    if (!w.ok || !kv_write_header(kv, next, kv->seq + 1)) return false;
+
+    kv->active = next;
+    kv->seq++;
+    kv->write_ofs = write_ofs;
+    memcpy(kv->index, index, sizeof index);
+    kv->compactions++;
+    return true;
+}
+
+bool kv_mount(kv_store_t *kv, uint32_t base)
+{
+    bool found = false;
+
+    memset(kv, 0, sizeof *kv);
+    memset(kv->pending_len, KV_NOT_PENDING, sizeof kv->pending_len);
+    kv->base = base;
+
+    for (uint8_t s = 0; s < KV_SECTORS; s++)
+    {
+        uint32_t seq;
+        if (!kv_read_header(kv, s, &seq)) continue;
+        // Comparação serial: continua certa quando a sequência dá a volta
+        if (!found || (int32_t) (seq - kv->seq) > 0)
+        {
+            kv->active = s;
+            kv->seq = seq;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        kv->active = 0;
+        kv->seq = 1;
+        if (!hal_flash_erase(kv_sector(kv, 0), HAL_FLASH_SECTOR_SIZE) || !kv_write_header(kv, 0, kv->seq)) return false;
+    }
+    kv_scan(kv);
+    return true;
+}
+
+int kv_get(const kv_store_t *kv, uint16_t key, void *value, size_t capacity)
+{
+    const uint8_t *data;
+    int length;
+
+    if (key >= KV_MAX_KEYS) return -1;
+    if (kv->pending_len[key] != KV_NOT_PENDING)
+    {
+        data = kv->pending[key];
+        length = kv->pending_len[key] ? kv->pending_len[key] : -1;
+    }
+    else
+    {
+        length = kv_stored(kv, key, &data);
+    }
+    if (length > 0) memcpy(value, data, (size_t) length < capacity ? (size_t) length : capacity);
+    return length;
+}
+
+bool kv_set(kv_store_t *kv, uint16_t key, const void *value, size_t length)
+{
+    const uint8_t *stored;
+
+    if (key >= KV_MAX_KEYS || length == 0 || length > KV_MAX_VALUE) return false;
+    if (kv_stored(kv, key, &stored) == (int) length && memcmp(stored, value, length) == 0)
+    {
+        kv->pending_len[key] = KV_NOT_PENDING; // Igual ao gravado: nada a fazer
+        return true;
+    }
+    memcpy(kv->pending[key], value, length);
+    kv->pending_len[key] = (int8_t) length;
+    return true;
+}
+
+void kv_delete(kv_store_t *kv, uint16_t key)
+{
+    if (key >= KV_MAX_KEYS) return;
+    kv->pending_len[key] = kv->index[key] ? 0 : KV_NOT_PENDING;
+}
+
+bool kv_dirty(const kv_store_t *kv)
+{
+    for (uint16_t key = 0; key < KV_MAX_KEYS; key++)
+        if (kv->pending_len[key] != KV_NOT_PENDING) return true;
+    return false;
+}
+
+bool kv_commit(kv_store_t *kv)
+{
+    uint32_t needed = 0;
+
+    if (!kv_dirty(kv)) return true;
+    for (uint16_t key = 0; key < KV_MAX_KEYS; key++)
+        if (kv->pending_len[key] != KV_NOT_PENDING) needed += kv_record_size((uint16_t) kv->pending_len[key]);
+
+    if (kv->write_ofs + needed > HAL_FLASH_SECTOR_SIZE)
+    {
+        if (!kv_compact(kv)) return false;
+    }
+    else
+    {
+        uint16_t index[KV_MAX_KEYS];
+        kv_writer_t w;
+
+        memcpy(index, kv->index, sizeof index);
+        writer_begin(&w, kv_sector(kv, kv->active), kv->write_ofs);
+        for (uint16_t key = 0; key < KV_MAX_KEYS; key++)
+        {
+            int length = kv->pending_len[key];
+            if (length == KV_NOT_PENDING) continue;
+            uint16_t at = writer_record(&w, key, kv->pending[key], (uint16_t) length);
+            index[key] = length ? at : 0;
+        }
+        uint16_t write_ofs = (uint16_t) w.ofs;
+        writer_flush(&w);
+        if (!w.ok)
+        {
+            kv_scan(kv); // Mantém o que chegou inteiro à flash; o restante fica pendente
+            return false;
+        }
+        memcpy(kv->index, index, sizeof index);
+        kv->write_ofs = write_ofs;
+    }
+
+    memset(kv->pending_len, KV_NOT_PENDING, sizeof kv->pending_len);
+    kv->commits++;
+    return true;
+}
@@ -0,0 +1,153 @@
+#ifndef KVSTORE_H
+#define KVSTORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file kvstore.h
+ * @brief Armazenamento chave-valor persistente nos últimos setores da flash.
+ *
+ * Os registros são apenas acrescentados ao setor ativo, cada um com um CRC32;
+ * o último registro de uma chave vale e um registro vazio a apaga. Quando o
+ * setor enche, os valores vivos são copiados para o próximo setor do anel
+ * (compactação), de modo que os apagamentos se distribuem igualmente pelos
+ * `KV_SECTORS` setores. O cabeçalho do novo setor é gravado por último: uma
+ * queda de energia no meio da compactação deixa o setor antigo valendo.
+ *
+ * `kv_set` e `kv_delete` só alteram uma tabela em RAM; a flash é tocada
+ * apenas em `kv_commit`, que o jogo chama fora das partidas. Durante a
+ * gravação o XIP fica desligado e o outro núcleo parado (dezenas de
+ * milissegundos quando há compactação), então a chamada deve ficar longe de
+ * qualquer laço com prazo.
+ *
+ * O módulo usa apenas a HAL e é compilado também no host, onde a flash pode
+ * ser um arquivo (`hal_linux_flash_attach`).
+ *
+ * Formato (little-endian):
+ *     setor:    "EKV1" | sequência u32 | CRC32 dos 8 bytes anteriores u32 | reservado u32 | registros...
+ *     registro: chave u16 | tamanho u16 | CRC32 de chave, tamanho e valor u32 | valor (alinhado a 4 bytes)
+ * Uma chave 0xFFFF (flash apagada) marca o fim dos registros.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup KV_Store Armazenamento Chave-Valor
+ * @brief Recordes, calibração e configurações na flash, com nivelamento de desgaste.
+ * @{
+ */
+
+/**
+ * @def KV_SECTORS
+ * @brief Setores de 4 KB reservados no fim da flash.
+ */
+#define KV_SECTORS 4
+
+/**
+ * @def KV_AREA_BYTES
+ * @brief Bytes reservados no fim da flash; o firmware não pode alcançá-los.
+ */
+#define KV_AREA_BYTES (KV_SECTORS * 4096u)
+
+/**
+ * @def KV_MAX_KEYS
+ * @brief Chaves válidas vão de 0 a `KV_MAX_KEYS - 1`.
+ */
+#define KV_MAX_KEYS 16
+
+/**
+ * @def KV_MAX_VALUE
+ * @brief Maior valor, em bytes.
+ */
+#define KV_MAX_VALUE 64
+
+/**
+ * @brief Estado do armazenamento montado.
+ */
+typedef struct
+{
+    uint32_t base;                       /**< Deslocamento do primeiro setor na flash. */
+    uint32_t seq;                        /**< Sequência do setor ativo (cresce a cada compactação). */
+    uint16_t write_ofs;                  /**< Próxima posição livre no setor ativo. */
+    uint8_t active;                      /**< Setor ativo, de 0 a `KV_SECTORS - 1`. */
+    uint16_t index[KV_MAX_KEYS];         /**< Posição do último registro de cada chave (0 se ausente). */
+    int8_t pending_len[KV_MAX_KEYS];     /**< Tamanho do valor pendente, 0 para apagar, -1 se nada pendente. */
+    uint8_t pending[KV_MAX_KEYS][KV_MAX_VALUE]; /**< Valores ainda não gravados. */
+    uint32_t commits;                    /**< Gravações feitas por `kv_commit`. */
+    uint32_t compactions;                /**< Compactações (um setor apagado em cada). */
+} kv_store_t;
+
+/**
+ * @brief Encontra o setor mais recente e reconstrói o índice em RAM.
+ *
+ * Se nenhum setor tiver cabeçalho válido (flash nova), o primeiro é formatado.
+ * Um registro corrompido encerra a leitura e força a compactação na próxima
+ * gravação; os registros anteriores a ele continuam valendo.
+ *
+ * @param kv Armazenamento.
+ * @param base Deslocamento na flash, alinhado a setor (normalmente `hal_flash_size() - KV_AREA_BYTES`).
+ * @return `false` se a flash não puder ser formatada.
+ */
+bool kv_mount(kv_store_t *kv, uint32_t base);
+
+/**
+ * @brief Lê o valor de uma chave, incluindo alterações ainda não gravadas.
+ *
+ * @param kv Armazenamento.
+ * @param key Chave.
+ * @param[out] value Destino (até `capacity` bytes são copiados).
+ * @param capacity Tamanho do destino.
+ * @return Tamanho do valor guardado, ou -1 se a chave não existir.
+ */
+int kv_get(const kv_store_t *kv, uint16_t key, void *value, size_t capacity);
+
+/**
+ * @brief Agenda a gravação de um valor; substitui o pendente da mesma chave.
+ *
+ * Um valor igual ao já gravado não é agendado.
+ *
+ * @param kv Armazenamento.
+ * @param key Chave.
+ * @param value Dados.
+ * @param length Tamanho, de 1 a `KV_MAX_VALUE`.
+ * @return `false` se a chave ou o tamanho forem inválidos.
+ */
+bool kv_set(kv_store_t *kv, uint16_t key, const void *value, size_t length);
+
+/**
+ * @brief Agenda a remoção de uma chave.
+ *
+ * @param kv Armazenamento.
+ * @param key Chave.
+ */
+void kv_delete(kv_store_t *kv, uint16_t key);
+
+/**
+ * @brief Indica se há alterações aguardando `kv_commit`.
+ *
+ * @param kv Armazenamento.
+ * @return `true` se alguma chave tiver valor pendente.
+ */
+bool kv_dirty(const kv_store_t *kv);
+
+/**
+ * @brief Grava todas as alterações pendentes, compactando se não couberem.
+ *
+ * Bloqueia durante a operação na flash; chamar somente fora das partidas.
+ *
+ * @param kv Armazenamento.
+ * @return `false` se a flash recusar a operação (as alterações continuam pendentes).
+ */
+bool kv_commit(kv_store_t *kv);
+
+/** @} */ // Fim do grupo "KV_Store"
+
+#endif // KVSTORE_H
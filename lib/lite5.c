@@ -4,7 +4,7 @@
 #include <stdio.h>
 #include "ws2812b_motion.h"
 #include "ws2812b_definitions.h"
-#include "pico/stdlib.h"
+#include "hal.h"
 
 /**
  * @brief Variável global que armazena o último comando executado.
@@ -1,34 +1,213 @@
 #include <stdio.h>
 #include "mlt8530.h"
-#include "pico/stdlib.h"
-#include "hardware/pwm.h"
-#include "hardware/timer.h"
-
-static void buzzer_set_frequency(uint8_t gpio, uint16_t frequency)
-{
-    // Obter o slice do PWM para o GPIO
-    uint slice_num = pwm_gpio_to_slice_num(gpio);
-    // Configurar a frequência
-    uint32_t clock_freq = 125000000; // Frequência do clock (125 MHz no Pico)
-    uint32_t divider = clock_freq / (frequency * 65536); // Divisor para a frequência desejada
-    if (divider < 1) divider = 1; // Evitar divisão menor que 1
-    else if (divider > 255) divider = 255;
-    pwm_config config = pwm_get_default_config();
-    pwm_config_set_clkdiv(&config, divider); // Configurar o divisor do clock
-    pwm_init(slice_num, &config, true); // Iniciar o PWM
-    // Configurar a duty cycle (50% para som contínuo)
-    pwm_set_gpio_level(gpio, 32768); // Meio do ciclo (50%)
+#include "mlt8530_notes.h"
+#include "clockmgr.h"
+#include "workqueue.h"
+
+/**
+ * @brief Estado de uma voz: fila de notas (escrita pelo laço principal, lida pelo alarme) e PWM.
+ */
+typedef struct
+{
+    uint8_t gpio;                               // Pino do buzzer
+    uint16_t frequency;                         // Frequência configurada no slice (evita reconfigurar)
+    uint16_t top;                               // Wrap atual do slice
+    uint8_t volume;                             // Volume da nota atual (0 = pausa)
+    volatile bool active;                       // Há uma nota (ou pausa) em andamento
+    hal_alarm_id_t alarm;                       // Alarme que encerra a nota atual
+    buzzer_note_t queue[BUZZER_QUEUE_LEN];
+    volatile uint32_t head;                     // Escrito pelo laço principal
+    volatile uint32_t tail;                     // Escrito pelo alarme
+} buzzer_voice_t;
+
+static buzzer_voice_t buzzer_voices[BUZZER_MAX_VOICES];
+static uint8_t buzzer_voice_count = 0;
+
+// Tabela de notas MIDI do clk_sys atual (NULL se o clock não tem tabela)
+static const buzzer_pwm_setting_t *buzzer_notes = NULL;
+static uint32_t buzzer_notes_clock_hz = 0;
+
+static buzzer_voice_t *buzzer_find_voice(uint8_t gpio)
+{
+    for (uint8_t i = 0; i < buzzer_voice_count; i++) {
+        if (buzzer_voices[i].gpio == gpio) return &buzzer_voices[i];
+    }
+    return NULL;
+}
+
+// Reavalia a tabela de notas se o clk_sys mudou desde a última nota
+static void buzzer_select_table(void)
+{
+    uint32_t clock_hz = hal_clock_sys_hz();
+    if (clock_hz == buzzer_notes_clock_hz) return;
+
+    buzzer_notes_clock_hz = clock_hz;
+    buzzer_notes = NULL;
+    for (uint8_t i = 0; i < count_of(BUZZER_NOTE_TABLES); i++) {
+        if (BUZZER_NOTE_TABLES[i].clock_hz == clock_hz) buzzer_notes = BUZZER_NOTE_TABLES[i].notes;
+    }
+    for (uint8_t i = 0; i < buzzer_voice_count; i++) buzzer_voices[i].frequency = 0; // Divisores antigos não valem mais
+}
+
+// Cálculo em tempo de execução para frequências em Hz ou clocks sem tabela
+static void buzzer_solve(uint32_t freq_chz, buzzer_pwm_setting_t *setting)
+{
+    // Menor divisor (8.4) que faz o período caber em 16 bits, para a maior resolução de volume
+    uint64_t clock_1600 = (uint64_t) buzzer_notes_clock_hz * 1600u;
+    uint64_t span = (uint64_t) freq_chz * 65536u;
+    uint32_t div_16 = (uint32_t) ((clock_1600 + span - 1) / span);
+    if (div_16 < 16) div_16 = 16;
+    else if (div_16 > 0xFFF) div_16 = 0xFFF;
+    uint64_t period = (clock_1600 + (uint64_t) div_16 * freq_chz / 2) / ((uint64_t) div_16 * freq_chz);
+    if (period > 65536) period = 65536;
+    else if (period < 2) period = 2;
+    setting->div_16 = (uint16_t) div_16;
+    setting->top = (uint16_t) (period - 1);
+}
+
+static void buzzer_set_frequency(buzzer_voice_t *voice, uint16_t frequency)
+{
+    if (frequency == voice->frequency) return; // Mesma nota: mantém divisor e wrap
+
+    buzzer_pwm_setting_t setting;
+    if ((frequency & BUZZER_MIDI_FLAG) && buzzer_notes) {
+        setting = buzzer_notes[frequency & 0x7F]; // Afinação exata, sem divisões
+    } else if (frequency & BUZZER_MIDI_FLAG) {
+        buzzer_solve(BUZZER_MIDI_FREQ_CHZ[frequency & 0x7F], &setting);
+    } else {
+        buzzer_solve((uint32_t) frequency * 100u, &setting);
+    }
+
+    hal_pwm_set_divider_wrap(voice->gpio, setting.div_16, setting.top);
+    voice->top = setting.top;
+    voice->frequency = frequency;
+}
+
+static void buzzer_output(buzzer_voice_t *voice, const buzzer_note_t *note)
+{
+    if (note->frequency == BUZZER_REST || note->volume == 0) {
+        voice->volume = 0;
+        hal_pwm_set_level(voice->gpio, 0);
+        return;
+    }
+    buzzer_select_table();
+    buzzer_set_frequency(voice, note->frequency);
+    voice->volume = (note->volume > BUZZER_VOLUME_MAX) ? BUZZER_VOLUME_MAX : note->volume;
+    // Volume máximo = ciclo de trabalho de 50%
+    hal_pwm_set_level(voice->gpio, (uint16_t) (((uint32_t) voice->top + 1) * voice->volume / (2u * BUZZER_VOLUME_MAX)));
+}
+
+// Troca de relógio: a nota em curso continua na mesma afinação, com o divisor do novo clk_sys
+static void buzzer_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    uint16_t playing[BUZZER_MAX_VOICES];
+    (void) sys_hz;
+    (void) user;
+    if (event != CLOCKMGR_POST_CHANGE) return;
+
+    for (uint8_t i = 0; i < buzzer_voice_count; i++) playing[i] = buzzer_voices[i].frequency;
+    buzzer_select_table(); // Troca a tabela e invalida os divisores de todas as vozes
+    for (uint8_t i = 0; i < buzzer_voice_count; i++) {
+        buzzer_voice_t *voice = &buzzer_voices[i];
+        if (!voice->active || voice->volume == 0 || playing[i] == 0) continue;
+        buzzer_set_frequency(voice, playing[i]);
+        hal_pwm_set_level(voice->gpio, (uint16_t) (((uint32_t) voice->top + 1) * voice->volume / (2u * BUZZER_VOLUME_MAX)));
+    }
+}
+
+// Inicia a próxima nota da fila; retorna a duração em us, ou 0 se a fila acabou
+static int64_t buzzer_next_note(buzzer_voice_t *voice)
+{
+    uint32_t tail = voice->tail;
+    if (tail == voice->head) {
+        hal_pwm_set_level(voice->gpio, 0);
+        voice->active = false;
+        return 0;
+    }
+    const buzzer_note_t *note = &voice->queue[tail & (BUZZER_QUEUE_LEN - 1)];
+    buzzer_output(voice, note);
+    int64_t duration_us = (int64_t) note->duration_ms * 1000;
+    voice->tail = tail + 1;
+    return duration_us ? duration_us : 1;
+}
+
+static int64_t buzzer_alarm_callback(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    uint32_t isr_start = work_isr_begin();
+    buzzer_voice_t *voice = (buzzer_voice_t *) user_data;
+    int64_t duration_us = buzzer_next_note(voice);
+    if (duration_us == 0) voice->alarm = 0;
+    work_isr_end(isr_start);
+    // Negativo: reagenda a partir do instante previsto deste alarme, sem acumular atraso entre notas
+    return -duration_us;
 }
 
 void buzzer_init(uint8_t buzzer_pin){
-    gpio_init(buzzer_pin);
-    gpio_set_dir(buzzer_pin, GPIO_OUT);
-    // Configurar o GPIO para PWM
-    gpio_set_function(buzzer_pin, GPIO_FUNC_PWM); 
+    // Configurar o GPIO para PWM (divisor 1, silencioso até a primeira nota)
+    hal_pwm_gpio_init(buzzer_pin, 16, 0xFFFF);
+
+    if (buzzer_find_voice(buzzer_pin) || buzzer_voice_count >= BUZZER_MAX_VOICES) return;
+    if (buzzer_voice_count == 0) clockmgr_register(buzzer_clock_changed, NULL);
+    buzzer_voice_t *voice = &buzzer_voices[buzzer_voice_count++];
+    voice->gpio = buzzer_pin;
+    voice->frequency = 0;
+    voice->top = 0;
+    voice->volume = 0;
+    voice->active = false;
+    voice->alarm = 0;
+    voice->head = voice->tail = 0;
+}
+
+bool buzzer_play(uint8_t buzzer_pin, const buzzer_note_t *notes, uint8_t count)
+{
+    buzzer_voice_t *voice = buzzer_find_voice(buzzer_pin);
+    if (!voice || count == 0) return false;
+
+    uint32_t head = voice->head;
+    if (BUZZER_QUEUE_LEN - (head - voice->tail) < count) return false;
+    for (uint8_t i = 0; i < count; i++) voice->queue[(head + i) & (BUZZER_QUEUE_LEN - 1)] = notes[i];
+    hal_dmb(); // Notas escritas antes de serem publicadas ao alarme
+    voice->head = head + count;
+
+    // Com o alarme mascarado, a voz não pode ficar ociosa entre o teste e o início
+    uint32_t status = hal_irq_save();
+    if (!voice->active) {
+        voice->active = true;
+        int64_t duration_us = buzzer_next_note(voice);
+        voice->alarm = hal_alarm_in_us((uint64_t) duration_us, buzzer_alarm_callback, voice, true);
+        if (voice->alarm <= 0) {
+            // Sem alarmes livres: silencia em vez de manter a nota indefinidamente
+            hal_pwm_set_level(voice->gpio, 0);
+            voice->tail = voice->head;
+            voice->active = false;
+        }
+    }
+    hal_irq_restore(status);
+    return true;
 }
 
 void buzzer_beep(uint8_t buzzer_pin, uint16_t duration, uint16_t frequency){
-    buzzer_set_frequency(buzzer_pin, frequency);
-    sleep_ms(duration);
-    pwm_set_gpio_level(buzzer_pin, 0);
+    buzzer_note_t note = { frequency, duration, BUZZER_VOLUME_MAX };
+    buzzer_play(buzzer_pin, &note, 1);
  }
+
+void buzzer_stop(uint8_t buzzer_pin)
+{
+    buzzer_voice_t *voice = buzzer_find_voice(buzzer_pin);
+    if (!voice) return;
+
+    uint32_t status = hal_irq_save();
+    if (voice->alarm > 0) hal_alarm_cancel(voice->alarm);
+    voice->alarm = 0;
+    voice->tail = voice->head;
+    voice->active = false;
+    hal_pwm_set_level(voice->gpio, 0);
+    hal_irq_restore(status);
+}
+
+bool buzzer_is_playing(uint8_t buzzer_pin)
+{
+    buzzer_voice_t *voice = buzzer_find_voice(buzzer_pin);
+    return voice && voice->active;
+}
@@ -1,23 +1,115 @@
 #ifndef MLT8530_H
 #define MLT8530_H
 
-#include "pico/stdlib.h"
+#include "hal.h"
 
 /** 
  * @file rgb.h
  * @brief Este arquivo contém declarações de funções e definições relacionadas a um
  *        buzzer conectado aos pinos GPIO
  *
+ * Cada buzzer inicializado com `buzzer_init` é uma voz independente com sua
+ * própria fila de notas. As notas são tocadas por alarmes de hardware, de
+ * modo que nenhuma função deste módulo bloqueia quem a chama; dois buzzers
+ * permitem melodias simples a duas vozes e efeitos sonoros simultâneos.
+ *
+ * @note O buzzer no GPIO 10 divide o slice 5 de PWM com o LED verde (GPIO 11):
+ *       enquanto ele toca, o período do LED verde acompanha o da nota.
+ *
  * @author Carlos Valadao
  * @date 17/01/2025
  */
 
 #define BUZZER_PIN 21
 
+/**
+ * @brief Quantidade máxima de buzzers (vozes) simultâneos.
+ */
+#define BUZZER_MAX_VOICES 2
+
+/**
+ * @brief Capacidade da fila de notas de cada voz (potência de 2).
+ */
+#define BUZZER_QUEUE_LEN 32
+
+/**
+ * @brief Volume máximo de uma nota (ciclo de trabalho de 50%).
+ */
+#define BUZZER_VOLUME_MAX 100
+
+/**
+ * @brief Frequência que representa uma pausa (silêncio) na fila.
+ */
+#define BUZZER_REST 0
+
+/**
+ * @brief Bit de `buzzer_note_t.frequency` que indica uma nota MIDI em vez de Hz.
+ */
+#define BUZZER_MIDI_FLAG 0x8000u
+
+/**
+ * @brief Codifica a nota MIDI `n` (0 a 127, 69 = Lá 440 Hz) no campo de frequência.
+ *
+ * Notas MIDI usam divisor e wrap pré-calculados em `mlt8530_notes.h` para o
+ * clock atual, com afinação exata e sem divisões ao iniciar a nota.
+ */
+#define BUZZER_MIDI(n) ((uint16_t) (BUZZER_MIDI_FLAG | ((n) & 0x7Fu)))
+
+/**
+ * @brief Nota da fila de um buzzer.
+ */
+typedef struct
+{
+    uint16_t frequency;   /**< Frequência em Hz, `BUZZER_MIDI(n)` ou `BUZZER_REST` para pausa */
+    uint16_t duration_ms; /**< Duração em milissegundos */
+    uint8_t volume;       /**< Volume de 0 a `BUZZER_VOLUME_MAX` */
+} buzzer_note_t;
+
 #define buzzer_beep_default(duration, frequency) buzzer_beep(BUZZER_PIN, duration, frequency)
 #define buzzer_init_default() buzzer_init(BUZZER_PIN)
 
+/**
+ * @brief Configura o pino como PWM e registra o buzzer como uma voz.
+ *
+ * @param buzzer_pin Pino GPIO do buzzer.
+ */
 void buzzer_init(uint8_t buzzer_pin);
+
+/**
+ * @brief Coloca um beep na fila do buzzer (não bloqueia).
+ *
+ * @param buzzer_pin Pino GPIO do buzzer.
+ * @param duration Duração em milissegundos.
+ * @param frequency Frequência em Hz.
+ */
 void buzzer_beep(uint8_t buzzer_pin, uint16_t duration, uint16_t frequency);
 
+/**
+ * @brief Coloca uma sequência de notas na fila do buzzer (não bloqueia).
+ *
+ * A sequência é enfileirada por inteiro ou não é enfileirada; se a voz
+ * estiver parada, a primeira nota começa imediatamente.
+ *
+ * @param buzzer_pin Pino GPIO do buzzer.
+ * @param notes Notas a tocar, em ordem.
+ * @param count Quantidade de notas.
+ * @return `false` se o buzzer não foi inicializado ou não há espaço na fila.
+ */
+bool buzzer_play(uint8_t buzzer_pin, const buzzer_note_t *notes, uint8_t count);
+
+/**
+ * @brief Interrompe a nota atual e descarta a fila do buzzer.
+ *
+ * @param buzzer_pin Pino GPIO do buzzer.
+ */
+void buzzer_stop(uint8_t buzzer_pin);
+
+/**
+ * @brief Informa se o buzzer está tocando ou tem notas na fila.
+ *
+ * @param buzzer_pin Pino GPIO do buzzer.
+ * @return `true` enquanto houver nota em andamento.
+ */
+bool buzzer_is_playing(uint8_t buzzer_pin);
+
 #endif // MLT8530_H
@@ -0,0 +1,162 @@
+#ifndef MLT8530_NOTES_H
+#define MLT8530_NOTES_H
+
+/**
+ * @file mlt8530_notes.h
+ * @brief Tabelas de divisor/wrap de PWM para as notas MIDI (gerado por tools/gen_buzzer_notes.py).
+ *
+ * Não edite à mão: altere o script e gere novamente.
+ */
+
+#include <stdint.h>
+
+/** @brief Quantidade de notas MIDI tabeladas. */
+#define BUZZER_MIDI_NOTES 128
+
+/** @brief Configuração de PWM de uma nota: divisor em 8.4 e valor de wrap. */
+typedef struct
+{
+    uint16_t div_16; /**< Divisor de clock em ponto fixo 8.4 */
+    uint16_t top;    /**< Wrap do contador (período - 1) */
+} buzzer_pwm_setting_t;
+
+/** @brief Frequência de cada nota MIDI em centésimos de Hz (para clocks sem tabela). */
+static const uint32_t BUZZER_MIDI_FREQ_CHZ[BUZZER_MIDI_NOTES] = {
+        818,     866,     918,     972,    1030,    1091,    1156,    1225,
+       1298,    1375,    1457,    1543,    1635,    1732,    1835,    1945,
+       2060,    2183,    2312,    2450,    2596,    2750,    2914,    3087,
+       3270,    3465,    3671,    3889,    4120,    4365,    4625,    4900,
+       5191,    5500,    5827,    6174,    6541,    6930,    7342,    7778,
+       8241,    8731,    9250,    9800,   10383,   11000,   11654,   12347,
+      13081,   13859,   14683,   15556,   16481,   17461,   18500,   19600,
+      20765,   22000,   23308,   24694,   26163,   27718,   29366,   31113,
+      32963,   34923,   36999,   39200,   41530,   44000,   46616,   49388,
+      52325,   55437,   58733,   62225,   65926,   69846,   73999,   78399,
+      83061,   88000,   93233,   98777,  104650,  110873,  117466,  124451,
+     131851,  139691,  147998,  156798,  166122,  176000,  186466,  197553,
+     209300,  221746,  234932,  248902,  263702,  279383,  295996,  313596,
+     332244,  352000,  372931,  395107,  418601,  443492,  469864,  497803,
+     527404,  558765,  591991,  627193,  664488,  704000,  745862,  790213,
+     837202,  886984,  939727,  995606, 1054808, 1117530, 1183982, 1254385,
+};
+
+/** @brief Notas MIDI com clk_sys = 48000 kHz. */
+static const buzzer_pwm_setting_t BUZZER_NOTES_48000KHZ[BUZZER_MIDI_NOTES] = {
+    {1777, 52861}, {3089, 28702}, {1393, 60076}, {1653, 47785}, {1778, 41932}, {1886, 37312},
+    {1554, 42742}, {1014, 61828}, {1527, 38752}, {1381, 40444}, { 888, 59368}, {1103, 45113},
+    {1777, 26430}, { 952, 46566}, { 799, 52369}, {1653, 23892}, { 889, 41932}, { 943, 37312},
+    { 777, 42742}, { 507, 61828}, {1009, 29323}, { 451, 61922}, { 444, 59368}, {1103, 22556},
+    { 399, 58856}, { 476, 46566}, { 799, 26184}, { 363, 54400}, {1417, 13153}, { 907, 19396},
+    { 328, 50626}, { 617, 25402}, {1009, 14661}, { 226, 61785}, { 222, 59368}, { 313, 39744},
+    { 739, 15888}, { 238, 46566}, { 243, 43048}, { 467, 21142}, {1417,  6576}, {1321,  6658},
+    { 164, 50626}, { 194, 40395}, {1009,  7330}, { 113, 61785}, { 111, 59368}, { 105, 59238},
+    {  98, 59907}, { 119, 46566}, { 437, 11968}, { 105, 47017}, { 379, 12294}, { 509,  8640},
+    {  82, 50626}, {  97, 40395}, { 113, 32729}, { 113, 30892}, {  52, 63364}, {  68, 45735},
+    {  49, 59907}, { 157, 17647}, {  41, 63785}, { 105, 23508}, { 839,  2776}, {  38, 57871},
+    {  41, 50626}, {  97, 20197}, { 113, 16364}, {  31, 56304}, {  26, 63364}, {  34, 45735},
+    {  34, 43168}, { 157,  8823}, {  41, 31892}, {  41, 30102}, { 223,  5223}, {  19, 57871},
+    {  27, 38438}, {  97, 10098}, {  23, 40200}, {  19, 45932}, {  19, 43354}, {  17, 45735},
+    {  17, 43168}, { 157,  4411}, {  49, 13342}, {  18, 34283}, { 223,  2611}, {  19, 28935},
+    {  47, 11040}, {  19, 25778}, {  18, 25683}, {  43, 10147}, {  16, 25741}, {  17, 22867},
+    {  29, 12652}, { 157,  2205}, {  24, 13620}, {  18, 17141}, { 223,  1305}, {  19, 14467},
+    {  23, 11280}, {  20, 12244}, {  18, 12841}, {  43,  5073}, {  16, 12870}, {  17, 11433},
+    { 143,  1282}, { 157,  1102}, {  53,  3083}, {  18,  8570}, { 223,   652}, {  19,  7233},
+    {  19,  6827}, {  25,  4897}, {  18,  6420}, {  43,  2536}, {  61,  1687}, {  17,  5716},
+    {  35,  2620}, {  79,  1095}, {  53,  1541}, {  27,  2856}, {  18,  4044}, {  19,  3616},
+    {  19,  3413}, {  25,  2448},
+};
+
+/** @brief Notas MIDI com clk_sys = 125000 kHz. */
+static const buzzer_pwm_setting_t BUZZER_NOTES_125000KHZ[BUZZER_MIDI_NOTES] = {
+    {4089, 59824}, {3997, 57766}, {3575, 60960}, {3455, 59537}, {3529, 55017}, {3949, 46406},
+    {3561, 48574}, {3649, 44742}, {2857, 53938}, {2424, 60005}, {2159, 63589}, {3214, 40318},
+    {2751, 44460}, {2911, 39658}, {1908, 57110}, {2073, 49614}, {3529, 27508}, {2206, 41536},
+    {2064, 41902}, {1742, 46861}, {1580, 48766}, {1212, 60005}, {2159, 31794}, {1607, 40318},
+    {1111, 55045}, { 921, 62674}, { 954, 57110}, {2019, 25470}, {1046, 46404}, {1103, 41536},
+    {1032, 41902}, { 871, 46861}, { 790, 48766}, { 606, 60005}, {1387, 24745}, { 599, 54083},
+    {1111, 27522}, { 521, 55396}, { 477, 57110}, { 429, 59936}, { 523, 46404}, {1035, 22132},
+    { 516, 41902}, { 871, 23430}, { 395, 48766}, { 303, 60005}, {1387, 12372}, { 599, 27041},
+    {1807,  8460}, { 309, 46701}, {1019, 13366}, {1289,  9973}, { 311, 39018}, { 209, 54802},
+    { 258, 41902}, { 180, 56689}, { 172, 55996}, { 219, 41510}, { 403, 21291}, { 599, 13520},
+    { 118, 64783}, { 309, 23350}, { 181, 37626}, {1289,  4986}, { 119, 50986}, { 265, 21610},
+    { 129, 41902}, {  90, 56689}, {  86, 55996}, { 281, 16175}, { 403, 10645}, {  79, 51259},
+    {  59, 64783}, {  70, 51538}, {  59, 57715}, {  51, 63021}, { 421,  7205}, {  86, 33295},
+    { 443,  6100}, {  45, 56689}, {  43, 55996}, { 281,  8087}, { 403,  5322}, {  55, 36813},
+    {  59, 32391}, {  35, 51538}, {  47, 36225}, {  51, 31510}, { 421,  3602}, {  43, 33295},
+    {  22, 61425}, {  25, 51020}, {  19, 63364}, { 281,  4043}, {  18, 59587}, {  55, 18406},
+    {  59, 16195}, {  59, 15286}, {  47, 18112}, {  26, 30904}, {  16, 47401}, {  43, 16647},
+    {  22, 30712}, {  31, 20572}, {  16, 37622}, { 281,  2021}, {  18, 29793}, {  16, 31636},
+    {  59,  8097}, { 121,  3726}, {  27, 15764}, {  35, 11478}, {  16, 23700}, {  43,  8323},
+    {  18, 18768}, {  16, 19929}, {  24, 12540}, { 281,  1010}, {  18, 14896}, {  17, 14887},
+    {  59,  4048}, {  28,  8052}, {  22,  9673}, {  29,  6926}, { 137,  1383}, {  43,  4161},
+    { 137,  1232}, {  16,  9964},
+};
+
+/** @brief Notas MIDI com clk_sys = 128000 kHz. */
+static const buzzer_pwm_setting_t BUZZER_NOTES_128000KHZ[BUZZER_MIDI_NOTES] = {
+    {3864, 64827}, {3707, 63780}, {3946, 56554}, {3872, 54400}, {3122, 63682}, {4067, 46141},
+    {3581, 49462}, {2564, 65204}, {2981, 52935}, {2529, 58894}, {2636, 53332}, {2069, 64134},
+    {2410, 51969}, {2235, 52893}, {2579, 43265}, {2149, 49008}, {1561, 63682}, {4067, 23070},
+    {2072, 42742}, {1282, 65204}, {2036, 38752}, {1804, 41281}, {1318, 53332}, {1097, 60480},
+    {1205, 51969}, {1497, 39484}, {2579, 21632}, {2159, 24390}, {1396, 35604}, {1198, 39160},
+    {1036, 42742}, { 641, 65204}, {1018, 38752}, { 902, 41281}, { 659, 53332}, { 741, 44768},
+    {1205, 25984}, {1919, 15400}, { 795, 35088}, { 551, 47785}, { 698, 35604}, { 599, 39160},
+    { 518, 42742}, { 338, 61828}, { 509, 38752}, { 451, 41281}, { 296, 59368}, {1103, 15037},
+    { 266, 58856}, {1049, 14086}, { 324, 43048}, { 551, 23892}, { 349, 35604}, { 513, 22862},
+    { 259, 42742}, { 169, 61828}, { 199, 49560}, { 451, 20640}, { 148, 59368}, {1103,  7518},
+    { 133, 58856}, { 156, 47362}, { 162, 43048}, { 121, 54400}, { 163, 38116}, {1879,  3120},
+    {  86, 64362}, { 659,  7927}, { 113, 43639}, {  97, 47984}, {  74, 59368}, {  70, 59238},
+    {  72, 54360}, {  78, 47362}, {  81, 43048}, { 111, 29650}, { 215, 14448}, { 463,  6332},
+    {  43, 64362}, { 659,  3963}, { 113, 21819}, {  38, 61243}, {  37, 59368}, {  35, 59238},
+    {  36, 54360}, {  39, 47362}, { 157, 11104}, {  35, 47017}, {  29, 53560}, {  23, 63742},
+    { 103, 13434}, { 659,  1981}, { 113, 10909}, {  19, 61243}, { 269,  4082}, { 229,  4526},
+    {  18, 54360}, {  53, 17425}, {  41, 21261}, {  35, 23508}, { 143,  5430}, {  26, 28193},
+    {  18, 38438}, { 659,   990}, { 113,  5454}, {  19, 30621}, {  22, 24961}, {  22, 23560},
+    {  16, 30577}, {  53,  8712}, {  41, 10630}, {  16, 25712}, { 193,  2011}, {  26, 14096},
+    {  27, 12812}, {  19, 17185}, {  89,  3462}, {  19, 15310}, {  22, 12480}, {  30,  8638},
+    {  16, 15288}, {  21, 10994}, {  16, 13620}, {  18, 11427}, { 193,  1005}, {  37,  4952},
+    {  16, 10810}, {  19,  8592},
+};
+
+/** @brief Notas MIDI com clk_sys = 133000 kHz. */
+static const buzzer_pwm_setting_t BUZZER_NOTES_133000KHZ[BUZZER_MIDI_NOTES] = {
+    {4024, 64681}, {4006, 61325}, {4077, 56875}, {3946, 55465}, {3166, 65250}, {3018, 64608},
+    {2832, 64987}, {3446, 50410}, {2956, 55468}, {2995, 51673}, {3183, 45892}, {2742, 50283},
+    {2049, 63513}, {2883, 42606}, {2169, 53453}, {1973, 55465}, {2968, 34801}, {1509, 64608},
+    {1416, 64987}, {1723, 50410}, {1478, 55468}, {2995, 25836}, {1473, 49584}, {1371, 50283},
+    {2049, 31756}, {2003, 30662}, {1359, 42656}, {1973, 27732}, {1484, 34801}, { 881, 55331},
+    { 708, 64987}, { 682, 63678}, { 739, 55468}, {1981, 19530}, {2357, 15493}, { 914, 37712},
+    { 503, 64681}, { 791, 38822}, {1159, 25008}, { 419, 65294}, { 742, 34801}, { 477, 51097},
+    { 354, 64987}, { 341, 63678}, { 418, 49032}, { 442, 43767}, {2357,  7746}, { 457, 37712},
+    { 503, 32340}, { 278, 55231}, { 555, 26112}, { 517, 26458}, { 371, 34801}, { 261, 46692},
+    { 177, 64987}, { 449, 24180}, { 209, 49032}, { 221, 43767}, { 218, 41879}, { 140, 61552},
+    { 182, 44690}, { 139, 55231}, { 309, 23450}, { 167, 40955}, { 371, 17400}, { 107, 56947},
+    { 118, 48740}, { 122, 44496}, { 130, 39414}, { 221, 21883}, { 109, 41879}, {  70, 61552},
+    {  91, 44690}, { 139, 27615}, {  78, 46450}, { 167, 20477}, { 647,  4988}, { 107, 28473},
+    {  59, 48740}, {  61, 44496}, {  65, 39414}, { 221, 10941}, {  60, 38040}, {  35, 61552},
+    {  32, 63544}, { 139, 13807}, {  39, 46450}, { 167, 10238}, {  59, 27354}, { 107, 14236},
+    {  34, 42289}, { 109, 12450}, {  27, 47443}, { 221,  5470}, {  30, 38040}, { 157,  6860},
+    {  16, 63544}, { 139,  6903}, {  43, 21064}, {  23, 37171}, {  30, 26898}, {  16, 47604},
+    {  17, 42289}, {  33, 20562}, {  18, 35582}, {  41, 14744}, { 109,  5234}, {  29, 18571},
+    {  20, 25417}, { 139,  3451}, {  17, 26640}, {  23, 18585}, {  37, 10904}, {  20, 19041},
+    {  17, 21144}, {  35,  9693}, {  27, 11860}, {  16, 18891}, {  37,  7710}, {  29,  9285},
+    {  20, 12708}, { 139,  1725}, {  27,  8386}, {  23,  9292}, {  19, 10617}, {  20,  9520},
+    {  28,  6418}, {  35,  4846},
+};
+
+/** @brief Associação entre clk_sys (Hz) e tabela de notas. */
+typedef struct
+{
+    uint32_t clock_hz;                   /**< Frequência de sistema da tabela */
+    const buzzer_pwm_setting_t *notes;   /**< Tabela de 128 notas */
+} buzzer_note_table_t;
+
+/** @brief Tabelas disponíveis (pior erro de afinação entre parênteses). */
+static const buzzer_note_table_t BUZZER_NOTE_TABLES[] = {
+    {48000000u, BUZZER_NOTES_48000KHZ}, // (0.0017%)
+    {125000000u, BUZZER_NOTES_125000KHZ}, // (0.0004%)
+    {128000000u, BUZZER_NOTES_128000KHZ}, // (0.0003%)
+    {133000000u, BUZZER_NOTES_133000KHZ}, // (0.0004%)
+};
+
+#endif // MLT8530_NOTES_H
@@ -0,0 +1,57 @@
+#ifndef OLED_ASSETS_H
+#define OLED_ASSETS_H
+
+/**
+ * @file oled_assets.h
+ * @brief Imagens do display (1 bit, PackBits) geradas por tools/gen_oled_assets.py.
+ *
+ * Não edite à mão: altere o script e gere novamente.
+ */
+
+#include "oledgfx.h"
+
+/** @brief SPLASH: 128x64 pixels, 401 bytes (1024 sem compressão). */
+static const uint8_t OLED_ASSET_SPLASH_DATA[401] = {
+    0xff, 0xff, 0xfd, 0x03, 0xed, 0xc3, 0xfd, 0x03, 0xf1, 0xc3, 0xf5, 0x03, 0xf5, 0xc3, 0xf5, 0x03,
+    0xf1, 0xc3, 0xfd, 0x03, 0xed, 0xc3, 0xfd, 0x03, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff, 0xf1, 0x03,
+    0xfd, 0x00, 0xfd, 0xff, 0xf5, 0x03, 0xfd, 0xfc, 0xfd, 0x00, 0xfd, 0xfc, 0xf5, 0x03, 0xfd, 0xfc,
+    0xfd, 0x00, 0xfd, 0xfc, 0xf1, 0x03, 0xfd, 0x00, 0xfd, 0xff, 0xf1, 0x03, 0xfd, 0x00, 0xfd, 0xff,
+    0xfd, 0x00, 0xfd, 0xff, 0xf5, 0x3c, 0xf9, 0x00, 0xfd, 0xff, 0xfd, 0x3c, 0xfd, 0xfc, 0xfd, 0x3c,
+    0xfd, 0x03, 0xfd, 0x00, 0xfd, 0xff, 0xf5, 0x3c, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0x03, 0xf5, 0x3c,
+    0xfd, 0xc0, 0xfd, 0x00, 0xfd, 0xff, 0xf5, 0x3c, 0xf9, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0xff,
+    0xf1, 0xc0, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xfd, 0x03, 0xfd, 0x3c, 0xfd, 0xc0, 0xfd, 0x00,
+    0xfd, 0xff, 0xf5, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xf1, 0xc0, 0xfd, 0x3f, 0xfd, 0x00, 0xfd, 0xff,
+    0xf1, 0xc0, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x00, 0xed, 0x03, 0xfd, 0x00, 0xfd, 0x03, 0xf5, 0x00,
+    0xfd, 0x03, 0xfe, 0x00, 0x00, 0xc0, 0xfd, 0xc3, 0xfc, 0xc0, 0xff, 0x00, 0xfc, 0xc0, 0xfd, 0xc3,
+    0x00, 0xc0, 0xfe, 0x00, 0xf1, 0x03, 0xf9, 0x00, 0xed, 0x03, 0xfd, 0x00, 0xfd, 0xff, 0xca, 0x00,
+    0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xca, 0x00, 0xfd, 0xff, 0xf9, 0x00, 0xff, 0xc0, 0xff, 0x00,
+    0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xf7, 0x00, 0xff, 0xc0, 0xff, 0x00,
+    0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0x01, 0x00,
+    0x0c, 0xff, 0xcc, 0x03, 0x0c, 0x0f, 0xcf, 0xcc, 0xff, 0x0c, 0x01, 0xcc, 0xc0, 0xfc, 0x00, 0xff,
+    0x0f, 0xfe, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff,
+    0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff,
+    0xc0, 0xf7, 0x00, 0xff, 0xc0, 0xff, 0x00, 0xff, 0xc0, 0xfb, 0x00, 0xfd, 0xff, 0xfb, 0xc0, 0xff,
+    0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xf9,
+    0xc0, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff,
+    0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff,
+    0xcc, 0xf9, 0xc0, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff,
+    0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xff,
+    0xc3, 0xff, 0xcc, 0xf9, 0xc0, 0xff, 0xc3, 0xff, 0xcc, 0xff, 0xc3, 0xff, 0xcc, 0xfb, 0xc0, 0xff,
+    0xff,
+};
+static const oledgfx_asset_t OLED_ASSET_SPLASH = { OLED_ASSET_SPLASH_DATA, sizeof(OLED_ASSET_SPLASH_DATA), 128, 8 };
+
+/** @brief GAME_OVER: 96x40 pixels, 122 bytes (480 sem compressão). */
+static const uint8_t OLED_ASSET_GAME_OVER_DATA[122] = {
+    0xfe, 0xff, 0xf6, 0x07, 0xed, 0xc7, 0xfd, 0x07, 0xed, 0xc7, 0xfd, 0x07, 0xfd, 0xc7, 0xf5, 0x07,
+    0xfd, 0xc7, 0xf6, 0x07, 0xfb, 0xff, 0xf6, 0x00, 0xfd, 0xff, 0xf1, 0x03, 0xfd, 0x00, 0xf9, 0x03,
+    0xfd, 0xff, 0xf9, 0x03, 0xfd, 0x00, 0xfd, 0xff, 0xfd, 0x3c, 0xfd, 0xc0, 0xfd, 0x3c, 0xfd, 0xff,
+    0xf6, 0x00, 0xfb, 0xff, 0xf6, 0x00, 0xfd, 0xff, 0xf5, 0x3c, 0xf1, 0x00, 0xfd, 0xff, 0xf5, 0x00,
+    0xfd, 0xff, 0xfd, 0x00, 0xfd, 0x3f, 0xfd, 0x00, 0xfd, 0xff, 0xf6, 0x00, 0xfb, 0xff, 0xf6, 0x00,
+    0xfd, 0xff, 0xed, 0x00, 0xf9, 0xc0, 0xfd, 0xff, 0xf9, 0xc0, 0xfd, 0x00, 0xfd, 0xff, 0xf5, 0x00,
+    0xfd, 0xff, 0xf6, 0x00, 0xfb, 0xff, 0xf6, 0xe0, 0xfd, 0xe3, 0xed, 0xe0, 0xed, 0xe3, 0xfd, 0xe0,
+    0xfd, 0xe3, 0xf5, 0xe0, 0xfd, 0xe3, 0xf6, 0xe0, 0xfe, 0xff,
+};
+static const oledgfx_asset_t OLED_ASSET_GAME_OVER = { OLED_ASSET_GAME_OVER_DATA, sizeof(OLED_ASSET_GAME_OVER_DATA), 96, 5 };
+
+#endif // OLED_ASSETS_H
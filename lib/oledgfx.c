@@ -1,4 +1,5 @@
 #include "oledgfx.h"
+#include "clockmgr.h"
 
 /**
  * @file oledgfx.c
@@ -44,6 +45,27 @@ volatile int8_t last_cursor_x = INVALID_CURSOR;
  */
 volatile int8_t last_cursor_y = INVALID_CURSOR;
 
+/**
+ * @brief Taxa do I2C do display, refeita a cada troca de relógio.
+ */
+static uint oledgfx_i2c_baudrate;
+
+/**
+ * @brief Troca de relógio: refaz o divisor do I2C do display.
+ *
+ * Quem envia os quadros já terminou o envio em curso (registrado depois, é
+ * avisado antes).
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio (não usado; o divisor é lido do SDK).
+ * @param user Barramento I2C.
+ */
+static void oledgfx_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    (void) sys_hz;
+    if (event == CLOCKMGR_POST_CHANGE) hal_i2c_set_baudrate((hal_i2c_t *) user, oledgfx_i2c_baudrate);
+}
+
 /**
  * @brief Inicializa o display OLED SSD1306.
  *
@@ -58,13 +80,11 @@ volatile int8_t last_cursor_y = INVALID_CURSOR;
  * @param[in] scl Pino GPIO utilizado para SCL.
  * @param[in] address Endereço I2C do display OLED.
  */
-void oledgfx_init_all(ssd1306_t *ssd, i2c_inst_t *i2c, uint baudrate, uint8_t sda, uint8_t scl, uint8_t address)
+void oledgfx_init_all(ssd1306_t *ssd, hal_i2c_t *i2c, uint baudrate, uint8_t sda, uint8_t scl, uint8_t address)
 {
-    i2c_init(i2c, baudrate); // Inicializa a comunicação I2C com a taxa especificada
-    gpio_set_function(sda, GPIO_FUNC_I2C); // Define os pinos SDA e SCL para função I2C
-    gpio_set_function(scl, GPIO_FUNC_I2C);
-    gpio_pull_up(sda); // Habilita pull-up nos pinos I2C
-    gpio_pull_up(scl);
+    hal_i2c_init(i2c, baudrate, sda, scl); // Inicializa o I2C com a taxa especificada e pull-up em SDA e SCL
+    oledgfx_i2c_baudrate = baudrate;
+    clockmgr_register(oledgfx_clock_changed, i2c);
     ssd1306_init(ssd, WIDTH, HEIGHT, false, address, i2c); // Inicializa o display SSD1306
     ssd1306_config(ssd); // Configura o display
     ssd1306_send_data(ssd); // Atualiza o display
@@ -82,6 +102,7 @@ void oledgfx_init_all(ssd1306_t *ssd, i2c_inst_t *i2c, uint baudrate, uint8_t sd
 void oledgfx_clear_screen(ssd1306_t *ssd)
 {
     ssd1306_fill(ssd, 0);
+    ssd->start_line = 0;
 }
 
 /**
@@ -124,11 +145,24 @@ void oledgfx_draw_cursor(ssd1306_t *ssd, uint8_t x, uint8_t y)
     last_cursor_y = y;
 }
 
+/**
+ * @brief Esquece a posição anterior do cursor (início de partida).
+ *
+ * Sem isso, a primeira atualização de uma partida apagaria o quadrado onde o
+ * cursor terminou a partida anterior.
+ */
+void oledgfx_reset_cursor(void)
+{
+    last_cursor_x = INVALID_CURSOR;
+    last_cursor_y = INVALID_CURSOR;
+}
+
 /**
  * @brief Atualiza a posição do cursor no display.
  *
  * Apaga a posição anterior do cursor e desenha a nova posição.
- * O cursor é representado por um quadrado de 8x8 pixels.
+ * O cursor é representado por um quadrado de 8x8 pixels. Após
+ * `oledgfx_reset_cursor`, a primeira chamada apenas desenha.
  *
  * @todo Implementar atualização do cursor para evitar rastros.
  *
@@ -138,7 +172,8 @@ void oledgfx_draw_cursor(ssd1306_t *ssd, uint8_t x, uint8_t y)
  */
 void oledgfx_update_cursor(ssd1306_t *ssd, uint8_t x, uint8_t y)
 {
-    oledgfx_toggle_cursor(ssd, last_cursor_x, last_cursor_y, 0);
+    // Sem posição anterior (início da partida) não há o que apagar
+    if (last_cursor_x != INVALID_CURSOR) oledgfx_toggle_cursor(ssd, last_cursor_x, last_cursor_y, 0);
     oledgfx_toggle_cursor(ssd, x, y, 1);
     last_cursor_x = x;
     last_cursor_y = y;
@@ -287,4 +322,43 @@ uint16_t oledgfx_count_lit_pixels(ssd1306_t *ssd) {
         }
     }
     return count;
-}
\ No newline at end of file
+}
+
+bool oledgfx_draw_asset(ssd1306_t *ssd, const oledgfx_asset_t *asset, uint8_t x, uint8_t page)
+{
+    if (x + asset->width > ssd->width || page + asset->pages > ssd->pages) return false;
+
+    const uint8_t *src = asset->data;
+    const uint8_t *src_end = asset->data + asset->length;
+    uint8_t stride = ssd->pages;                              // Endereçamento vertical: a coluna seguinte está 8 bytes adiante
+    uint8_t *row = ssd->ram_buffer + 1 + x * stride + page;   // Início da página atual
+    uint8_t *dst = row;
+    uint8_t left = asset->width;                              // Bytes até o fim da página atual
+    uint8_t pages_left = asset->pages;
+
+    while (pages_left && src < src_end)
+    {
+        uint8_t header = *src++;
+        if (header == 128) continue;
+
+        bool repeat = header > 128;
+        uint8_t count = repeat ? (uint8_t) (257 - header) : (uint8_t) (header + 1);
+        const uint8_t *literal = src;
+        src += repeat ? 1 : count;
+        if (src > src_end) return false;
+
+        for (; count; count--)
+        {
+            if (!pages_left) return false;  // Mais bytes que a imagem
+            *dst = repeat ? *literal : *literal++;
+            dst += stride;
+            if (--left == 0)
+            {
+                pages_left--;
+                dst = ++row;
+                left = asset->width;
+            }
+        }
+    }
+    return pages_left == 0;
+}
@@ -48,6 +48,22 @@
 #define BORDER_THICK 3
 #define BORDER_LIGHT 1
 
+/**
+ * @brief Imagem de 1 bit comprimida, guardada na flash (veja `lib/oled_assets.h`).
+ *
+ * Os bytes descomprimidos vão página a página e, em cada página, da esquerda
+ * para a direita (bit 0 = linha de cima). A compressão é PackBits: um
+ * cabeçalho `n` seguido de `n + 1` bytes literais (`n` < 128) ou de um byte
+ * repetido `257 - n` vezes (`n` > 128); `n` = 128 é ignorado.
+ */
+typedef struct
+{
+    const uint8_t *data; /**< Dados comprimidos */
+    uint16_t length;     /**< Bytes comprimidos */
+    uint8_t width;       /**< Largura em pixels */
+    uint8_t pages;       /**< Altura em páginas de 8 linhas */
+} oledgfx_asset_t;
+
 /** 
  * @brief Última posição X do cursor no display OLED.
  */
@@ -70,12 +86,13 @@ extern volatile int8_t last_cursor_y;
  * @param[in] scl Pino GPIO utilizado para SCL.
  * @param[in] address Endereço I2C do display OLED.
  */
-void oledgfx_init_all(ssd1306_t *ssd, i2c_inst_t *i2c, uint baudrate, uint8_t sda, uint8_t scl, uint8_t address);
+void oledgfx_init_all(ssd1306_t *ssd, hal_i2c_t *i2c, uint baudrate, uint8_t sda, uint8_t scl, uint8_t address);
 
 /**
  * @brief Limpa a tela do display OLED.
  *
- * Preenche o display inteiro com cor preta (desligando todos os pixels).
+ * Preenche o display inteiro com cor preta (desligando todos os pixels) e
+ * volta a linha inicial do display para 0 (sem a rolagem do nível).
  *
  * @param[out] ssd Ponteiro para a estrutura do display SSD1306.
  */
@@ -92,10 +109,15 @@ void oledgfx_clear_screen(ssd1306_t *ssd);
  */
 void oledgfx_draw_cursor(ssd1306_t *ssd, uint8_t x, uint8_t y);
 
+/**
+ * @brief Esquece a posição anterior do cursor; chamada no início de cada partida.
+ */
+void oledgfx_reset_cursor(void);
+
 /**
  * @brief Atualiza a posição do cursor no display.
  *
- * Apaga a posição anterior do cursor e desenha a nova posição.
+ * Apaga a posição anterior do cursor (se houver) e desenha a nova posição.
  *
  * @param[out] ssd Ponteiro para a estrutura do display SSD1306.
  * @param[in] x Nova posição X do cursor.
@@ -173,6 +195,22 @@ void oledgfx_draw_border(ssd1306_t *ssd, uint8_t thickness);
 
 void oledgfx_random_fill_display(ssd1306_t *ssd);
 
+/**
+ * @brief Descomprime uma imagem direto no framebuffer.
+ *
+ * Cada byte vai para a sua posição no `ram_buffer` assim que é lido, sem
+ * buffer intermediário. A página é a da RAM do display: com a linha inicial
+ * fora de 0 (rolagem do nível), chame `oledgfx_clear_screen` antes.
+ *
+ * @param[out] ssd Ponteiro para a estrutura do display SSD1306.
+ * @param[in] asset Imagem.
+ * @param[in] x Coluna do canto esquerdo.
+ * @param[in] page Página do topo (0 a 7).
+ * @return `false` se a imagem não couber na tela (nada é desenhado) ou se os
+ *         dados comprimidos não corresponderem ao tamanho da imagem.
+ */
+bool oledgfx_draw_asset(ssd1306_t *ssd, const oledgfx_asset_t *asset, uint8_t x, uint8_t page);
+
 uint16_t oledgfx_count_lit_pixels(ssd1306_t *ssd);
 
 /** @} */ // Fim do grupo "OLED_Graphics"
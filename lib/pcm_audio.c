@@ -0,0 +1,192 @@
+#include "pcm_audio.h"
+#include "clockmgr.h"
+#include "workqueue.h"
+
+/**
+ * @file pcm_audio.c
+ * @brief Mixagem por blocos e reprodução em ping-pong por DMA.
+ *
+ * Cada palavra de 32 bits dos blocos contém o nível nas duas metades (canais
+ * A e B do slice), de modo que a escrita no CC funciona para qualquer pino.
+ * A HAL toca os dois blocos alternadamente (no RP2040, dois canais de DMA
+ * encadeados) e, ao fim de cada um, o bloco que acabou de tocar é mixado de
+ * novo e rearmado.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @def PCM_PWM_WRAP
+ * @brief Wrap da portadora: 8 bits de resolução (500 kHz a 128 MHz).
+ */
+#define PCM_PWM_WRAP 255u
+
+/**
+ * @def PCM_SILENT_BLOCKS
+ * @brief Blocos de silêncio após a última voz antes de parar o DMA (esvazia o ping-pong).
+ */
+#define PCM_SILENT_BLOCKS 2
+
+/**
+ * @brief Estado de uma voz.
+ */
+typedef struct
+{
+    const uint8_t *next;  /**< Próxima amostra */
+    uint32_t remaining;   /**< Amostras restantes (0 = voz livre) */
+    uint16_t volume;      /**< Volume em Q8 */
+} pcm_voice_t;
+
+static pcm_voice_t pcm_voices[PCM_MAX_VOICES];
+static uint32_t pcm_blocks[2][PCM_BLOCK_SAMPLES];
+static volatile bool pcm_running = false;
+static uint8_t pcm_silent_blocks = 0;
+
+/**
+ * @brief Mixa as vozes ativas em um bloco de saída.
+ *
+ * @param block Bloco a preencher.
+ * @return `true` se alguma voz contribuiu para o bloco.
+ */
+static bool pcm_mix_block(uint32_t *block)
+{
+    int32_t *acc = (int32_t *) block; // Acumula no próprio bloco, sem usar a pilha da interrupção
+    bool active = false;
+
+    for (uint32_t i = 0; i < PCM_BLOCK_SAMPLES; i++) acc[i] = 0;
+
+    for (uint8_t v = 0; v < PCM_MAX_VOICES; v++)
+    {
+        pcm_voice_t *voice = &pcm_voices[v];
+        if (voice->remaining == 0) continue;
+        active = true;
+        uint32_t n = (voice->remaining < PCM_BLOCK_SAMPLES) ? voice->remaining : PCM_BLOCK_SAMPLES;
+        const uint8_t *src = voice->next;
+        int32_t volume = voice->volume;
+        for (uint32_t i = 0; i < n; i++) acc[i] += (((int32_t) src[i] - 128) * volume) >> 8;
+        voice->next = src + n;
+        voice->remaining -= n;
+    }
+
+    for (uint32_t i = 0; i < PCM_BLOCK_SAMPLES; i++)
+    {
+        int32_t level = acc[i] + 128;
+        if (level < 0) level = 0;
+        else if (level > (int32_t) PCM_PWM_WRAP) level = PCM_PWM_WRAP;
+        block[i] = ((uint32_t) level << 16) | (uint32_t) level; // Canais A e B do CC
+    }
+    return active;
+}
+
+/**
+ * @brief Para o fluxo e apaga a saída.
+ */
+static void pcm_halt(void)
+{
+    hal_pwm_stream_stop();
+    pcm_running = false;
+}
+
+/**
+ * @brief Fim de bloco (em interrupção): remixa e rearma o bloco que acabou de tocar.
+ *
+ * @param block Índice do bloco.
+ */
+static void pcm_block_done(uint8_t block)
+{
+    uint32_t isr_start = work_isr_begin();
+    if (pcm_mix_block(pcm_blocks[block])) pcm_silent_blocks = 0;
+    else pcm_silent_blocks++;
+    if (pcm_silent_blocks >= PCM_SILENT_BLOCKS) pcm_halt();
+    else hal_pwm_stream_rearm(block);
+    work_isr_end(isr_start);
+}
+
+/**
+ * @brief Troca de relógio: mantém a taxa de amostragem, mesmo no meio de um som.
+ *
+ * A portadora tem wrap fixo e só muda de frequência, sem mudar o volume.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio (não usado; a fração é lida da HAL).
+ * @param user Não utilizado.
+ */
+static void pcm_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    (void) sys_hz;
+    (void) user;
+    if (event == CLOCKMGR_POST_CHANGE) hal_pwm_stream_set_rate(PCM_SAMPLE_RATE_HZ);
+}
+
+/**
+ * @brief Configura a saída PWM do pino e o fluxo de blocos da HAL.
+ *
+ * @param gpio Pino do buzzer.
+ * @return `false` se não houver canais ou timers de DMA livres.
+ */
+bool pcm_audio_init(uint8_t gpio)
+{
+    if (!hal_pwm_stream_init(gpio, PCM_PWM_WRAP, pcm_blocks[0], pcm_blocks[1], PCM_BLOCK_SAMPLES, pcm_block_done)) return false;
+    clockmgr_register(pcm_clock_changed, NULL);
+    return true;
+}
+
+/**
+ * @brief Começa a tocar uma amostra em uma voz livre (não bloqueia).
+ *
+ * @param sample Amostra a tocar.
+ * @param volume Volume em Q8.
+ */
+void pcm_audio_play(const pcm_sample_t *sample, uint16_t volume)
+{
+    uint32_t status = hal_irq_save();
+
+    // Voz livre, ou a que está mais perto do fim
+    pcm_voice_t *voice = &pcm_voices[0];
+    for (uint8_t v = 1; v < PCM_MAX_VOICES; v++)
+    {
+        if (pcm_voices[v].remaining < voice->remaining) voice = &pcm_voices[v];
+    }
+    voice->next = sample->data;
+    voice->remaining = sample->length;
+    voice->volume = volume;
+
+    if (!pcm_running)
+    {
+        pcm_silent_blocks = 0;
+        for (uint8_t i = 0; i < 2; i++) pcm_mix_block(pcm_blocks[i]);
+        pcm_running = true;
+        hal_pwm_stream_start(PCM_SAMPLE_RATE_HZ);
+    }
+
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Interrompe todas as vozes e desliga a saída.
+ */
+void pcm_audio_stop_all(void)
+{
+    uint32_t status = hal_irq_save();
+    for (uint8_t v = 0; v < PCM_MAX_VOICES; v++) pcm_voices[v].remaining = 0;
+    if (pcm_running) pcm_halt();
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Informa se alguma voz está tocando.
+ *
+ * @return `true` enquanto houver amostras sendo reproduzidas.
+ */
+bool pcm_audio_is_playing(void)
+{
+    for (uint8_t v = 0; v < PCM_MAX_VOICES; v++)
+    {
+        if (pcm_voices[v].remaining) return true;
+    }
+    return false;
+}
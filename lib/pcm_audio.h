@@ -0,0 +1,102 @@
+#ifndef PCM_AUDIO_H
+#define PCM_AUDIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+
+/**
+ * @file pcm_audio.h
+ * @brief Reprodução de amostras PCM de 8 bits em um buzzer, via PWM e DMA.
+ *
+ * O pino do buzzer gera uma portadora PWM de 8 bits (clk_sys / 256, acima da
+ * faixa audível) cujo ciclo de trabalho segue a amostra atual. Dois canais de
+ * DMA encadeados em ping-pong copiam blocos já mixados para o registrador de
+ * comparação (CC) do slice, no ritmo de um timer de DMA configurado para
+ * `PCM_SAMPLE_RATE_HZ`. A CPU só atua uma vez por bloco (interrupção de fim de
+ * transferência), para mixar até `PCM_MAX_VOICES` amostras lidas da flash.
+ *
+ * @note O pino passa a ser de uso exclusivo deste módulo; não use
+ *       `buzzer_play` no mesmo buzzer.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup PCM_Audio Áudio PCM
+ * @brief Efeitos sonoros amostrados no buzzer.
+ * @{
+ */
+
+/**
+ * @def PCM_SAMPLE_RATE_HZ
+ * @brief Taxa de amostragem das amostras e da reprodução.
+ */
+#define PCM_SAMPLE_RATE_HZ 16000u
+
+/**
+ * @def PCM_MAX_VOICES
+ * @brief Quantidade de amostras tocadas (mixadas) ao mesmo tempo.
+ */
+#define PCM_MAX_VOICES 2
+
+/**
+ * @def PCM_BLOCK_SAMPLES
+ * @brief Amostras por bloco de DMA (uma interrupção a cada bloco, 16 ms a 16 kHz).
+ */
+#define PCM_BLOCK_SAMPLES 256
+
+/**
+ * @def PCM_VOLUME_MAX
+ * @brief Volume unitário de uma voz (Q8).
+ */
+#define PCM_VOLUME_MAX 256u
+
+/**
+ * @brief Amostra PCM de 8 bits sem sinal (128 = silêncio), normalmente em flash.
+ */
+typedef struct
+{
+    const uint8_t *data; /**< Amostras */
+    uint32_t length;     /**< Quantidade de amostras */
+} pcm_sample_t;
+
+/**
+ * @brief Configura o PWM do pino, os dois canais de DMA e o timer de DMA.
+ *
+ * @param gpio Pino do buzzer.
+ * @return `false` se não houver canais ou timers de DMA livres.
+ */
+bool pcm_audio_init(uint8_t gpio);
+
+/**
+ * @brief Começa a tocar uma amostra em uma voz livre (não bloqueia).
+ *
+ * Se todas as vozes estiverem ocupadas, a que está mais perto do fim é substituída.
+ *
+ * @param sample Amostra a tocar; deve permanecer válida até o fim da reprodução.
+ * @param volume Volume em Q8 (`PCM_VOLUME_MAX` = volume original).
+ */
+void pcm_audio_play(const pcm_sample_t *sample, uint16_t volume);
+
+/**
+ * @brief Interrompe todas as vozes e desliga a saída.
+ */
+void pcm_audio_stop_all(void);
+
+/**
+ * @brief Informa se alguma voz está tocando.
+ *
+ * @return `true` enquanto houver amostras sendo reproduzidas.
+ */
+bool pcm_audio_is_playing(void);
+
+/** @} */ // Fim do grupo "PCM_Audio"
+
+#endif // PCM_AUDIO_H
@@ -0,0 +1,1027 @@
+#ifndef PCM_SFX_H
+#define PCM_SFX_H
+
+/**
+ * @file pcm_sfx.h
+ * @brief Efeitos sonoros PCM (8 bits, 16000 Hz) gerados por tools/gen_pcm_sfx.py.
+ *
+ * Não edite à mão: altere o script e gere novamente.
+ */
+
+#include "pcm_audio.h"
+
+#if PCM_SAMPLE_RATE_HZ != 16000
+#error "pcm_sfx.h foi gerado para outra taxa de amostragem"
+#endif
+
+/** @brief CRUNCH: 1120 amostras (70 ms). */
+static const uint8_t PCM_SFX_CRUNCH_DATA[1120] = {
+    0x5c, 0x5c, 0x5c, 0x3a, 0x3a, 0x3a, 0x9e, 0x9e, 0x9e, 0x2c, 0x2c, 0x2c, 0x87, 0x87, 0x87, 0x66,
+    0x66, 0x66, 0x2c, 0x2c, 0x2c, 0x81, 0x81, 0x81, 0x2a, 0x2a, 0x2a, 0x74, 0x74, 0x74, 0x31, 0x32,
+    0x32, 0x36, 0x36, 0x36, 0x72, 0x73, 0x73, 0xba, 0xba, 0xba, 0x3e, 0x3e, 0x3e, 0x50, 0x50, 0x50,
+    0x96, 0x96, 0x96, 0xcc, 0xcc, 0xcc, 0x8d, 0x8d, 0x8d, 0x6f, 0x6f, 0x6f, 0xcf, 0xce, 0xce, 0x36,
+    0x36, 0x36, 0xba, 0xba, 0xba, 0x5e, 0x5e, 0x5f, 0x48, 0x48, 0x48, 0x44, 0x44, 0x45, 0x62, 0x62,
+    0x63, 0xb0, 0xb0, 0xb0, 0x50, 0x50, 0x50, 0x8c, 0x8c, 0x8c, 0x95, 0x95, 0x95, 0x6d, 0x6d, 0x6d,
+    0x87, 0x87, 0x87, 0x41, 0x41, 0x41, 0x41, 0x41, 0x42, 0x57, 0x57, 0x57, 0x99, 0x99, 0x99, 0x76,
+    0x76, 0x76, 0x67, 0x67, 0x67, 0x8c, 0x8c, 0x8c, 0x7a, 0x7a, 0x7a, 0x65, 0x66, 0x66, 0xa7, 0xa6,
+    0xa6, 0x9a, 0x9a, 0x9a, 0x5f, 0x5f, 0x5f, 0x89, 0x89, 0x89, 0x83, 0x83, 0x83, 0xaf, 0xaf, 0xae,
+    0x9c, 0x9c, 0x9c, 0x66, 0x66, 0x66, 0xba, 0xba, 0xba, 0x52, 0x53, 0x53, 0x76, 0x76, 0x76, 0x9e,
+    0x9e, 0x9e, 0x58, 0x58, 0x58, 0x7f, 0x7f, 0x7f, 0x4c, 0x4c, 0x4c, 0x93, 0x93, 0x93, 0x9d, 0x9d,
+    0x9d, 0x88, 0x88, 0x88, 0xa9, 0xa9, 0xa9, 0x6c, 0x6c, 0x6c, 0x95, 0x95, 0x95, 0x8a, 0x8a, 0x8a,
+    0x88, 0x88, 0x88, 0x7b, 0x7b, 0x7c, 0xa3, 0xa3, 0xa2, 0xad, 0xad, 0xad, 0x7d, 0x7d, 0x7d, 0x90,
+    0x90, 0x90, 0x55, 0x55, 0x55, 0x94, 0x93, 0x93, 0x8e, 0x8e, 0x8e, 0xaf, 0xaf, 0xaf, 0x9e, 0x9e,
+    0x9e, 0x6c, 0x6c, 0x6c, 0x75, 0x76, 0x76, 0x8f, 0x8f, 0x8f, 0x55, 0x55, 0x55, 0x7d, 0x7d, 0x7d,
+    0x63, 0x63, 0x63, 0x5f, 0x5f, 0x5f, 0x5a, 0x5a, 0x5a, 0x97, 0x97, 0x97, 0x61, 0x61, 0x61, 0x6b,
+    0x6b, 0x6b, 0x77, 0x77, 0x77, 0x9e, 0x9e, 0x9e, 0x5e, 0x5e, 0x5e, 0x7c, 0x7c, 0x7c, 0x84, 0x84,
+    0x84, 0x9e, 0x9e, 0x9e, 0x99, 0x99, 0x99, 0x9c, 0x9c, 0x9c, 0x6f, 0x6f, 0x6f, 0x7a, 0x7a, 0x7a,
+    0x75, 0x75, 0x76, 0x9c, 0x9c, 0x9c, 0xa2, 0xa1, 0xa1, 0x67, 0x67, 0x67, 0x69, 0x69, 0x69, 0x6d,
+    0x6d, 0x6d, 0x6d, 0x6d, 0x6d, 0x7f, 0x7f, 0x7f, 0x86, 0x86, 0x86, 0x70, 0x70, 0x70, 0x5f, 0x5f,
+    0x5f, 0x7b, 0x7b, 0x7b, 0x77, 0x77, 0x77, 0x84, 0x84, 0x84, 0x9d, 0x9d, 0x9d, 0x8c, 0x8c, 0x8c,
+    0x81, 0x81, 0x81, 0x87, 0x87, 0x87, 0x8b, 0x8b, 0x8b, 0x65, 0x65, 0x65, 0x98, 0x98, 0x98, 0x91,
+    0x91, 0x91, 0x96, 0x96, 0x96, 0x92, 0x91, 0x91, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x69, 0x69,
+    0x6a, 0x88, 0x88, 0x88, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x70, 0x70, 0x70, 0x6e, 0x6e, 0x6e,
+    0x77, 0x77, 0x77, 0x68, 0x68, 0x68, 0x66, 0x66, 0x66, 0x6e, 0x6e, 0x6e, 0x6c, 0x6c, 0x6c, 0x79,
+    0x79, 0x79, 0x68, 0x68, 0x68, 0x93, 0x93, 0x93, 0x86, 0x86, 0x86, 0x6f, 0x6f, 0x6f, 0x74, 0x74,
+    0x74, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x6e, 0x6e, 0x6e, 0x90, 0x90, 0x90, 0x97, 0x97, 0x96,
+    0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x6e, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x79, 0x79, 0x79, 0x76,
+    0x76, 0x76, 0x8e, 0x8e, 0x8e, 0x72, 0x72, 0x72, 0x6c, 0x6c, 0x6c, 0x93, 0x93, 0x92, 0x81, 0x81,
+    0x81, 0x72, 0x72, 0x72, 0x82, 0x82, 0x82, 0x6d, 0x6d, 0x6d, 0x81, 0x81, 0x81, 0x93, 0x92, 0x92,
+    0x8e, 0x8e, 0x8e, 0x87, 0x87, 0x87, 0x77, 0x77, 0x77, 0x7b, 0x7b, 0x7b, 0x74, 0x74, 0x74, 0x8a,
+    0x8a, 0x8a, 0x81, 0x81, 0x81, 0x8a, 0x8a, 0x8a, 0x7a, 0x7a, 0x7a, 0x76, 0x76, 0x76, 0x8b, 0x8b,
+    0x8b, 0x91, 0x91, 0x90, 0x8c, 0x8c, 0x8c, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x88, 0x88, 0x88,
+    0x77, 0x77, 0x77, 0x81, 0x81, 0x81, 0x7b, 0x7b, 0x7b, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x79,
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x86, 0x86, 0x86, 0x8e, 0x8e, 0x8e, 0x7e, 0x7e, 0x7e, 0x8d, 0x8d,
+    0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x7c, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x83, 0x83, 0x83, 0x8b, 0x8b, 0x8b, 0x89, 0x89, 0x89, 0x7f,
+    0x7f, 0x7f, 0x84, 0x84, 0x84, 0x88, 0x88, 0x88, 0x75, 0x76, 0x76, 0x84, 0x84, 0x84, 0x8a, 0x8a,
+    0x8a, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x7f, 0x7f, 0x7f, 0x78, 0x78, 0x78, 0x87, 0x87, 0x87,
+    0x7c, 0x7c, 0x7c, 0x87, 0x87, 0x87, 0x8b, 0x8b, 0x8b, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x8a,
+    0x8a, 0x8a, 0x85, 0x85, 0x85, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x88, 0x88,
+    0x88, 0x86, 0x86, 0x86, 0x79, 0x79, 0x79, 0x87, 0x87, 0x87, 0x8a, 0x8a, 0x8a, 0x83, 0x83, 0x83,
+    0x7d, 0x7d, 0x7d, 0x81, 0x81, 0x81, 0x79, 0x79, 0x79, 0x77, 0x77, 0x77, 0x89, 0x89, 0x89, 0x83,
+    0x83, 0x83, 0x80, 0x80, 0x80, 0x88, 0x88, 0x88, 0x7f, 0x7f, 0x7f, 0x87, 0x87, 0x87, 0x86, 0x86,
+    0x86, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x81, 0x81, 0x81,
+    0x7c, 0x7c, 0x7c, 0x7f, 0x7f, 0x7f, 0x7a, 0x7a, 0x7a, 0x87, 0x87, 0x87, 0x7e, 0x7e, 0x7e, 0x7f,
+    0x7f, 0x7f, 0x81, 0x81, 0x81, 0x86, 0x86, 0x86, 0x7f, 0x7f, 0x7f, 0x86, 0x86, 0x86, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x79, 0x79, 0x79, 0x7f, 0x7f, 0x7f, 0x7b, 0x7b, 0x7c,
+    0x79, 0x79, 0x79, 0x84, 0x84, 0x84, 0x7b, 0x7b, 0x7c, 0x80, 0x80, 0x80, 0x83, 0x83, 0x83, 0x81,
+    0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x84, 0x84, 0x84, 0x7b, 0x7b,
+    0x7b, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x83, 0x83, 0x83, 0x80, 0x80, 0x80,
+    0x81, 0x81, 0x81, 0x83, 0x83, 0x83, 0x85, 0x85, 0x85, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x85, 0x85, 0x85, 0x82, 0x82, 0x82, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x7e, 0x7e, 0x7e,
+    0x81, 0x81, 0x81, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7f,
+    0x7f, 0x7f, 0x7c, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x7c, 0x7c, 0x7c, 0x82, 0x82, 0x82, 0x83, 0x83,
+    0x83, 0x84, 0x84, 0x84, 0x7d, 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x7d, 0x7d, 0x7d,
+    0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x7e, 0x7e, 0x7e, 0x84, 0x84, 0x84, 0x7f, 0x7f, 0x7f, 0x80,
+    0x80, 0x80, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
+    0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x82, 0x82, 0x82, 0x7c, 0x7c, 0x7d,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7d, 0x7d, 0x7d, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x80,
+    0x80, 0x80, 0x7d, 0x7d, 0x7d, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x7d, 0x7d,
+    0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x82, 0x82, 0x82, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
+    0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x82,
+    0x82, 0x82, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x81, 0x81,
+    0x81, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
+    0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x7e, 0x7e, 0x7e, 0x82, 0x82, 0x82, 0x80, 0x80, 0x80, 0x7f,
+    0x7f, 0x7f, 0x80, 0x80, 0x80, 0x82, 0x82, 0x82, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x80,
+    0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
+};
+static const pcm_sample_t PCM_SFX_CRUNCH = { PCM_SFX_CRUNCH_DATA, sizeof(PCM_SFX_CRUNCH_DATA) };
+
+/** @brief TICK: 400 amostras (25 ms). */
+static const uint8_t PCM_SFX_TICK_DATA[400] = {
+    0x80, 0xc9, 0xee, 0xde, 0xa2, 0x57, 0x22, 0x1a, 0x43, 0x88, 0xc7, 0xe3, 0xd0, 0x97, 0x54, 0x28,
+    0x27, 0x50, 0x8e, 0xc5, 0xd9, 0xc3, 0x8e, 0x53, 0x2f, 0x33, 0x5b, 0x93, 0xc1, 0xcf, 0xb8, 0x86,
+    0x53, 0x36, 0x3d, 0x64, 0x97, 0xbd, 0xc6, 0xae, 0x80, 0x54, 0x3d, 0x47, 0x6c, 0x99, 0xb9, 0xbe,
+    0xa5, 0x7b, 0x55, 0x44, 0x50, 0x72, 0x9a, 0xb5, 0xb6, 0x9d, 0x77, 0x56, 0x4a, 0x57, 0x78, 0x9b,
+    0xb1, 0xaf, 0x97, 0x74, 0x58, 0x50, 0x5e, 0x7c, 0x9b, 0xad, 0xa8, 0x91, 0x72, 0x5b, 0x55, 0x64,
+    0x80, 0x9b, 0xa9, 0xa3, 0x8c, 0x71, 0x5d, 0x5b, 0x6a, 0x83, 0x9a, 0xa5, 0x9d, 0x88, 0x70, 0x60,
+    0x5f, 0x6e, 0x85, 0x99, 0xa1, 0x99, 0x85, 0x70, 0x62, 0x64, 0x72, 0x87, 0x98, 0x9d, 0x94, 0x82,
+    0x6f, 0x65, 0x68, 0x76, 0x88, 0x97, 0x9a, 0x91, 0x80, 0x70, 0x67, 0x6b, 0x79, 0x89, 0x95, 0x97,
+    0x8e, 0x7e, 0x70, 0x6a, 0x6e, 0x7b, 0x8a, 0x94, 0x94, 0x8b, 0x7d, 0x71, 0x6c, 0x71, 0x7d, 0x8a,
+    0x92, 0x91, 0x88, 0x7c, 0x71, 0x6e, 0x74, 0x7f, 0x8a, 0x90, 0x8f, 0x86, 0x7b, 0x72, 0x70, 0x76,
+    0x80, 0x8a, 0x8f, 0x8d, 0x85, 0x7a, 0x73, 0x72, 0x78, 0x81, 0x8a, 0x8d, 0x8b, 0x83, 0x7a, 0x74,
+    0x74, 0x79, 0x82, 0x89, 0x8c, 0x89, 0x82, 0x7a, 0x75, 0x76, 0x7b, 0x83, 0x89, 0x8b, 0x88, 0x81,
+    0x7a, 0x76, 0x77, 0x7c, 0x83, 0x88, 0x8a, 0x86, 0x80, 0x7a, 0x77, 0x78, 0x7d, 0x83, 0x88, 0x88,
+    0x85, 0x7f, 0x7a, 0x78, 0x79, 0x7e, 0x84, 0x87, 0x87, 0x84, 0x7f, 0x7a, 0x79, 0x7b, 0x7f, 0x84,
+    0x87, 0x86, 0x83, 0x7e, 0x7b, 0x79, 0x7b, 0x80, 0x84, 0x86, 0x85, 0x82, 0x7e, 0x7b, 0x7a, 0x7c,
+    0x80, 0x84, 0x85, 0x85, 0x82, 0x7e, 0x7b, 0x7b, 0x7d, 0x80, 0x84, 0x85, 0x84, 0x81, 0x7e, 0x7c,
+    0x7c, 0x7e, 0x81, 0x83, 0x84, 0x83, 0x81, 0x7e, 0x7c, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x83, 0x80,
+    0x7e, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7d, 0x7f, 0x81, 0x83, 0x83,
+    0x82, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x83, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x80, 0x81,
+    0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7f,
+    0x80, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7e,
+    0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
+    0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
+    0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
+};
+static const pcm_sample_t PCM_SFX_TICK = { PCM_SFX_TICK_DATA, sizeof(PCM_SFX_TICK_DATA) };
+
+/** @brief GAME_OVER: 14400 amostras (900 ms). */
+static const uint8_t PCM_SFX_GAME_OVER_DATA[14400] = {
+    0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7b, 0x79, 0x76,
+    0x74, 0x71, 0x6d, 0x6a, 0x66, 0x65, 0x67, 0x69, 0x6b, 0x6d, 0x70, 0x73, 0x76, 0x7a, 0x7e, 0x82,
+    0x86, 0x8a, 0x8f, 0x94, 0x9a, 0x9f, 0xa5, 0xab, 0xb2, 0xb6, 0xb2, 0xae, 0xa9, 0xa4, 0x9f, 0x99,
+    0x93, 0x8d, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x63, 0x5b, 0x53, 0x4a, 0x42, 0x39, 0x2f, 0x33, 0x3a,
+    0x41, 0x49, 0x51, 0x59, 0x61, 0x6a, 0x73, 0x7c, 0x85, 0x8f, 0x99, 0xa3, 0xae, 0xb9, 0xc4, 0xcf,
+    0xdb, 0xe5, 0xe8, 0xdd, 0xd3, 0xc8, 0xbe, 0xb3, 0xa9, 0x9e, 0x93, 0x89, 0x7e, 0x74, 0x69, 0x5f,
+    0x54, 0x49, 0x3f, 0x34, 0x2a, 0x1f, 0x14, 0x1e, 0x29, 0x33, 0x3e, 0x49, 0x53, 0x5e, 0x68, 0x73,
+    0x7d, 0x88, 0x93, 0x9d, 0xa8, 0xb2, 0xbd, 0xc7, 0xd2, 0xdd, 0xe7, 0xe6, 0xdc, 0xd1, 0xc6, 0xbc,
+    0xb1, 0xa7, 0x9c, 0x91, 0x87, 0x7c, 0x72, 0x67, 0x5d, 0x52, 0x47, 0x3d, 0x32, 0x28, 0x1d, 0x16,
+    0x20, 0x2b, 0x35, 0x40, 0x4a, 0x55, 0x60, 0x6a, 0x75, 0x7f, 0x8a, 0x95, 0x9f, 0xaa, 0xb4, 0xbf,
+    0xc9, 0xd4, 0xdf, 0xe9, 0xe4, 0xda, 0xcf, 0xc4, 0xba, 0xaf, 0xa5, 0x9a, 0x90, 0x85, 0x7a, 0x70,
+    0x65, 0x5b, 0x50, 0x45, 0x3b, 0x30, 0x26, 0x1b, 0x18, 0x22, 0x2d, 0x37, 0x42, 0x4c, 0x57, 0x62,
+    0x6c, 0x77, 0x81, 0x8c, 0x96, 0xa1, 0xac, 0xb6, 0xc1, 0xcb, 0xd6, 0xe1, 0xeb, 0xe2, 0xd8, 0xcd,
+    0xc2, 0xb8, 0xad, 0xa3, 0x98, 0x8e, 0x83, 0x78, 0x6e, 0x63, 0x59, 0x4e, 0x44, 0x39, 0x2e, 0x24,
+    0x19, 0x19, 0x24, 0x2f, 0x39, 0x44, 0x4e, 0x59, 0x64, 0x6e, 0x79, 0x83, 0x8e, 0x98, 0xa3, 0xae,
+    0xb8, 0xc3, 0xcd, 0xd8, 0xe2, 0xeb, 0xe0, 0xd6, 0xcb, 0xc1, 0xb6, 0xab, 0xa1, 0x96, 0x8c, 0x81,
+    0x77, 0x6c, 0x61, 0x57, 0x4c, 0x42, 0x37, 0x2c, 0x22, 0x17, 0x1b, 0x26, 0x31, 0x3b, 0x46, 0x50,
+    0x5b, 0x65, 0x70, 0x7b, 0x85, 0x90, 0x9a, 0xa5, 0xaf, 0xba, 0xc5, 0xcf, 0xda, 0xe4, 0xe9, 0xde,
+    0xd4, 0xc9, 0xbf, 0xb4, 0xa9, 0x9f, 0x94, 0x8a, 0x7f, 0x75, 0x6a, 0x5f, 0x55, 0x4a, 0x40, 0x35,
+    0x2b, 0x20, 0x15, 0x1d, 0x28, 0x32, 0x3d, 0x48, 0x52, 0x5d, 0x67, 0x72, 0x7d, 0x87, 0x92, 0x9c,
+    0xa7, 0xb1, 0xbc, 0xc7, 0xd1, 0xdc, 0xe6, 0xe7, 0xdc, 0xd2, 0xc7, 0xbd, 0xb2, 0xa8, 0x9d, 0x92,
+    0x88, 0x7d, 0x73, 0x68, 0x5d, 0x53, 0x48, 0x3e, 0x33, 0x29, 0x1e, 0x15, 0x1f, 0x2a, 0x34, 0x3f,
+    0x4a, 0x54, 0x5f, 0x69, 0x74, 0x7e, 0x89, 0x94, 0x9e, 0xa9, 0xb3, 0xbe, 0xc9, 0xd3, 0xde, 0xe8,
+    0xe5, 0xda, 0xd0, 0xc5, 0xbb, 0xb0, 0xa6, 0x9b, 0x90, 0x86, 0x7b, 0x71, 0x66, 0x5c, 0x51, 0x46,
+    0x3c, 0x31, 0x27, 0x1c, 0x17, 0x21, 0x2c, 0x36, 0x41, 0x4c, 0x56, 0x61, 0x6b, 0x76, 0x80, 0x8b,
+    0x96, 0xa0, 0xab, 0xb5, 0xc0, 0xca, 0xd5, 0xe0, 0xea, 0xe3, 0xd9, 0xce, 0xc3, 0xb9, 0xae, 0xa4,
+    0x99, 0x8e, 0x84, 0x79, 0x6f, 0x64, 0x5a, 0x4f, 0x44, 0x3a, 0x2f, 0x25, 0x1a, 0x19, 0x23, 0x2e,
+    0x38, 0x43, 0x4d, 0x58, 0x63, 0x6d, 0x78, 0x82, 0x8d, 0x98, 0xa2, 0xad, 0xb7, 0xc2, 0xcc, 0xd7,
+    0xe2, 0xec, 0xe1, 0xd7, 0xcc, 0xc1, 0xb7, 0xac, 0xa2, 0x97, 0x8d, 0x82, 0x77, 0x6d, 0x62, 0x58,
+    0x4d, 0x42, 0x38, 0x2d, 0x23, 0x18, 0x1b, 0x25, 0x30, 0x3a, 0x45, 0x4f, 0x5a, 0x65, 0x6f, 0x7a,
+    0x84, 0x8f, 0x99, 0xa4, 0xaf, 0xb9, 0xc4, 0xce, 0xd9, 0xe4, 0xea, 0xdf, 0xd5, 0xca, 0xbf, 0xb5,
+    0xaa, 0xa0, 0x95, 0x8b, 0x80, 0x75, 0x6b, 0x60, 0x56, 0x4b, 0x41, 0x36, 0x2b, 0x21, 0x16, 0x1c,
+    0x27, 0x32, 0x3c, 0x47, 0x51, 0x5c, 0x67, 0x71, 0x7c, 0x86, 0x91, 0x9b, 0xa6, 0xb1, 0xbb, 0xc6,
+    0xd0, 0xdb, 0xe5, 0xe8, 0xdd, 0xd3, 0xc8, 0xbe, 0xb3, 0xa8, 0x9e, 0x93, 0x89, 0x7e, 0x73, 0x69,
+    0x5e, 0x54, 0x49, 0x3f, 0x34, 0x29, 0x1f, 0x14, 0x1e, 0x29, 0x34, 0x3e, 0x49, 0x53, 0x5e, 0x68,
+    0x73, 0x7e, 0x88, 0x93, 0x9d, 0xa8, 0xb3, 0xbd, 0xc8, 0xd2, 0xdd, 0xe7, 0xe6, 0xdb, 0xd1, 0xc6,
+    0xbc, 0xb1, 0xa6, 0x9c, 0x91, 0x87, 0x7c, 0x72, 0x67, 0x5c, 0x52, 0x47, 0x3d, 0x32, 0x27, 0x1d,
+    0x16, 0x20, 0x2b, 0x36, 0x40, 0x4b, 0x55, 0x60, 0x6a, 0x75, 0x80, 0x8a, 0x95, 0x9f, 0xaa, 0xb4,
+    0xbf, 0xca, 0xd4, 0xdf, 0xe9, 0xe4, 0xd9, 0xcf, 0xc4, 0xba, 0xaf, 0xa4, 0x9a, 0x8f, 0x85, 0x7a,
+    0x70, 0x65, 0x5a, 0x50, 0x45, 0x3b, 0x30, 0x26, 0x1b, 0x18, 0x22, 0x2d, 0x37, 0x42, 0x4d, 0x57,
+    0x62, 0x6c, 0x77, 0x82, 0x8c, 0x97, 0xa1, 0xac, 0xb6, 0xc1, 0xcc, 0xd6, 0xe1, 0xeb, 0xe2, 0xd7,
+    0xcd, 0xc2, 0xb8, 0xad, 0xa3, 0x98, 0x8d, 0x83, 0x78, 0x6e, 0x63, 0x58, 0x4e, 0x43, 0x39, 0x2e,
+    0x24, 0x19, 0x1a, 0x24, 0x2f, 0x39, 0x44, 0x4f, 0x59, 0x64, 0x6e, 0x79, 0x83, 0x8e, 0x99, 0xa3,
+    0xae, 0xb8, 0xc3, 0xce, 0xd8, 0xe3, 0xeb, 0xe0, 0xd5, 0xcb, 0xc0, 0xb6, 0xab, 0xa1, 0x96, 0x8b,
+    0x81, 0x76, 0x6c, 0x61, 0x57, 0x4c, 0x41, 0x37, 0x2c, 0x22, 0x17, 0x1c, 0x26, 0x31, 0x3b, 0x46,
+    0x51, 0x5b, 0x66, 0x70, 0x7b, 0x85, 0x90, 0x9b, 0xa5, 0xb0, 0xba, 0xc5, 0xcf, 0xda, 0xe5, 0xe9,
+    0xde, 0xd4, 0xc9, 0xbe, 0xb4, 0xa9, 0x9f, 0x94, 0x89, 0x7f, 0x74, 0x6a, 0x5f, 0x55, 0x4a, 0x3f,
+    0x35, 0x2a, 0x20, 0x15, 0x1e, 0x28, 0x33, 0x3d, 0x48, 0x52, 0x5d, 0x68, 0x72, 0x7d, 0x87, 0x92,
+    0x9c, 0xa7, 0xb2, 0xbc, 0xc7, 0xd1, 0xdc, 0xe7, 0xe7, 0xdc, 0xd2, 0xc7, 0xbc, 0xb2, 0xa7, 0x9d,
+    0x92, 0x88, 0x7d, 0x72, 0x68, 0x5d, 0x53, 0x48, 0x3e, 0x33, 0x28, 0x1e, 0x15, 0x1f, 0x2a, 0x35,
+    0x3f, 0x4a, 0x54, 0x5f, 0x6a, 0x74, 0x7f, 0x89, 0x94, 0x9e, 0xa9, 0xb4, 0xbe, 0xc9, 0xd3, 0xde,
+    0xe8, 0xe5, 0xda, 0xd0, 0xc5, 0xbb, 0xb0, 0xa5, 0x9b, 0x90, 0x86, 0x7b, 0x70, 0x66, 0x5b, 0x51,
+    0x46, 0x3c, 0x31, 0x26, 0x1c, 0x17, 0x21, 0x2c, 0x37, 0x41, 0x4c, 0x56, 0x61, 0x6b, 0x76, 0x81,
+    0x8b, 0x96, 0xa0, 0xab, 0xb6, 0xc0, 0xcb, 0xd5, 0xe0, 0xea, 0xe3, 0xd8, 0xce, 0xc3, 0xb9, 0xae,
+    0xa3, 0x99, 0x8e, 0x84, 0x79, 0x6f, 0x64, 0x59, 0x4f, 0x44, 0x3a, 0x2f, 0x24, 0x1a, 0x19, 0x23,
+    0x2e, 0x39, 0x43, 0x4e, 0x58, 0x63, 0x6d, 0x78, 0x83, 0x8d, 0x98, 0xa2, 0xad, 0xb7, 0xc2, 0xcd,
+    0xd7, 0xe2, 0xec, 0xe1, 0xd6, 0xcc, 0xc1, 0xb7, 0xac, 0xa1, 0x97, 0x8c, 0x82, 0x77, 0x6d, 0x62,
+    0x57, 0x4d, 0x42, 0x38, 0x2d, 0x23, 0x18, 0x1b, 0x25, 0x30, 0x3a, 0x45, 0x50, 0x5a, 0x65, 0x6f,
+    0x7a, 0x85, 0x8f, 0x9a, 0xa4, 0xaf, 0xb9, 0xc4, 0xcf, 0xd9, 0xe4, 0xea, 0xdf, 0xd4, 0xca, 0xbf,
+    0xb5, 0xaa, 0xa0, 0x95, 0x8a, 0x80, 0x75, 0x6b, 0x60, 0x55, 0x4b, 0x40, 0x36, 0x2b, 0x21, 0x16,
+    0x1d, 0x27, 0x32, 0x3c, 0x47, 0x52, 0x5c, 0x67, 0x71, 0x7c, 0x86, 0x91, 0x9c, 0xa6, 0xb1, 0xbb,
+    0xc6, 0xd1, 0xdb, 0xe6, 0xe8, 0xdd, 0xd2, 0xc8, 0xbd, 0xb3, 0xa8, 0x9e, 0x93, 0x88, 0x7e, 0x73,
+    0x69, 0x5e, 0x54, 0x49, 0x3e, 0x34, 0x29, 0x1f, 0x14, 0x1f, 0x29, 0x34, 0x3e, 0x49, 0x54, 0x5e,
+    0x69, 0x73, 0x7e, 0x88, 0x93, 0x9e, 0xa8, 0xb3, 0xbd, 0xc8, 0xd2, 0xdd, 0xe8, 0xe6, 0xdb, 0xd1,
+    0xc6, 0xbb, 0xb1, 0xa6, 0x9c, 0x91, 0x86, 0x7c, 0x71, 0x67, 0x5c, 0x52, 0x47, 0x3c, 0x32, 0x27,
+    0x1d, 0x16, 0x21, 0x2b, 0x36, 0x40, 0x4b, 0x55, 0x60, 0x6b, 0x75, 0x80, 0x8a, 0x95, 0xa0, 0xaa,
+    0xb5, 0xbf, 0xca, 0xd4, 0xdf, 0xea, 0xe4, 0xd9, 0xcf, 0xc4, 0xb9, 0xaf, 0xa4, 0x9a, 0x8f, 0x85,
+    0x7a, 0x6f, 0x65, 0x5a, 0x50, 0x45, 0x3a, 0x30, 0x25, 0x1b, 0x18, 0x23, 0x2d, 0x38, 0x42, 0x4d,
+    0x57, 0x62, 0x6d, 0x77, 0x82, 0x8c, 0x97, 0xa1, 0xac, 0xb7, 0xc1, 0xcc, 0xd6, 0xe1, 0xec, 0xe2,
+    0xd7, 0xcd, 0xc2, 0xb7, 0xad, 0xa2, 0x98, 0x8d, 0x83, 0x78, 0x6d, 0x63, 0x58, 0x4e, 0x43, 0x39,
+    0x2e, 0x23, 0x19, 0x1a, 0x24, 0x2f, 0x3a, 0x44, 0x4f, 0x59, 0x64, 0x6f, 0x79, 0x84, 0x8e, 0x99,
+    0xa3, 0xae, 0xb9, 0xc3, 0xce, 0xd8, 0xe3, 0xea, 0xe0, 0xd5, 0xcb, 0xc0, 0xb6, 0xab, 0xa0, 0x96,
+    0x8b, 0x81, 0x76, 0x6b, 0x61, 0x56, 0x4c, 0x41, 0x37, 0x2c, 0x21, 0x17, 0x1c, 0x26, 0x31, 0x3c,
+    0x46, 0x51, 0x5b, 0x66, 0x70, 0x7b, 0x86, 0x90, 0x9b, 0xa5, 0xb0, 0xbb, 0xc5, 0xd0, 0xda, 0xe5,
+    0xe8, 0xde, 0xd3, 0xc9, 0xbe, 0xb4, 0xa9, 0x9e, 0x94, 0x89, 0x7f, 0x74, 0x6a, 0x5f, 0x54, 0x4a,
+    0x3f, 0x35, 0x2a, 0x1f, 0x15, 0x1e, 0x28, 0x33, 0x3e, 0x48, 0x53, 0x5d, 0x68, 0x72, 0x7d, 0x88,
+    0x92, 0x9d, 0xa7, 0xb2, 0xbc, 0xc7, 0xd2, 0xdc, 0xe7, 0xe7, 0xdc, 0xd1, 0xc7, 0xbc, 0xb2, 0xa7,
+    0x9c, 0x92, 0x87, 0x7d, 0x72, 0x68, 0x5d, 0x52, 0x48, 0x3d, 0x33, 0x28, 0x1e, 0x15, 0x20, 0x2a,
+    0x35, 0x3f, 0x4a, 0x55, 0x5f, 0x6a, 0x74, 0x7f, 0x89, 0x94, 0x9f, 0xa9, 0xb4, 0xbe, 0xc9, 0xd4,
+    0xde, 0xe9, 0xe5, 0xda, 0xcf, 0xc5, 0xba, 0xb0, 0xa5, 0x9b, 0x90, 0x85, 0x7b, 0x70, 0x66, 0x5b,
+    0x51, 0x46, 0x3b, 0x31, 0x26, 0x1c, 0x17, 0x22, 0x2c, 0x37, 0x41, 0x4c, 0x57, 0x61, 0x6c, 0x76,
+    0x81, 0x8b, 0x96, 0xa1, 0xab, 0xb6, 0xc0, 0xcb, 0xd5, 0xe0, 0xeb, 0xe3, 0xd8, 0xce, 0xc3, 0xb8,
+    0xae, 0xa3, 0x99, 0x8e, 0x83, 0x79, 0x6e, 0x64, 0x59, 0x4f, 0x44, 0x39, 0x2f, 0x24, 0x1a, 0x19,
+    0x24, 0x2e, 0x39, 0x43, 0x4e, 0x58, 0x63, 0x6e, 0x78, 0x83, 0x8d, 0x98, 0xa3, 0xad, 0xb8, 0xc2,
+    0xcd, 0xd7, 0xe2, 0xeb, 0xe1, 0xd6, 0xcc, 0xc1, 0xb6, 0xac, 0xa1, 0x97, 0x8c, 0x82, 0x77, 0x6c,
+    0x62, 0x57, 0x4d, 0x42, 0x37, 0x2d, 0x22, 0x18, 0x1b, 0x26, 0x30, 0x3b, 0x45, 0x50, 0x5a, 0x65,
+    0x70, 0x7a, 0x85, 0x8f, 0x9a, 0xa4, 0xaf, 0xba, 0xc4, 0xcf, 0xd9, 0xe4, 0xe9, 0xdf, 0xd4, 0xca,
+    0xbf, 0xb4, 0xaa, 0x9f, 0x95, 0x8a, 0x80, 0x75, 0x6a, 0x60, 0x55, 0x4b, 0x40, 0x36, 0x2b, 0x20,
+    0x16, 0x1d, 0x27, 0x32, 0x3d, 0x47, 0x52, 0x5c, 0x67, 0x72, 0x7c, 0x87, 0x91, 0x9c, 0xa6, 0xb1,
+    0xbc, 0xc6, 0xd1, 0xdb, 0xe6, 0xe7, 0xdd, 0xd2, 0xc8, 0xbd, 0xb3, 0xa8, 0x9d, 0x93, 0x88, 0x7e,
+    0x73, 0x68, 0x5e, 0x53, 0x49, 0x3e, 0x34, 0x29, 0x1e, 0x14, 0x1f, 0x29, 0x34, 0x3f, 0x49, 0x54,
+    0x5e, 0x69, 0x73, 0x7e, 0x89, 0x93, 0x9e, 0xa8, 0xb3, 0xbe, 0xc8, 0xd3, 0xdd, 0xe8, 0xe5, 0xdb,
+    0xd0, 0xc6, 0xbb, 0xb1, 0xa6, 0x9b, 0x91, 0x86, 0x7c, 0x71, 0x67, 0x5c, 0x51, 0x47, 0x3c, 0x32,
+    0x27, 0x1c, 0x16, 0x21, 0x2b, 0x36, 0x41, 0x4b, 0x56, 0x60, 0x6b, 0x75, 0x80, 0x8b, 0x95, 0xa0,
+    0xaa, 0xb5, 0xbf, 0xca, 0xd5, 0xdf, 0xea, 0xe4, 0xd9, 0xce, 0xc4, 0xb9, 0xaf, 0xa4, 0x99, 0x8f,
+    0x84, 0x7a, 0x6f, 0x65, 0x5a, 0x4f, 0x45, 0x3a, 0x30, 0x25, 0x1b, 0x18, 0x23, 0x2d, 0x38, 0x42,
+    0x4d, 0x58, 0x62, 0x6d, 0x77, 0x82, 0x8d, 0x97, 0xa2, 0xac, 0xb7, 0xc1, 0xcc, 0xd7, 0xe1, 0xec,
+    0xe2, 0xd7, 0xcc, 0xc2, 0xb7, 0xad, 0xa2, 0x98, 0x8d, 0x82, 0x78, 0x6d, 0x63, 0x58, 0x4d, 0x43,
+    0x38, 0x2e, 0x23, 0x19, 0x1a, 0x25, 0x2f, 0x3a, 0x44, 0x4f, 0x5a, 0x64, 0x6f, 0x79, 0x84, 0x8e,
+    0x99, 0xa4, 0xae, 0xb9, 0xc3, 0xce, 0xd9, 0xe3, 0xea, 0xe0, 0xd5, 0xca, 0xc0, 0xb5, 0xab, 0xa0,
+    0x96, 0x8b, 0x80, 0x76, 0x6b, 0x61, 0x56, 0x4c, 0x41, 0x36, 0x2c, 0x21, 0x17, 0x1c, 0x27, 0x31,
+    0x3c, 0x46, 0x51, 0x5c, 0x66, 0x71, 0x7b, 0x86, 0x90, 0x9b, 0xa6, 0xb0, 0xbb, 0xc5, 0xd0, 0xda,
+    0xe5, 0xe8, 0xde, 0xd3, 0xc9, 0xbe, 0xb3, 0xa9, 0x9e, 0x94, 0x89, 0x7e, 0x74, 0x69, 0x5f, 0x54,
+    0x4a, 0x3f, 0x34, 0x2a, 0x1f, 0x15, 0x1e, 0x29, 0x33, 0x3e, 0x48, 0x53, 0x5d, 0x68, 0x73, 0x7d,
+    0x88, 0x92, 0x9d, 0xa8, 0xb2, 0xbd, 0xc7, 0xd2, 0xdc, 0xe7, 0xe6, 0xdc, 0xd1, 0xc7, 0xbc, 0xb1,
+    0xa7, 0x9c, 0x92, 0x87, 0x7d, 0x72, 0x67, 0x5d, 0x52, 0x48, 0x3d, 0x32, 0x28, 0x1d, 0x15, 0x20,
+    0x2b, 0x35, 0x40, 0x4a, 0x55, 0x5f, 0x6a, 0x75, 0x7f, 0x8a, 0x94, 0x9f, 0xa9, 0xb4, 0xbf, 0xc9,
+    0xd4, 0xde, 0xe9, 0xe4, 0xda, 0xcf, 0xc5, 0xba, 0xaf, 0xa5, 0x9a, 0x90, 0x85, 0x7b, 0x70, 0x65,
+    0x5b, 0x50, 0x46, 0x3b, 0x31, 0x26, 0x1b, 0x17, 0x22, 0x2c, 0x37, 0x42, 0x4c, 0x57, 0x61, 0x6c,
+    0x77, 0x81, 0x8c, 0x96, 0xa1, 0xab, 0xb6, 0xc1, 0xcb, 0xd6, 0xe0, 0xeb, 0xe2, 0xd8, 0xcd, 0xc3,
+    0xb8, 0xae, 0xa3, 0x98, 0x8e, 0x83, 0x79, 0x6e, 0x64, 0x59, 0x4e, 0x44, 0x39, 0x2f, 0x24, 0x19,
+    0x19, 0x24, 0x2e, 0x39, 0x44, 0x4e, 0x59, 0x63, 0x6e, 0x78, 0x83, 0x8e, 0x98, 0xa3, 0xad, 0xb8,
+    0xc2, 0xcd, 0xd8, 0xe2, 0xeb, 0xe1, 0xd6, 0xcb, 0xc1, 0xb6, 0xac, 0xa1, 0x96, 0x8c, 0x81, 0x77,
+    0x6c, 0x62, 0x57, 0x4c, 0x42, 0x37, 0x2d, 0x22, 0x18, 0x1b, 0x26, 0x30, 0x3b, 0x45, 0x50, 0x5b,
+    0x65, 0x70, 0x7a, 0x85, 0x90, 0x9a, 0xa5, 0xaf, 0xba, 0xc4, 0xcf, 0xda, 0xe4, 0xe9, 0xdf, 0xd4,
+    0xc9, 0xbf, 0xb4, 0xaa, 0x9f, 0x95, 0x8a, 0x7f, 0x75, 0x6a, 0x60, 0x55, 0x4a, 0x40, 0x35, 0x2b,
+    0x20, 0x16, 0x1d, 0x28, 0x32, 0x3d, 0x47, 0x52, 0x5d, 0x67, 0x72, 0x7c, 0x87, 0x91, 0x9c, 0xa7,
+    0xb1, 0xbc, 0xc6, 0xd1, 0xdc, 0xe6, 0xe7, 0xdd, 0xd2, 0xc7, 0xbd, 0xb2, 0xa8, 0x9d, 0x93, 0x88,
+    0x7d, 0x73, 0x68, 0x5e, 0x53, 0x49, 0x3e, 0x33, 0x29, 0x1e, 0x14, 0x1f, 0x2a, 0x34, 0x3f, 0x49,
+    0x54, 0x5f, 0x69, 0x74, 0x7e, 0x89, 0x93, 0x9e, 0xa9, 0xb3, 0xbe, 0xc8, 0xd3, 0xdd, 0xe8, 0xe5,
+    0xdb, 0xd0, 0xc6, 0xbb, 0xb0, 0xa6, 0x9b, 0x91, 0x86, 0x7b, 0x71, 0x66, 0x5c, 0x51, 0x47, 0x3c,
+    0x31, 0x27, 0x1c, 0x16, 0x21, 0x2c, 0x36, 0x41, 0x4b, 0x56, 0x60, 0x6b, 0x76, 0x80, 0x8b, 0x95,
+    0xa0, 0xab, 0xb5, 0xc0, 0xca, 0xd5, 0xdf, 0xea, 0xe3, 0xd9, 0xce, 0xc4, 0xb9, 0xae, 0xa4, 0x99,
+    0x8f, 0x84, 0x7a, 0x6f, 0x64, 0x5a, 0x4f, 0x45, 0x3a, 0x2f, 0x25, 0x1a, 0x18, 0x23, 0x2e, 0x38,
+    0x43, 0x4d, 0x58, 0x62, 0x6d, 0x78, 0x82, 0x8d, 0x97, 0xa2, 0xac, 0xb7, 0xc2, 0xcc, 0xd7, 0xe1,
+    0xec, 0xe1, 0xd7, 0xcc, 0xc2, 0xb7, 0xac, 0xa2, 0x97, 0x8d, 0x82, 0x78, 0x6d, 0x62, 0x58, 0x4d,
+    0x43, 0x38, 0x2e, 0x23, 0x18, 0x1a, 0x25, 0x2f, 0x3a, 0x45, 0x4f, 0x5a, 0x64, 0x6f, 0x7a, 0x84,
+    0x8f, 0x99, 0xa4, 0xae, 0xb9, 0xc4, 0xce, 0xd9, 0xe3, 0xea, 0xdf, 0xd5, 0xca, 0xc0, 0xb5, 0xab,
+    0xa0, 0x95, 0x8b, 0x80, 0x76, 0x6b, 0x60, 0x56, 0x4b, 0x41, 0x36, 0x2c, 0x21, 0x16, 0x1c, 0x27,
+    0x31, 0x3c, 0x47, 0x51, 0x5c, 0x66, 0x71, 0x7b, 0x86, 0x91, 0x9b, 0xa6, 0xb0, 0xbb, 0xc6, 0xd0,
+    0xdb, 0xe5, 0xe8, 0xdd, 0xd3, 0xc8, 0xbe, 0xb3, 0xa9, 0x9e, 0x93, 0x89, 0x7e, 0x74, 0x69, 0x5f,
+    0x54, 0x49, 0x3f, 0x34, 0x2a, 0x1f, 0x14, 0x1e, 0x29, 0x33, 0x3e, 0x49, 0x53, 0x5e, 0x68, 0x73,
+    0x7d, 0x88, 0x93, 0x9d, 0xa8, 0xb2, 0xbd, 0xc7, 0xd2, 0xdd, 0xe7, 0xe6, 0xdc, 0xd1, 0xc6, 0xbc,
+    0xb1, 0xa7, 0x9c, 0x91, 0x87, 0x7c, 0x72, 0x67, 0x5d, 0x52, 0x47, 0x3d, 0x32, 0x28, 0x1d, 0x16,
+    0x20, 0x2b, 0x35, 0x40, 0x4a, 0x55, 0x60, 0x6a, 0x75, 0x7f, 0x8a, 0x95, 0x9f, 0xaa, 0xb4, 0xbf,
+    0xc9, 0xd4, 0xdf, 0xe9, 0xe4, 0xda, 0xcf, 0xc4, 0xba, 0xaf, 0xa5, 0x9a, 0x90, 0x85, 0x7a, 0x70,
+    0x65, 0x5b, 0x50, 0x45, 0x3b, 0x30, 0x26, 0x1b, 0x18, 0x22, 0x2d, 0x37, 0x42, 0x4c, 0x57, 0x62,
+    0x6c, 0x77, 0x81, 0x8c, 0x96, 0xa1, 0xac, 0xb6, 0xc1, 0xcb, 0xd6, 0xe1, 0xeb, 0xe2, 0xd8, 0xcd,
+    0xc2, 0xb8, 0xad, 0xa3, 0x98, 0x8e, 0x83, 0x78, 0x6e, 0x63, 0x59, 0x4e, 0x44, 0x39, 0x2e, 0x24,
+    0x19, 0x19, 0x24, 0x2f, 0x39, 0x44, 0x4e, 0x59, 0x64, 0x6e, 0x79, 0x83, 0x8e, 0x98, 0xa3, 0xae,
+    0xb8, 0xc3, 0xcd, 0xd8, 0xe2, 0xea, 0xe0, 0xd5, 0xcb, 0xc0, 0xb5, 0xab, 0xa0, 0x96, 0x8b, 0x81,
+    0x77, 0x6c, 0x62, 0x58, 0x4d, 0x43, 0x39, 0x2e, 0x24, 0x1a, 0x1e, 0x29, 0x33, 0x3d, 0x48, 0x52,
+    0x5c, 0x66, 0x71, 0x7b, 0x85, 0x8f, 0x99, 0xa3, 0xae, 0xb8, 0xc2, 0xcc, 0xd6, 0xe0, 0xe4, 0xda,
+    0xd0, 0xc5, 0xbb, 0xb1, 0xa7, 0x9d, 0x93, 0x89, 0x7f, 0x75, 0x6b, 0x61, 0x58, 0x4e, 0x44, 0x3a,
+    0x30, 0x26, 0x1d, 0x24, 0x2e, 0x38, 0x42, 0x4c, 0x56, 0x5f, 0x69, 0x73, 0x7d, 0x87, 0x90, 0x9a,
+    0xa4, 0xad, 0xb7, 0xc0, 0xca, 0xd4, 0xdd, 0xde, 0xd4, 0xca, 0xc1, 0xb7, 0xad, 0xa4, 0x9a, 0x91,
+    0x87, 0x7d, 0x74, 0x6b, 0x61, 0x58, 0x4e, 0x45, 0x3b, 0x32, 0x29, 0x21, 0x2a, 0x34, 0x3d, 0x47,
+    0x50, 0x59, 0x63, 0x6c, 0x75, 0x7f, 0x88, 0x91, 0x9a, 0xa4, 0xad, 0xb6, 0xbf, 0xc8, 0xd1, 0xda,
+    0xd8, 0xce, 0xc5, 0xbc, 0xb3, 0xa9, 0xa0, 0x97, 0x8e, 0x85, 0x7c, 0x73, 0x6a, 0x61, 0x58, 0x4f,
+    0x46, 0x3d, 0x34, 0x2b, 0x27, 0x30, 0x39, 0x42, 0x4b, 0x54, 0x5d, 0x66, 0x6f, 0x78, 0x80, 0x89,
+    0x92, 0x9b, 0xa4, 0xac, 0xb5, 0xbe, 0xc6, 0xcf, 0xd8, 0xd2, 0xc9, 0xc0, 0xb7, 0xaf, 0xa6, 0x9d,
+    0x94, 0x8c, 0x83, 0x7b, 0x72, 0x69, 0x61, 0x58, 0x50, 0x47, 0x3f, 0x36, 0x2e, 0x2d, 0x36, 0x3e,
+    0x47, 0x4f, 0x58, 0x60, 0x69, 0x71, 0x79, 0x82, 0x8a, 0x93, 0x9b, 0xa3, 0xac, 0xb4, 0xbc, 0xc4,
+    0xcc, 0xd4, 0xcc, 0xc4, 0xbb, 0xb3, 0xab, 0xa2, 0x9a, 0x92, 0x8a, 0x81, 0x79, 0x71, 0x69, 0x61,
+    0x59, 0x51, 0x49, 0x41, 0x39, 0x31, 0x33, 0x3b, 0x43, 0x4b, 0x53, 0x5b, 0x63, 0x6b, 0x73, 0x7b,
+    0x83, 0x8b, 0x93, 0x9b, 0xa3, 0xab, 0xb2, 0xba, 0xc2, 0xca, 0xce, 0xc6, 0xbe, 0xb7, 0xaf, 0xa7,
+    0x9f, 0x97, 0x8f, 0x88, 0x80, 0x78, 0x71, 0x69, 0x61, 0x5a, 0x52, 0x4b, 0x43, 0x3b, 0x34, 0x39,
+    0x40, 0x48, 0x50, 0x57, 0x5f, 0x66, 0x6e, 0x75, 0x7d, 0x84, 0x8c, 0x93, 0x9b, 0xa2, 0xaa, 0xb1,
+    0xb8, 0xc0, 0xc7, 0xc8, 0xc1, 0xb9, 0xb2, 0xab, 0xa3, 0x9c, 0x95, 0x8d, 0x86, 0x7f, 0x77, 0x70,
+    0x69, 0x62, 0x5b, 0x54, 0x4c, 0x45, 0x3e, 0x37, 0x3e, 0x45, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70,
+    0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xc3, 0xbc, 0xb5, 0xae,
+    0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x77, 0x70, 0x69, 0x62, 0x5c, 0x55, 0x4e, 0x48, 0x41,
+    0x3d, 0x44, 0x4a, 0x51, 0x58, 0x5f, 0x65, 0x6c, 0x73, 0x79, 0x80, 0x86, 0x8d, 0x93, 0x9a, 0xa0,
+    0xa7, 0xad, 0xb4, 0xba, 0xc1, 0xbd, 0xb7, 0xb0, 0xaa, 0xa3, 0x9d, 0x96, 0x90, 0x89, 0x83, 0x7c,
+    0x76, 0x70, 0x6a, 0x63, 0x5d, 0x57, 0x51, 0x4a, 0x44, 0x42, 0x49, 0x4f, 0x55, 0x5c, 0x62, 0x68,
+    0x6e, 0x75, 0x7b, 0x81, 0x87, 0x8d, 0x93, 0x99, 0x9f, 0xa5, 0xab, 0xb1, 0xb7, 0xbd, 0xb8, 0xb2,
+    0xac, 0xa5, 0x9f, 0x99, 0x93, 0x8d, 0x88, 0x82, 0x7c, 0x76, 0x70, 0x6a, 0x64, 0x5e, 0x59, 0x53,
+    0x4d, 0x47, 0x48, 0x4e, 0x54, 0x5a, 0x5f, 0x65, 0x6b, 0x71, 0x76, 0x7c, 0x82, 0x88, 0x8d, 0x93,
+    0x98, 0x9e, 0xa4, 0xa9, 0xaf, 0xb4, 0xb8, 0xb3, 0xad, 0xa7, 0xa2, 0x9c, 0x96, 0x91, 0x8b, 0x86,
+    0x80, 0x7b, 0x76, 0x70, 0x6b, 0x65, 0x60, 0x5b, 0x55, 0x50, 0x4b, 0x4d, 0x53, 0x58, 0x5e, 0x63,
+    0x68, 0x6e, 0x73, 0x78, 0x7d, 0x83, 0x88, 0x8d, 0x92, 0x97, 0x9d, 0xa2, 0xa7, 0xac, 0xb1, 0xb3,
+    0xad, 0xa8, 0xa3, 0x9e, 0x99, 0x94, 0x8f, 0x8a, 0x85, 0x7f, 0x7a, 0x76, 0x71, 0x6c, 0x67, 0x62,
+    0x5d, 0x58, 0x53, 0x4e, 0x52, 0x57, 0x5c, 0x61, 0x66, 0x6b, 0x70, 0x75, 0x7a, 0x7f, 0x83, 0x88,
+    0x8d, 0x92, 0x96, 0x9b, 0xa0, 0xa4, 0xa9, 0xad, 0xad, 0xa9, 0xa4, 0x9f, 0x9a, 0x96, 0x91, 0x8c,
+    0x88, 0x83, 0x7f, 0x7a, 0x76, 0x71, 0x6d, 0x68, 0x64, 0x5f, 0x5b, 0x57, 0x53, 0x57, 0x5c, 0x61,
+    0x65, 0x69, 0x6e, 0x72, 0x77, 0x7b, 0x7f, 0x84, 0x88, 0x8c, 0x91, 0x95, 0x99, 0x9d, 0xa2, 0xa6,
+    0xaa, 0xa8, 0xa4, 0xa0, 0x9b, 0x97, 0x93, 0x8f, 0x8a, 0x86, 0x82, 0x7e, 0x7a, 0x76, 0x72, 0x6e,
+    0x6a, 0x66, 0x62, 0x5e, 0x5a, 0x58, 0x5c, 0x60, 0x64, 0x69, 0x6d, 0x71, 0x74, 0x78, 0x7c, 0x80,
+    0x84, 0x88, 0x8c, 0x90, 0x93, 0x97, 0x9b, 0x9f, 0xa2, 0xa6, 0xa3, 0x9f, 0x9c, 0x98, 0x94, 0x90,
+    0x8c, 0x89, 0x85, 0x81, 0x7e, 0x7a, 0x76, 0x73, 0x6f, 0x6c, 0x68, 0x65, 0x61, 0x5e, 0x5d, 0x61,
+    0x65, 0x68, 0x6c, 0x6f, 0x73, 0x76, 0x7a, 0x7d, 0x81, 0x84, 0x88, 0x8b, 0x8e, 0x92, 0x95, 0x98,
+    0x9c, 0x9f, 0xa2, 0x9e, 0x9b, 0x98, 0x94, 0x91, 0x8e, 0x8a, 0x87, 0x84, 0x81, 0x7d, 0x7a, 0x77,
+    0x74, 0x71, 0x6e, 0x6b, 0x67, 0x64, 0x61, 0x62, 0x66, 0x69, 0x6c, 0x6f, 0x72, 0x75, 0x78, 0x7b,
+    0x7e, 0x81, 0x84, 0x87, 0x8a, 0x8d, 0x90, 0x93, 0x96, 0x98, 0x9b, 0x9d, 0x9a, 0x97, 0x94, 0x91,
+    0x8e, 0x8b, 0x88, 0x86, 0x83, 0x80, 0x7d, 0x7a, 0x78, 0x75, 0x72, 0x70, 0x6d, 0x6b, 0x68, 0x65,
+    0x67, 0x6a, 0x6d, 0x6f, 0x72, 0x75, 0x77, 0x7a, 0x7c, 0x7f, 0x82, 0x84, 0x87, 0x89, 0x8b, 0x8e,
+    0x90, 0x93, 0x95, 0x97, 0x98, 0x95, 0x93, 0x90, 0x8e, 0x8b, 0x89, 0x87, 0x84, 0x82, 0x80, 0x7d,
+    0x7b, 0x79, 0x76, 0x74, 0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x6c, 0x6e, 0x70, 0x73, 0x75, 0x77, 0x79,
+    0x7b, 0x7d, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x93, 0x93, 0x91, 0x8f,
+    0x8d, 0x8b, 0x89, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x7d, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x73, 0x71,
+    0x6f, 0x6e, 0x70, 0x72, 0x74, 0x76, 0x77, 0x79, 0x7b, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x85, 0x86,
+    0x88, 0x89, 0x8b, 0x8c, 0x8e, 0x8f, 0x8e, 0x8d, 0x8b, 0x8a, 0x88, 0x86, 0x85, 0x84, 0x82, 0x81,
+    0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x75, 0x73, 0x73, 0x75, 0x76, 0x77, 0x79, 0x7a,
+    0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8a,
+    0x89, 0x88, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a,
+    0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x82,
+    0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81,
+    0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e,
+    0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
+    0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7b,
+    0x79, 0x77, 0x74, 0x71, 0x6f, 0x6b, 0x68, 0x64, 0x60, 0x60, 0x62, 0x64, 0x66, 0x68, 0x6b, 0x6d,
+    0x70, 0x74, 0x77, 0x7b, 0x7e, 0x82, 0x87, 0x8b, 0x90, 0x95, 0x9a, 0xa0, 0xa5, 0xab, 0xb1, 0xb7,
+    0xbe, 0xc0, 0xbb, 0xb7, 0xb2, 0xad, 0xa8, 0xa3, 0x9d, 0x97, 0x91, 0x8b, 0x84, 0x7e, 0x77, 0x70,
+    0x68, 0x61, 0x59, 0x51, 0x49, 0x40, 0x37, 0x2e, 0x25, 0x1f, 0x26, 0x2d, 0x34, 0x3c, 0x44, 0x4c,
+    0x54, 0x5d, 0x66, 0x6f, 0x78, 0x81, 0x89, 0x92, 0x9b, 0xa4, 0xad, 0xb6, 0xbf, 0xc8, 0xd1, 0xd9,
+    0xe2, 0xeb, 0xe4, 0xdb, 0xd2, 0xc9, 0xc0, 0xb7, 0xae, 0xa5, 0x9d, 0x94, 0x8b, 0x82, 0x79, 0x70,
+    0x67, 0x5e, 0x55, 0x4d, 0x44, 0x3b, 0x32, 0x29, 0x20, 0x17, 0x1a, 0x23, 0x2c, 0x35, 0x3d, 0x46,
+    0x4f, 0x58, 0x61, 0x6a, 0x73, 0x7c, 0x85, 0x8d, 0x96, 0x9f, 0xa8, 0xb1, 0xba, 0xc3, 0xcc, 0xd5,
+    0xde, 0xe6, 0xe9, 0xe0, 0xd7, 0xce, 0xc5, 0xbc, 0xb3, 0xaa, 0xa1, 0x98, 0x90, 0x87, 0x7e, 0x75,
+    0x6c, 0x63, 0x5a, 0x51, 0x48, 0x40, 0x37, 0x2e, 0x25, 0x1c, 0x15, 0x1e, 0x27, 0x30, 0x39, 0x42,
+    0x4a, 0x53, 0x5c, 0x65, 0x6e, 0x77, 0x80, 0x89, 0x92, 0x9a, 0xa3, 0xac, 0xb5, 0xbe, 0xc7, 0xd0,
+    0xd9, 0xe2, 0xeb, 0xe4, 0xdc, 0xd3, 0xca, 0xc1, 0xb8, 0xaf, 0xa6, 0x9d, 0x94, 0x8b, 0x83, 0x7a,
+    0x71, 0x68, 0x5f, 0x56, 0x4d, 0x44, 0x3b, 0x33, 0x2a, 0x21, 0x18, 0x19, 0x22, 0x2b, 0x34, 0x3d,
+    0x46, 0x4f, 0x57, 0x60, 0x69, 0x72, 0x7b, 0x84, 0x8d, 0x96, 0x9f, 0xa7, 0xb0, 0xb9, 0xc2, 0xcb,
+    0xd4, 0xdd, 0xe6, 0xe9, 0xe0, 0xd7, 0xcf, 0xc6, 0xbd, 0xb4, 0xab, 0xa2, 0x99, 0x90, 0x87, 0x7e,
+    0x76, 0x6d, 0x64, 0x5b, 0x52, 0x49, 0x40, 0x37, 0x2e, 0x26, 0x1d, 0x14, 0x1d, 0x26, 0x2f, 0x38,
+    0x41, 0x4a, 0x53, 0x5c, 0x64, 0x6d, 0x76, 0x7f, 0x88, 0x91, 0x9a, 0xa3, 0xac, 0xb4, 0xbd, 0xc6,
+    0xcf, 0xd8, 0xe1, 0xea, 0xe5, 0xdc, 0xd3, 0xca, 0xc2, 0xb9, 0xb0, 0xa7, 0x9e, 0x95, 0x8c, 0x83,
+    0x7a, 0x72, 0x69, 0x60, 0x57, 0x4e, 0x45, 0x3c, 0x33, 0x2a, 0x21, 0x19, 0x18, 0x21, 0x2a, 0x33,
+    0x3c, 0x45, 0x4e, 0x57, 0x60, 0x69, 0x71, 0x7a, 0x83, 0x8c, 0x95, 0x9e, 0xa7, 0xb0, 0xb9, 0xc1,
+    0xca, 0xd3, 0xdc, 0xe5, 0xea, 0xe1, 0xd8, 0xcf, 0xc6, 0xbd, 0xb5, 0xac, 0xa3, 0x9a, 0x91, 0x88,
+    0x7f, 0x76, 0x6d, 0x65, 0x5c, 0x53, 0x4a, 0x41, 0x38, 0x2f, 0x26, 0x1d, 0x14, 0x1d, 0x25, 0x2e,
+    0x37, 0x40, 0x49, 0x52, 0x5b, 0x64, 0x6d, 0x76, 0x7e, 0x87, 0x90, 0x99, 0xa2, 0xab, 0xb4, 0xbd,
+    0xc6, 0xce, 0xd7, 0xe0, 0xe9, 0xe6, 0xdd, 0xd4, 0xcb, 0xc2, 0xb9, 0xb0, 0xa8, 0x9f, 0x96, 0x8d,
+    0x84, 0x7b, 0x72, 0x69, 0x60, 0x58, 0x4f, 0x46, 0x3d, 0x34, 0x2b, 0x22, 0x19, 0x18, 0x21, 0x2a,
+    0x32, 0x3b, 0x44, 0x4d, 0x56, 0x5f, 0x68, 0x71, 0x7a, 0x83, 0x8b, 0x94, 0x9d, 0xa6, 0xaf, 0xb8,
+    0xc1, 0xca, 0xd3, 0xdb, 0xe4, 0xeb, 0xe2, 0xd9, 0xd0, 0xc7, 0xbe, 0xb5, 0xac, 0xa3, 0x9b, 0x92,
+    0x89, 0x80, 0x77, 0x6e, 0x65, 0x5c, 0x53, 0x4b, 0x42, 0x39, 0x30, 0x27, 0x1e, 0x15, 0x1c, 0x25,
+    0x2e, 0x37, 0x3f, 0x48, 0x51, 0x5a, 0x63, 0x6c, 0x75, 0x7e, 0x87, 0x8f, 0x98, 0xa1, 0xaa, 0xb3,
+    0xbc, 0xc5, 0xce, 0xd7, 0xe0, 0xe8, 0xe7, 0xde, 0xd5, 0xcc, 0xc3, 0xba, 0xb1, 0xa8, 0x9f, 0x96,
+    0x8e, 0x85, 0x7c, 0x73, 0x6a, 0x61, 0x58, 0x4f, 0x46, 0x3e, 0x35, 0x2c, 0x23, 0x1a, 0x17, 0x20,
+    0x29, 0x32, 0x3b, 0x44, 0x4c, 0x55, 0x5e, 0x67, 0x70, 0x79, 0x82, 0x8b, 0x94, 0x9c, 0xa5, 0xae,
+    0xb7, 0xc0, 0xc9, 0xd2, 0xdb, 0xe4, 0xeb, 0xe2, 0xda, 0xd1, 0xc8, 0xbf, 0xb6, 0xad, 0xa4, 0x9b,
+    0x92, 0x89, 0x81, 0x78, 0x6f, 0x66, 0x5d, 0x54, 0x4b, 0x42, 0x39, 0x31, 0x28, 0x1f, 0x16, 0x1b,
+    0x24, 0x2d, 0x36, 0x3f, 0x48, 0x51, 0x59, 0x62, 0x6b, 0x74, 0x7d, 0x86, 0x8f, 0x98, 0xa1, 0xa9,
+    0xb2, 0xbb, 0xc4, 0xcd, 0xd6, 0xdf, 0xe8, 0xe7, 0xde, 0xd5, 0xcd, 0xc4, 0xbb, 0xb2, 0xa9, 0xa0,
+    0x97, 0x8e, 0x85, 0x7c, 0x74, 0x6b, 0x62, 0x59, 0x50, 0x47, 0x3e, 0x35, 0x2c, 0x24, 0x1b, 0x16,
+    0x1f, 0x28, 0x31, 0x3a, 0x43, 0x4c, 0x55, 0x5e, 0x66, 0x6f, 0x78, 0x81, 0x8a, 0x93, 0x9c, 0xa5,
+    0xae, 0xb6, 0xbf, 0xc8, 0xd1, 0xda, 0xe3, 0xec, 0xe3, 0xda, 0xd1, 0xc8, 0xc0, 0xb7, 0xae, 0xa5,
+    0x9c, 0x93, 0x8a, 0x81, 0x78, 0x70, 0x67, 0x5e, 0x55, 0x4c, 0x43, 0x3a, 0x31, 0x28, 0x1f, 0x17,
+    0x1a, 0x23, 0x2c, 0x35, 0x3e, 0x47, 0x50, 0x59, 0x62, 0x6b, 0x73, 0x7c, 0x85, 0x8e, 0x97, 0xa0,
+    0xa9, 0xb2, 0xbb, 0xc3, 0xcc, 0xd5, 0xde, 0xe7, 0xe8, 0xdf, 0xd6, 0xcd, 0xc4, 0xbb, 0xb3, 0xaa,
+    0xa1, 0x98, 0x8f, 0x86, 0x7d, 0x74, 0x6b, 0x63, 0x5a, 0x51, 0x48, 0x3f, 0x36, 0x2d, 0x24, 0x1b,
+    0x16, 0x1f, 0x27, 0x30, 0x39, 0x42, 0x4b, 0x54, 0x5d, 0x66, 0x6f, 0x78, 0x80, 0x89, 0x92, 0x9b,
+    0xa4, 0xad, 0xb6, 0xbf, 0xc8, 0xd0, 0xd9, 0xe2, 0xeb, 0xe4, 0xdb, 0xd2, 0xc9, 0xc0, 0xb7, 0xae,
+    0xa6, 0x9d, 0x94, 0x8b, 0x82, 0x79, 0x70, 0x67, 0x5e, 0x56, 0x4d, 0x44, 0x3b, 0x32, 0x29, 0x20,
+    0x17, 0x1a, 0x23, 0x2c, 0x34, 0x3d, 0x46, 0x4f, 0x58, 0x61, 0x6a, 0x73, 0x7c, 0x85, 0x8d, 0x96,
+    0x9f, 0xa8, 0xb1, 0xba, 0xc3, 0xcc, 0xd5, 0xdd, 0xe6, 0xe9, 0xe0, 0xd7, 0xce, 0xc5, 0xbc, 0xb3,
+    0xaa, 0xa1, 0x99, 0x90, 0x87, 0x7e, 0x75, 0x6c, 0x63, 0x5a, 0x51, 0x49, 0x40, 0x37, 0x2e, 0x25,
+    0x1c, 0x15, 0x1e, 0x27, 0x30, 0x39, 0x41, 0x4a, 0x53, 0x5c, 0x65, 0x6e, 0x77, 0x80, 0x89, 0x92,
+    0x9a, 0xa3, 0xac, 0xb5, 0xbe, 0xc7, 0xd0, 0xd9, 0xe2, 0xea, 0xe5, 0xdc, 0xd3, 0xca, 0xc1, 0xb8,
+    0xaf, 0xa6, 0x9d, 0x94, 0x8c, 0x83, 0x7a, 0x71, 0x68, 0x5f, 0x56, 0x4d, 0x44, 0x3c, 0x33, 0x2a,
+    0x21, 0x18, 0x19, 0x22, 0x2b, 0x34, 0x3d, 0x46, 0x4e, 0x57, 0x60, 0x69, 0x72, 0x7b, 0x84, 0x8d,
+    0x96, 0x9e, 0xa7, 0xb0, 0xb9, 0xc2, 0xcb, 0xd4, 0xdd, 0xe6, 0xe9, 0xe0, 0xd8, 0xcf, 0xc6, 0xbd,
+    0xb4, 0xab, 0xa2, 0x99, 0x90, 0x87, 0x7f, 0x76, 0x6d, 0x64, 0x5b, 0x52, 0x49, 0x40, 0x37, 0x2f,
+    0x26, 0x1d, 0x14, 0x1d, 0x26, 0x2f, 0x38, 0x41, 0x4a, 0x53, 0x5b, 0x64, 0x6d, 0x76, 0x7f, 0x88,
+    0x91, 0x9a, 0xa3, 0xab, 0xb4, 0xbd, 0xc6, 0xcf, 0xd8, 0xe1, 0xea, 0xe5, 0xdc, 0xd3, 0xcb, 0xc2,
+    0xb9, 0xb0, 0xa7, 0x9e, 0x95, 0x8c, 0x83, 0x7a, 0x72, 0x69, 0x60, 0x57, 0x4e, 0x45, 0x3c, 0x33,
+    0x2a, 0x22, 0x19, 0x18, 0x21, 0x2a, 0x33, 0x3c, 0x45, 0x4e, 0x57, 0x60, 0x68, 0x71, 0x7a, 0x83,
+    0x8c, 0x95, 0x9e, 0xa7, 0xb0, 0xb8, 0xc1, 0xca, 0xd3, 0xdc, 0xe5, 0xea, 0xe1, 0xd8, 0xcf, 0xc6,
+    0xbe, 0xb5, 0xac, 0xa3, 0x9a, 0x91, 0x88, 0x7f, 0x76, 0x6d, 0x65, 0x5c, 0x53, 0x4a, 0x41, 0x38,
+    0x2f, 0x26, 0x1d, 0x15, 0x1c, 0x25, 0x2e, 0x37, 0x40, 0x49, 0x52, 0x5b, 0x64, 0x6d, 0x75, 0x7e,
+    0x87, 0x90, 0x99, 0xa2, 0xab, 0xb4, 0xbd, 0xc5, 0xce, 0xd7, 0xe0, 0xe9, 0xe6, 0xdd, 0xd4, 0xcb,
+    0xc2, 0xb9, 0xb1, 0xa8, 0x9f, 0x96, 0x8d, 0x84, 0x7b, 0x72, 0x69, 0x61, 0x58, 0x4f, 0x46, 0x3d,
+    0x34, 0x2b, 0x22, 0x19, 0x18, 0x21, 0x29, 0x32, 0x3b, 0x44, 0x4d, 0x56, 0x5f, 0x68, 0x71, 0x7a,
+    0x82, 0x8b, 0x94, 0x9d, 0xa6, 0xaf, 0xb8, 0xc1, 0xca, 0xd2, 0xdb, 0xe4, 0xeb, 0xe2, 0xd9, 0xd0,
+    0xc7, 0xbe, 0xb5, 0xac, 0xa4, 0x9b, 0x92, 0x89, 0x80, 0x77, 0x6e, 0x65, 0x5c, 0x54, 0x4b, 0x42,
+    0x39, 0x30, 0x27, 0x1e, 0x15, 0x1c, 0x25, 0x2e, 0x36, 0x3f, 0x48, 0x51, 0x5a, 0x63, 0x6c, 0x75,
+    0x7e, 0x87, 0x8f, 0x98, 0xa1, 0xaa, 0xb3, 0xbc, 0xc5, 0xce, 0xd7, 0xdf, 0xe8, 0xe7, 0xde, 0xd5,
+    0xcc, 0xc3, 0xba, 0xb1, 0xa8, 0x9f, 0x97, 0x8e, 0x85, 0x7c, 0x73, 0x6a, 0x61, 0x58, 0x4f, 0x47,
+    0x3e, 0x35, 0x2c, 0x23, 0x1a, 0x17, 0x20, 0x29, 0x32, 0x3b, 0x43, 0x4c, 0x55, 0x5e, 0x67, 0x70,
+    0x79, 0x82, 0x8b, 0x94, 0x9c, 0xa5, 0xae, 0xb7, 0xc0, 0xc9, 0xd2, 0xdb, 0xe4, 0xeb, 0xe3, 0xda,
+    0xd1, 0xc8, 0xbf, 0xb6, 0xad, 0xa4, 0x9b, 0x92, 0x8a, 0x81, 0x78, 0x6f, 0x66, 0x5d, 0x54, 0x4b,
+    0x42, 0x3a, 0x31, 0x28, 0x1f, 0x16, 0x1b, 0x24, 0x2d, 0x36, 0x3f, 0x48, 0x50, 0x59, 0x62, 0x6b,
+    0x74, 0x7d, 0x86, 0x8f, 0x98, 0xa0, 0xa9, 0xb2, 0xbb, 0xc4, 0xcd, 0xd6, 0xdf, 0xe8, 0xe7, 0xde,
+    0xd6, 0xcd, 0xc4, 0xbb, 0xb2, 0xa9, 0xa0, 0x97, 0x8e, 0x85, 0x7d, 0x74, 0x6b, 0x62, 0x59, 0x50,
+    0x47, 0x3e, 0x35, 0x2d, 0x24, 0x1b, 0x16, 0x1f, 0x28, 0x31, 0x3a, 0x43, 0x4c, 0x55, 0x5d, 0x66,
+    0x6f, 0x78, 0x81, 0x8a, 0x93, 0x9c, 0xa5, 0xad, 0xb6, 0xbf, 0xc8, 0xd1, 0xda, 0xe3, 0xec, 0xe3,
+    0xda, 0xd1, 0xc9, 0xc0, 0xb7, 0xae, 0xa5, 0x9c, 0x93, 0x8a, 0x81, 0x78, 0x70, 0x67, 0x5e, 0x55,
+    0x4c, 0x43, 0x3a, 0x31, 0x28, 0x20, 0x17, 0x1a, 0x23, 0x2c, 0x35, 0x3e, 0x47, 0x50, 0x59, 0x62,
+    0x6a, 0x73, 0x7c, 0x85, 0x8e, 0x97, 0xa0, 0xa9, 0xb2, 0xba, 0xc3, 0xcc, 0xd5, 0xde, 0xe7, 0xe8,
+    0xdf, 0xd6, 0xcd, 0xc4, 0xbc, 0xb3, 0xaa, 0xa1, 0x98, 0x8f, 0x86, 0x7d, 0x74, 0x6b, 0x63, 0x5a,
+    0x51, 0x48, 0x3f, 0x36, 0x2d, 0x24, 0x1b, 0x16, 0x1e, 0x27, 0x30, 0x39, 0x42, 0x4b, 0x54, 0x5d,
+    0x66, 0x6f, 0x77, 0x80, 0x89, 0x92, 0x9b, 0xa4, 0xad, 0xb6, 0xbf, 0xc7, 0xd0, 0xd9, 0xe2, 0xeb,
+    0xe4, 0xdb, 0xd2, 0xc9, 0xc0, 0xb7, 0xaf, 0xa6, 0x9d, 0x94, 0x8b, 0x82, 0x79, 0x70, 0x67, 0x5f,
+    0x56, 0x4d, 0x44, 0x3b, 0x32, 0x29, 0x20, 0x17, 0x1a, 0x23, 0x2b, 0x34, 0x3d, 0x46, 0x4f, 0x58,
+    0x61, 0x6a, 0x73, 0x7c, 0x84, 0x8d, 0x96, 0x9f, 0xa8, 0xb1, 0xba, 0xc3, 0xcc, 0xd4, 0xdd, 0xe6,
+    0xe9, 0xe0, 0xd7, 0xce, 0xc5, 0xbc, 0xb3, 0xaa, 0xa2, 0x99, 0x90, 0x87, 0x7e, 0x75, 0x6c, 0x63,
+    0x5a, 0x52, 0x49, 0x40, 0x37, 0x2e, 0x25, 0x1c, 0x15, 0x1e, 0x27, 0x30, 0x38, 0x41, 0x4a, 0x53,
+    0x5c, 0x65, 0x6e, 0x77, 0x80, 0x89, 0x91, 0x9a, 0xa3, 0xac, 0xb5, 0xbe, 0xc7, 0xd0, 0xd9, 0xe1,
+    0xea, 0xe5, 0xdc, 0xd3, 0xca, 0xc1, 0xb8, 0xaf, 0xa6, 0x9d, 0x95, 0x8c, 0x83, 0x7a, 0x71, 0x68,
+    0x5f, 0x56, 0x4d, 0x45, 0x3c, 0x33, 0x2a, 0x21, 0x18, 0x19, 0x22, 0x2b, 0x34, 0x3d, 0x45, 0x4e,
+    0x57, 0x60, 0x69, 0x72, 0x7b, 0x84, 0x8d, 0x96, 0x9e, 0xa7, 0xb0, 0xb9, 0xc2, 0xcb, 0xd4, 0xdd,
+    0xe6, 0xe9, 0xe1, 0xd8, 0xcf, 0xc6, 0xbd, 0xb4, 0xab, 0xa2, 0x99, 0x90, 0x88, 0x7f, 0x76, 0x6d,
+    0x64, 0x5b, 0x52, 0x49, 0x40, 0x38, 0x2f, 0x26, 0x1d, 0x14, 0x1d, 0x26, 0x2f, 0x38, 0x41, 0x4a,
+    0x52, 0x5b, 0x64, 0x6d, 0x76, 0x7f, 0x88, 0x91, 0x9a, 0xa2, 0xab, 0xb4, 0xbd, 0xc6, 0xcf, 0xd8,
+    0xe1, 0xea, 0xe5, 0xdc, 0xd4, 0xcb, 0xc2, 0xb9, 0xb0, 0xa7, 0x9e, 0x95, 0x8c, 0x83, 0x7b, 0x72,
+    0x69, 0x60, 0x57, 0x4e, 0x45, 0x3c, 0x33, 0x2b, 0x22, 0x19, 0x18, 0x21, 0x2a, 0x33, 0x3c, 0x45,
+    0x4e, 0x57, 0x5f, 0x68, 0x71, 0x7a, 0x83, 0x8c, 0x95, 0x9e, 0xa7, 0xaf, 0xb8, 0xc1, 0xca, 0xd3,
+    0xdc, 0xe5, 0xea, 0xe1, 0xd8, 0xcf, 0xc7, 0xbe, 0xb5, 0xac, 0xa3, 0x9a, 0x91, 0x88, 0x7f, 0x76,
+    0x6e, 0x65, 0x5c, 0x53, 0x4a, 0x41, 0x38, 0x2f, 0x26, 0x1e, 0x15, 0x1c, 0x25, 0x2e, 0x37, 0x40,
+    0x49, 0x52, 0x5b, 0x64, 0x6c, 0x75, 0x7e, 0x87, 0x90, 0x99, 0xa2, 0xab, 0xb4, 0xbc, 0xc5, 0xce,
+    0xd7, 0xe0, 0xe9, 0xe6, 0xdd, 0xd4, 0xcb, 0xc2, 0xba, 0xb1, 0xa8, 0x9f, 0x96, 0x8d, 0x84, 0x7b,
+    0x72, 0x69, 0x61, 0x58, 0x4f, 0x46, 0x3d, 0x34, 0x2b, 0x22, 0x19, 0x18, 0x20, 0x29, 0x32, 0x3b,
+    0x44, 0x4d, 0x56, 0x5f, 0x68, 0x71, 0x79, 0x82, 0x8b, 0x94, 0x9d, 0xa6, 0xaf, 0xb8, 0xc1, 0xc9,
+    0xd2, 0xdb, 0xe4, 0xeb, 0xe2, 0xd9, 0xd0, 0xc7, 0xbe, 0xb5, 0xad, 0xa4, 0x9b, 0x92, 0x89, 0x80,
+    0x77, 0x6e, 0x65, 0x5c, 0x54, 0x4b, 0x42, 0x39, 0x30, 0x27, 0x1e, 0x15, 0x1c, 0x25, 0x2d, 0x36,
+    0x3f, 0x48, 0x51, 0x5a, 0x63, 0x6c, 0x75, 0x7e, 0x86, 0x8f, 0x98, 0xa1, 0xaa, 0xb3, 0xbc, 0xc5,
+    0xce, 0xd6, 0xdf, 0xe8, 0xe7, 0xde, 0xd5, 0xcc, 0xc3, 0xba, 0xb1, 0xa8, 0xa0, 0x97, 0x8e, 0x85,
+    0x7c, 0x73, 0x6a, 0x61, 0x58, 0x50, 0x47, 0x3e, 0x35, 0x2c, 0x23, 0x1a, 0x17, 0x20, 0x29, 0x32,
+    0x3a, 0x43, 0x4c, 0x55, 0x5e, 0x67, 0x70, 0x79, 0x82, 0x8b, 0x93, 0x9c, 0xa5, 0xae, 0xb7, 0xc0,
+    0xc9, 0xd2, 0xdb, 0xe3, 0xec, 0xe3, 0xda, 0xd1, 0xc8, 0xbf, 0xb6, 0xad, 0xa4, 0x9b, 0x93, 0x8a,
+    0x81, 0x78, 0x6f, 0x66, 0x5d, 0x54, 0x4b, 0x43, 0x3a, 0x31, 0x28, 0x1f, 0x16, 0x1b, 0x24, 0x2d,
+    0x36, 0x3f, 0x47, 0x50, 0x59, 0x62, 0x6b, 0x74, 0x7d, 0x86, 0x8f, 0x98, 0xa0, 0xa9, 0xb2, 0xbb,
+    0xc4, 0xcd, 0xd6, 0xdf, 0xe8, 0xe7, 0xdf, 0xd6, 0xcd, 0xc4, 0xbb, 0xb2, 0xa9, 0xa0, 0x97, 0x8e,
+    0x86, 0x7d, 0x74, 0x6b, 0x62, 0x59, 0x50, 0x47, 0x3e, 0x36, 0x2d, 0x24, 0x1b, 0x16, 0x1f, 0x28,
+    0x31, 0x3a, 0x43, 0x4c, 0x54, 0x5d, 0x66, 0x6f, 0x78, 0x81, 0x8a, 0x93, 0x9c, 0xa5, 0xad, 0xb6,
+    0xbf, 0xc8, 0xd1, 0xda, 0xe3, 0xec, 0xe3, 0xda, 0xd2, 0xc9, 0xc0, 0xb7, 0xae, 0xa5, 0x9c, 0x93,
+    0x8a, 0x81, 0x79, 0x70, 0x67, 0x5e, 0x55, 0x4c, 0x43, 0x3a, 0x31, 0x29, 0x20, 0x17, 0x1a, 0x23,
+    0x2c, 0x35, 0x3e, 0x47, 0x50, 0x59, 0x61, 0x6a, 0x73, 0x7c, 0x85, 0x8e, 0x97, 0xa0, 0xa9, 0xb1,
+    0xba, 0xc3, 0xcc, 0xd5, 0xde, 0xe7, 0xe8, 0xdf, 0xd6, 0xcd, 0xc5, 0xbc, 0xb3, 0xaa, 0xa1, 0x98,
+    0x8f, 0x86, 0x7d, 0x74, 0x6c, 0x63, 0x5a, 0x51, 0x48, 0x3f, 0x36, 0x2d, 0x24, 0x1c, 0x15, 0x1e,
+    0x27, 0x30, 0x39, 0x42, 0x4b, 0x54, 0x5d, 0x66, 0x6e, 0x77, 0x80, 0x89, 0x92, 0x9b, 0xa4, 0xad,
+    0xb6, 0xbe, 0xc7, 0xd0, 0xd9, 0xe2, 0xeb, 0xe4, 0xdb, 0xd2, 0xc9, 0xc0, 0xb8, 0xaf, 0xa6, 0x9d,
+    0x94, 0x8b, 0x82, 0x79, 0x70, 0x67, 0x5f, 0x56, 0x4d, 0x44, 0x3b, 0x32, 0x29, 0x20, 0x17, 0x1a,
+    0x22, 0x2b, 0x34, 0x3d, 0x46, 0x4f, 0x58, 0x61, 0x6a, 0x73, 0x7b, 0x84, 0x8d, 0x96, 0x9f, 0xa8,
+    0xb1, 0xba, 0xc3, 0xcb, 0xd4, 0xdd, 0xe6, 0xe9, 0xe0, 0xd7, 0xce, 0xc5, 0xbc, 0xb3, 0xab, 0xa2,
+    0x99, 0x90, 0x87, 0x7e, 0x75, 0x6c, 0x63, 0x5a, 0x52, 0x49, 0x40, 0x37, 0x2e, 0x25, 0x1c, 0x15,
+    0x1e, 0x27, 0x2f, 0x38, 0x41, 0x4a, 0x53, 0x5c, 0x65, 0x6e, 0x77, 0x80, 0x88, 0x91, 0x9a, 0xa3,
+    0xac, 0xb5, 0xbe, 0xc7, 0xd0, 0xd8, 0xe1, 0xea, 0xe5, 0xdc, 0xd3, 0xca, 0xc1, 0xb8, 0xaf, 0xa6,
+    0x9e, 0x95, 0x8c, 0x83, 0x7a, 0x71, 0x68, 0x5f, 0x56, 0x4e, 0x45, 0x3c, 0x33, 0x2a, 0x21, 0x18,
+    0x19, 0x22, 0x2b, 0x34, 0x3c, 0x45, 0x4e, 0x57, 0x60, 0x69, 0x72, 0x7b, 0x84, 0x8d, 0x95, 0x9e,
+    0xa7, 0xb0, 0xb9, 0xc2, 0xcb, 0xd4, 0xdd, 0xe5, 0xea, 0xe1, 0xd8, 0xcf, 0xc6, 0xbd, 0xb4, 0xab,
+    0xa2, 0x99, 0x91, 0x88, 0x7f, 0x76, 0x6d, 0x64, 0x5b, 0x52, 0x49, 0x41, 0x38, 0x2f, 0x26, 0x1d,
+    0x14, 0x1d, 0x26, 0x2f, 0x38, 0x41, 0x49, 0x52, 0x5b, 0x64, 0x6d, 0x76, 0x7f, 0x88, 0x91, 0x9a,
+    0xa2, 0xab, 0xb4, 0xbd, 0xc6, 0xcf, 0xd8, 0xe1, 0xea, 0xe5, 0xdd, 0xd4, 0xcb, 0xc2, 0xb9, 0xb0,
+    0xa7, 0x9e, 0x95, 0x8c, 0x84, 0x7b, 0x72, 0x69, 0x60, 0x57, 0x4e, 0x45, 0x3c, 0x34, 0x2b, 0x22,
+    0x19, 0x18, 0x21, 0x2a, 0x33, 0x3c, 0x45, 0x4e, 0x56, 0x5f, 0x68, 0x71, 0x7a, 0x83, 0x8c, 0x95,
+    0x9e, 0xa7, 0xaf, 0xb8, 0xc1, 0xca, 0xd3, 0xdc, 0xe5, 0xea, 0xe1, 0xd8, 0xd0, 0xc7, 0xbe, 0xb5,
+    0xac, 0xa3, 0x9a, 0x91, 0x88, 0x7f, 0x77, 0x6e, 0x65, 0x5c, 0x53, 0x4b, 0x42, 0x39, 0x31, 0x28,
+    0x1f, 0x17, 0x1e, 0x27, 0x30, 0x39, 0x41, 0x4a, 0x53, 0x5c, 0x64, 0x6d, 0x76, 0x7e, 0x87, 0x8f,
+    0x98, 0xa1, 0xa9, 0xb2, 0xba, 0xc3, 0xcb, 0xd4, 0xdc, 0xe4, 0xe2, 0xd9, 0xd0, 0xc8, 0xbf, 0xb7,
+    0xae, 0xa6, 0x9d, 0x95, 0x8c, 0x84, 0x7c, 0x73, 0x6b, 0x63, 0x5a, 0x52, 0x4a, 0x41, 0x39, 0x31,
+    0x29, 0x20, 0x1f, 0x27, 0x2f, 0x38, 0x40, 0x48, 0x51, 0x59, 0x61, 0x69, 0x72, 0x7a, 0x82, 0x8a,
+    0x92, 0x9a, 0xa3, 0xab, 0xb3, 0xbb, 0xc3, 0xcb, 0xd3, 0xdb, 0xe1, 0xd9, 0xd1, 0xc8, 0xc0, 0xb8,
+    0xb0, 0xa8, 0xa0, 0x98, 0x90, 0x88, 0x80, 0x78, 0x70, 0x68, 0x61, 0x59, 0x51, 0x49, 0x41, 0x39,
+    0x32, 0x2a, 0x22, 0x28, 0x30, 0x37, 0x3f, 0x47, 0x4f, 0x57, 0x5f, 0x66, 0x6e, 0x76, 0x7e, 0x85,
+    0x8d, 0x95, 0x9d, 0xa4, 0xac, 0xb3, 0xbb, 0xc3, 0xca, 0xd2, 0xd9, 0xd8, 0xd0, 0xc9, 0xc1, 0xb9,
+    0xb2, 0xaa, 0xa2, 0x9b, 0x93, 0x8c, 0x84, 0x7d, 0x75, 0x6e, 0x66, 0x5f, 0x57, 0x50, 0x49, 0x41,
+    0x3a, 0x33, 0x2b, 0x29, 0x30, 0x38, 0x3f, 0x46, 0x4e, 0x55, 0x5d, 0x64, 0x6b, 0x73, 0x7a, 0x81,
+    0x89, 0x90, 0x97, 0x9e, 0xa5, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xcf, 0xc8, 0xc1, 0xba,
+    0xb3, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49,
+    0x42, 0x3b, 0x34, 0x2d, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7d,
+    0x84, 0x8b, 0x92, 0x99, 0x9f, 0xa6, 0xad, 0xb4, 0xba, 0xc1, 0xc8, 0xce, 0xce, 0xc7, 0xc0, 0xba,
+    0xb3, 0xac, 0xa6, 0x9f, 0x98, 0x91, 0x8b, 0x84, 0x7e, 0x77, 0x70, 0x6a, 0x63, 0x5d, 0x56, 0x50,
+    0x49, 0x43, 0x3d, 0x36, 0x33, 0x39, 0x40, 0x46, 0x4d, 0x54, 0x5a, 0x60, 0x67, 0x6d, 0x74, 0x7a,
+    0x81, 0x87, 0x8d, 0x94, 0x9a, 0xa0, 0xa7, 0xad, 0xb3, 0xb9, 0xbf, 0xc6, 0xcc, 0xc6, 0xc0, 0xb9,
+    0xb3, 0xad, 0xa6, 0xa0, 0x9a, 0x94, 0x8d, 0x87, 0x81, 0x7b, 0x75, 0x6f, 0x69, 0x63, 0x5c, 0x56,
+    0x50, 0x4a, 0x44, 0x3f, 0x39, 0x3b, 0x41, 0x47, 0x4d, 0x53, 0x59, 0x5f, 0x65, 0x6b, 0x71, 0x77,
+    0x7d, 0x83, 0x89, 0x8f, 0x95, 0x9b, 0xa1, 0xa6, 0xac, 0xb2, 0xb8, 0xbe, 0xc3, 0xc4, 0xbe, 0xb8,
+    0xb2, 0xad, 0xa7, 0xa1, 0x9b, 0x95, 0x90, 0x8a, 0x84, 0x7e, 0x79, 0x73, 0x6d, 0x68, 0x62, 0x5d,
+    0x57, 0x51, 0x4c, 0x46, 0x41, 0x3d, 0x43, 0x48, 0x4e, 0x54, 0x59, 0x5f, 0x64, 0x6a, 0x70, 0x75,
+    0x7b, 0x80, 0x86, 0x8b, 0x90, 0x96, 0x9b, 0xa1, 0xa6, 0xab, 0xb1, 0xb6, 0xbb, 0xc0, 0xbc, 0xb7,
+    0xb1, 0xac, 0xa7, 0xa1, 0x9c, 0x97, 0x91, 0x8c, 0x87, 0x81, 0x7c, 0x77, 0x72, 0x6c, 0x67, 0x62,
+    0x5d, 0x58, 0x53, 0x4e, 0x49, 0x44, 0x45, 0x4a, 0x4f, 0x54, 0x5a, 0x5f, 0x64, 0x69, 0x6e, 0x73,
+    0x78, 0x7d, 0x82, 0x87, 0x8c, 0x91, 0x96, 0x9b, 0xa0, 0xa5, 0xaa, 0xaf, 0xb4, 0xb8, 0xba, 0xb5,
+    0xb0, 0xab, 0xa6, 0xa1, 0x9c, 0x97, 0x92, 0x8d, 0x89, 0x84, 0x7f, 0x7a, 0x75, 0x71, 0x6c, 0x67,
+    0x63, 0x5e, 0x59, 0x55, 0x50, 0x4b, 0x47, 0x4c, 0x51, 0x56, 0x5a, 0x5f, 0x64, 0x69, 0x6d, 0x72,
+    0x77, 0x7b, 0x80, 0x84, 0x89, 0x8d, 0x92, 0x96, 0x9b, 0x9f, 0xa4, 0xa8, 0xad, 0xb1, 0xb5, 0xb3,
+    0xae, 0xa9, 0xa5, 0xa0, 0x9c, 0x97, 0x93, 0x8f, 0x8a, 0x86, 0x81, 0x7d, 0x79, 0x74, 0x70, 0x6c,
+    0x68, 0x63, 0x5f, 0x5b, 0x57, 0x53, 0x4e, 0x4f, 0x53, 0x58, 0x5c, 0x60, 0x64, 0x69, 0x6d, 0x71,
+    0x75, 0x79, 0x7e, 0x82, 0x86, 0x8a, 0x8e, 0x92, 0x96, 0x9a, 0x9e, 0xa2, 0xa6, 0xaa, 0xae, 0xb0,
+    0xac, 0xa7, 0xa3, 0x9f, 0x9b, 0x97, 0x93, 0x8f, 0x8b, 0x87, 0x83, 0x80, 0x7c, 0x78, 0x74, 0x70,
+    0x6c, 0x68, 0x65, 0x61, 0x5d, 0x59, 0x56, 0x52, 0x56, 0x5a, 0x5e, 0x61, 0x65, 0x69, 0x6d, 0x71,
+    0x74, 0x78, 0x7c, 0x7f, 0x83, 0x87, 0x8a, 0x8e, 0x92, 0x95, 0x99, 0x9c, 0xa0, 0xa3, 0xa7, 0xaa,
+    0xa9, 0xa5, 0xa1, 0x9e, 0x9a, 0x97, 0x93, 0x8f, 0x8c, 0x88, 0x85, 0x81, 0x7e, 0x7b, 0x77, 0x74,
+    0x70, 0x6d, 0x6a, 0x66, 0x63, 0x60, 0x5c, 0x59, 0x59, 0x5c, 0x60, 0x63, 0x67, 0x6a, 0x6d, 0x71,
+    0x74, 0x77, 0x7b, 0x7e, 0x81, 0x84, 0x87, 0x8b, 0x8e, 0x91, 0x94, 0x97, 0x9a, 0x9d, 0xa0, 0xa3,
+    0xa5, 0xa2, 0x9f, 0x9c, 0x98, 0x95, 0x92, 0x8f, 0x8c, 0x89, 0x86, 0x83, 0x80, 0x7d, 0x7a, 0x77,
+    0x74, 0x71, 0x6e, 0x6b, 0x68, 0x66, 0x63, 0x60, 0x5d, 0x60, 0x63, 0x66, 0x69, 0x6b, 0x6e, 0x71,
+    0x74, 0x77, 0x7a, 0x7d, 0x7f, 0x82, 0x85, 0x88, 0x8a, 0x8d, 0x90, 0x92, 0x95, 0x98, 0x9a, 0x9d,
+    0x9f, 0x9f, 0x9c, 0x99, 0x96, 0x94, 0x91, 0x8e, 0x8c, 0x89, 0x86, 0x84, 0x81, 0x7f, 0x7c, 0x7a,
+    0x77, 0x75, 0x72, 0x70, 0x6d, 0x6b, 0x69, 0x66, 0x64, 0x63, 0x66, 0x68, 0x6b, 0x6d, 0x70, 0x72,
+    0x75, 0x77, 0x7a, 0x7c, 0x7e, 0x81, 0x83, 0x85, 0x87, 0x8a, 0x8c, 0x8e, 0x90, 0x93, 0x95, 0x97,
+    0x99, 0x9b, 0x98, 0x96, 0x94, 0x91, 0x8f, 0x8d, 0x8b, 0x89, 0x86, 0x84, 0x82, 0x80, 0x7e, 0x7c,
+    0x7a, 0x78, 0x76, 0x74, 0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x72, 0x74,
+    0x76, 0x78, 0x7a, 0x7c, 0x7e, 0x7f, 0x81, 0x83, 0x85, 0x87, 0x89, 0x8a, 0x8c, 0x8e, 0x90, 0x91,
+    0x93, 0x95, 0x94, 0x93, 0x91, 0x8f, 0x8d, 0x8b, 0x89, 0x88, 0x86, 0x84, 0x83, 0x81, 0x7f, 0x7e,
+    0x7c, 0x7a, 0x79, 0x77, 0x76, 0x74, 0x73, 0x71, 0x70, 0x6e, 0x6e, 0x6f, 0x71, 0x73, 0x74, 0x76,
+    0x77, 0x79, 0x7a, 0x7c, 0x7d, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8c,
+    0x8e, 0x8f, 0x90, 0x8f, 0x8d, 0x8c, 0x8a, 0x89, 0x88, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f,
+    0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+    0x89, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80,
+    0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7b,
+    0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84,
+    0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80,
+    0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x80,
+    0x7f, 0x7d, 0x7c, 0x7a, 0x78, 0x75, 0x73, 0x70, 0x6e, 0x6b, 0x67, 0x64, 0x61, 0x5d, 0x59, 0x57,
+    0x59, 0x5b, 0x5c, 0x5e, 0x61, 0x63, 0x66, 0x68, 0x6b, 0x6e, 0x72, 0x75, 0x79, 0x7d, 0x81, 0x85,
+    0x89, 0x8e, 0x92, 0x97, 0x9c, 0xa1, 0xa7, 0xac, 0xb2, 0xb8, 0xbe, 0xc4, 0xcb, 0xd1, 0xcf, 0xcb,
+    0xc6, 0xc2, 0xbd, 0xb8, 0xb3, 0xad, 0xa8, 0xa2, 0x9c, 0x96, 0x90, 0x8a, 0x83, 0x7c, 0x75, 0x6e,
+    0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b,
+    0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c,
+    0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb,
+    0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a,
+    0x53, 0x4c, 0x45, 0x3e, 0x37, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f,
+    0x46, 0x4d, 0x54, 0x5b, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0,
+    0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7,
+    0xb0, 0xa9, 0xa2, 0x9b, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46,
+    0x3f, 0x38, 0x31, 0x2a, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53,
+    0x5a, 0x61, 0x68, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4,
+    0xcb, 0xd2, 0xd9, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3,
+    0x9c, 0x95, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32,
+    0x2b, 0x24, 0x1d, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67,
+    0x6e, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8,
+    0xdf, 0xe6, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f,
+    0x88, 0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e,
+    0x17, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b,
+    0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xeb,
+    0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7a,
+    0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x18, 0x1f,
+    0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x90,
+    0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe5, 0xde, 0xd7,
+    0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6d, 0x66,
+    0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x25, 0x2c, 0x33,
+    0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x96, 0x9d, 0xa4,
+    0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd8, 0xd1, 0xca, 0xc3,
+    0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x67, 0x60, 0x59, 0x52,
+    0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2b, 0x32, 0x39, 0x40, 0x47,
+    0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa3, 0xaa, 0xb1, 0xb8,
+    0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf,
+    0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5a, 0x53, 0x4c, 0x45, 0x3e,
+    0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b,
+    0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc,
+    0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b,
+    0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a,
+    0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f,
+    0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0,
+    0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87,
+    0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16,
+    0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83,
+    0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4,
+    0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73,
+    0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26,
+    0x2d, 0x34, 0x3b, 0x42, 0x49, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97,
+    0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0,
+    0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f,
+    0x58, 0x51, 0x4a, 0x43, 0x3c, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a,
+    0x41, 0x48, 0x4f, 0x56, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab,
+    0xb2, 0xb9, 0xc0, 0xc7, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc,
+    0xb5, 0xae, 0xa7, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b,
+    0x44, 0x3d, 0x36, 0x2f, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e,
+    0x55, 0x5c, 0x63, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf,
+    0xc6, 0xcd, 0xd4, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8,
+    0xa1, 0x9a, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37,
+    0x30, 0x29, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62,
+    0x69, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3,
+    0xda, 0xe1, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94,
+    0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23,
+    0x1c, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76,
+    0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7,
+    0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x7f,
+    0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x1a,
+    0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x84, 0x8b,
+    0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xea, 0xe3, 0xdc,
+    0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x72, 0x6b,
+    0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x19, 0x20, 0x27, 0x2e,
+    0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x91, 0x98, 0x9f,
+    0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xdd, 0xd6, 0xcf, 0xc8,
+    0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6c, 0x65, 0x5e, 0x57,
+    0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x26, 0x2d, 0x34, 0x3b, 0x42,
+    0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x97, 0x9e, 0xa5, 0xac, 0xb3,
+    0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4,
+    0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x5f, 0x58, 0x51, 0x4a, 0x43,
+    0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56,
+    0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7,
+    0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0,
+    0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f,
+    0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a,
+    0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb,
+    0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c,
+    0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b,
+    0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e,
+    0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9,
+    0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78,
+    0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21,
+    0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92,
+    0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5,
+    0xce, 0xc7, 0xc0, 0xb9, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x64,
+    0x5d, 0x56, 0x4f, 0x48, 0x41, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e, 0x35,
+    0x3c, 0x43, 0x4a, 0x51, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6,
+    0xad, 0xb4, 0xbb, 0xc2, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1,
+    0xba, 0xb3, 0xac, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50,
+    0x49, 0x42, 0x3b, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49,
+    0x50, 0x57, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba,
+    0xc1, 0xc8, 0xcf, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad,
+    0xa6, 0x9f, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c,
+    0x35, 0x2e, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d,
+    0x64, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce,
+    0xd5, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99,
+    0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28,
+    0x21, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x72,
+    0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2,
+    0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x84,
+    0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x15,
+    0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7f, 0x86,
+    0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe8, 0xe1,
+    0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7e, 0x77, 0x70,
+    0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1b, 0x22, 0x29,
+    0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8c, 0x93, 0x9a,
+    0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd,
+    0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x71, 0x6a, 0x63, 0x5c,
+    0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x21, 0x28, 0x2f, 0x36, 0x3d,
+    0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x92, 0x99, 0xa0, 0xa7, 0xae,
+    0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9,
+    0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48,
+    0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51,
+    0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2,
+    0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5,
+    0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34,
+    0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65,
+    0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6,
+    0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91,
+    0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20,
+    0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79,
+    0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea,
+    0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d,
+    0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c,
+    0x23, 0x2a, 0x31, 0x38, 0x3f, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d,
+    0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda,
+    0xd3, 0xcc, 0xc5, 0xbe, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69,
+    0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30,
+    0x37, 0x3e, 0x45, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1,
+    0xa8, 0xaf, 0xb6, 0xbd, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6,
+    0xbf, 0xb8, 0xb1, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55,
+    0x4e, 0x47, 0x40, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44,
+    0x4b, 0x52, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5,
+    0xbc, 0xc3, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2,
+    0xab, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41,
+    0x3a, 0x33, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58,
+    0x5f, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9,
+    0xd0, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e,
+    0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d,
+    0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6d,
+    0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd,
+    0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x90, 0x89,
+    0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x18,
+    0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x7a, 0x81,
+    0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xeb, 0xe6,
+    0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x83, 0x7c, 0x75,
+    0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x16, 0x1d, 0x24,
+    0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x80, 0x87, 0x8e, 0x95,
+    0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe7, 0xe0, 0xd9, 0xd2,
+    0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x76, 0x6f, 0x68, 0x61,
+    0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38,
+    0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8d, 0x94, 0x9b, 0xa2, 0xa9,
+    0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe,
+    0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d,
+    0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c,
+    0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd,
+    0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa,
+    0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39,
+    0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60,
+    0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1,
+    0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96,
+    0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25,
+    0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74,
+    0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5,
+    0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82,
+    0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17,
+    0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88,
+    0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf,
+    0xd8, 0xd1, 0xca, 0xc3, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e,
+    0x67, 0x60, 0x59, 0x52, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b,
+    0x32, 0x39, 0x40, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c,
+    0xa3, 0xaa, 0xb1, 0xb8, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb,
+    0xc4, 0xbd, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a,
+    0x53, 0x4c, 0x45, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f,
+    0x46, 0x4d, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0,
+    0xb7, 0xbe, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7,
+    0xb0, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46,
+    0x3f, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53,
+    0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4,
+    0xcb, 0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3,
+    0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32,
+    0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x68,
+    0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd9,
+    0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x95, 0x8e,
+    0x87, 0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1d,
+    0x16, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6e, 0x75, 0x7c,
+    0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe6, 0xeb,
+    0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x88, 0x81, 0x7a,
+    0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x17, 0x18, 0x1f,
+    0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7b, 0x82, 0x89, 0x90,
+    0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xec, 0xe5, 0xde, 0xd7,
+    0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x82, 0x7b, 0x74, 0x6d, 0x66,
+    0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x17, 0x1e, 0x25, 0x2c, 0x33,
+    0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x88, 0x8f, 0x96, 0x9d, 0xa4,
+    0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3,
+    0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52,
+    0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47,
+    0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8,
+    0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf,
+    0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e,
+    0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b,
+    0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc,
+    0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b,
+    0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a,
+    0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f,
+    0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0,
+    0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87,
+    0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16,
+    0x19, 0x20, 0x27, 0x2e, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83,
+    0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4,
+    0xdd, 0xd6, 0xcf, 0xc8, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73,
+    0x6c, 0x65, 0x5e, 0x57, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26,
+    0x2d, 0x34, 0x3b, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97,
+    0x9e, 0xa5, 0xac, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0,
+    0xc9, 0xc2, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f,
+    0x58, 0x51, 0x4a, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a,
+    0x41, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab,
+    0xb2, 0xb9, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc,
+    0xb5, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b,
+    0x44, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e,
+    0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf,
+    0xc6, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa7,
+    0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37,
+    0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x63,
+    0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd4,
+    0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9a, 0x93,
+    0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x29, 0x22,
+    0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x69, 0x70, 0x77,
+    0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe1, 0xe8,
+    0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x94, 0x8d, 0x86, 0x7f,
+    0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1c, 0x15, 0x1a,
+    0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x76, 0x7d, 0x84, 0x8b,
+    0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe7, 0xea, 0xe3, 0xdc,
+    0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x87, 0x80, 0x79, 0x72, 0x6b,
+    0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x16, 0x19, 0x20, 0x27, 0x2e,
+    0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f,
+    0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8,
+    0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57,
+    0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42,
+    0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3,
+    0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4,
+    0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43,
+    0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56,
+    0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7,
+    0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0,
+    0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f,
+    0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a,
+    0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb,
+    0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c,
+    0x85, 0x7e, 0x77, 0x70, 0x69, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b,
+    0x14, 0x1b, 0x22, 0x29, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e,
+    0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9,
+    0xe2, 0xdb, 0xd4, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78,
+    0x71, 0x6a, 0x63, 0x5c, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21,
+    0x28, 0x2f, 0x36, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92,
+    0x99, 0xa0, 0xa7, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5,
+    0xce, 0xc7, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x64,
+    0x5d, 0x56, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e, 0x35,
+    0x3c, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6,
+    0xad, 0xb4, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1,
+    0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50,
+    0x49, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49,
+    0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba,
+    0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xac,
+    0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c,
+    0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x57, 0x5e,
+    0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xcf,
+    0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0x9f, 0x98,
+    0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2e, 0x27,
+    0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x64, 0x6b, 0x72,
+    0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd5, 0xdc, 0xe3,
+    0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x99, 0x92, 0x8b, 0x84,
+    0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x21, 0x1a, 0x15,
+    0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x6a, 0x71, 0x78, 0x7f, 0x86,
+    0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe2, 0xe9, 0xe8, 0xe1,
+    0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8c, 0x85, 0x7e, 0x77, 0x70,
+    0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1b, 0x14, 0x1b, 0x22, 0x29,
+    0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a,
+    0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd,
+    0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c,
+    0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d,
+    0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae,
+    0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9,
+    0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48,
+    0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51,
+    0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2,
+    0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5,
+    0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34,
+    0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65,
+    0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6,
+    0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91,
+    0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20,
+    0x19, 0x16, 0x1d, 0x24, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79,
+    0x80, 0x87, 0x8e, 0x95, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea,
+    0xe7, 0xe0, 0xd9, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d,
+    0x76, 0x6f, 0x68, 0x61, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c,
+    0x23, 0x2a, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d,
+    0x94, 0x9b, 0xa2, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda,
+    0xd3, 0xcc, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69,
+    0x62, 0x5b, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30,
+    0x37, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1,
+    0xa8, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6,
+    0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55,
+    0x4e, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x45,
+    0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5,
+    0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb1,
+    0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x40,
+    0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x52, 0x59,
+    0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xca,
+    0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xab, 0xa4, 0x9d,
+    0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x33, 0x2c,
+    0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5f, 0x66, 0x6d,
+    0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xd0, 0xd7, 0xde,
+    0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9e, 0x97, 0x90, 0x89,
+    0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2d, 0x26, 0x1f, 0x18,
+    0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x65, 0x6c, 0x73, 0x7a, 0x81,
+    0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdd, 0xe4, 0xeb, 0xe6,
+    0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75,
+    0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x20, 0x19, 0x16, 0x1d, 0x24,
+    0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95,
+    0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2,
+    0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61,
+    0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38,
+    0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9,
+    0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe,
+    0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d,
+    0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c,
+    0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd,
+    0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa,
+    0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39,
+    0x32, 0x2b, 0x24, 0x1d, 0x16, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60,
+    0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1,
+    0xd8, 0xdf, 0xe6, 0xeb, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96,
+    0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25,
+    0x1e, 0x17, 0x18, 0x1f, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74,
+    0x7b, 0x82, 0x89, 0x90, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5,
+    0xec, 0xe5, 0xde, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82,
+    0x7b, 0x74, 0x6d, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17,
+    0x1e, 0x25, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88,
+    0x8f, 0x96, 0x9d, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf,
+    0xd8, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e,
+    0x67, 0x60, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b,
+    0x32, 0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c,
+    0xa3, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb,
+    0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a,
+    0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x40,
+    0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0,
+    0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbd, 0xb6,
+    0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x45,
+    0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4d, 0x54,
+    0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbe, 0xc5,
+    0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb0, 0xa9, 0xa2,
+    0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x38, 0x31,
+    0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x53, 0x5a, 0x61, 0x68,
+    0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xcb, 0xd2, 0xd9,
+    0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa3, 0x9c, 0x95, 0x8e,
+    0x87, 0x80, 0x79, 0x72, 0x6b, 0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x32, 0x2b, 0x24, 0x1d,
+    0x16, 0x19, 0x20, 0x27, 0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x60, 0x67, 0x6e, 0x75, 0x7c,
+    0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb,
+    0xe4, 0xdd, 0xd6, 0xcf, 0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a,
+    0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x25, 0x1e, 0x17, 0x18, 0x1f,
+    0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90,
+    0x97, 0x9e, 0xa5, 0xac, 0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7,
+    0xd0, 0xc9, 0xc2, 0xbb, 0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66,
+    0x5f, 0x58, 0x51, 0x4a, 0x43, 0x3c, 0x35, 0x2e, 0x27, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33,
+    0x3a, 0x41, 0x48, 0x4f, 0x56, 0x5d, 0x64, 0x6b, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4,
+    0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3,
+    0xbc, 0xb5, 0xae, 0xa7, 0xa0, 0x99, 0x92, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52,
+    0x4b, 0x44, 0x3d, 0x36, 0x2f, 0x28, 0x21, 0x1a, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47,
+    0x4e, 0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8,
+    0xbf, 0xc6, 0xcd, 0xd4, 0xdb, 0xe2, 0xe9, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf,
+    0xa8, 0xa1, 0x9a, 0x93, 0x8c, 0x85, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e,
+    0x37, 0x30, 0x29, 0x22, 0x1b, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b,
+    0x62, 0x69, 0x70, 0x77, 0x7e, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc,
+    0xd3, 0xda, 0xe1, 0xe8, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b,
+    0x94, 0x8d, 0x86, 0x7f, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a,
+    0x23, 0x1c, 0x15, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f,
+    0x76, 0x7d, 0x84, 0x8b, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0,
+    0xe7, 0xea, 0xe3, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87,
+    0x80, 0x79, 0x72, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16,
+    0x19, 0x20, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83,
+    0x8a, 0x91, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4,
+    0xdd, 0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73,
+    0x6c, 0x65, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x25, 0x1e, 0x17, 0x18, 0x1f, 0x26,
+    0x2e, 0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6d, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97,
+    0x9e, 0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xde, 0xe5, 0xec, 0xe5, 0xde, 0xd7, 0xd0,
+    0xc8, 0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x90, 0x89, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f,
+    0x57, 0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1f, 0x18, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3b,
+    0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xac,
+    0xb3, 0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xeb, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc2, 0xbb,
+    0xb4, 0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x83, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4a,
+    0x43, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x41, 0x48, 0x4f,
+    0x56, 0x5d, 0x64, 0x6b, 0x72, 0x79, 0x80, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb9, 0xc0,
+    0xc7, 0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb5, 0xae, 0xa7,
+    0xa0, 0x99, 0x92, 0x8b, 0x84, 0x7d, 0x76, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x44, 0x3d, 0x36,
+    0x2f, 0x28, 0x21, 0x1a, 0x15, 0x1c, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4e, 0x55, 0x5c, 0x63,
+    0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc6, 0xcd, 0xd4,
+    0xdb, 0xe2, 0xe9, 0xe8, 0xe1, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xaf, 0xa8, 0xa1, 0x9a, 0x93,
+    0x8c, 0x85, 0x7e, 0x77, 0x70, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x37, 0x30, 0x29, 0x22,
+    0x1b, 0x14, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5b, 0x62, 0x69, 0x70, 0x77,
+    0x7e, 0x85, 0x8c, 0x93, 0x9a, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcc, 0xd3, 0xda, 0xe1, 0xe8,
+    0xe9, 0xe2, 0xdb, 0xd4, 0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f,
+    0x78, 0x71, 0x6a, 0x63, 0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a,
+    0x21, 0x28, 0x2f, 0x36, 0x3d, 0x44, 0x4b, 0x52, 0x59, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b,
+    0x92, 0x99, 0xa0, 0xa7, 0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc,
+    0xd5, 0xce, 0xc7, 0xc0, 0xb9, 0xb2, 0xab, 0xa4, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b,
+    0x64, 0x5d, 0x56, 0x4f, 0x48, 0x41, 0x3a, 0x33, 0x2c, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e,
+    0x35, 0x3c, 0x43, 0x4a, 0x51, 0x58, 0x5f, 0x66, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f,
+    0xa6, 0xad, 0xb4, 0xbb, 0xc2, 0xc9, 0xd0, 0xd7, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc8,
+    0xc1, 0xba, 0xb3, 0xac, 0xa5, 0x9e, 0x97, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57,
+    0x50, 0x49, 0x42, 0x3b, 0x34, 0x2d, 0x26, 0x1e, 0x17, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42,
+    0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x97, 0x9e, 0xa5, 0xac, 0xb3,
+    0xba, 0xc1, 0xc8, 0xcf, 0xd6, 0xdd, 0xe4, 0xec, 0xe5, 0xde, 0xd7, 0xd0, 0xc9, 0xc2, 0xbb, 0xb4,
+    0xad, 0xa6, 0x9f, 0x98, 0x91, 0x8a, 0x82, 0x7b, 0x74, 0x6d, 0x66, 0x5f, 0x58, 0x51, 0x4a, 0x43,
+    0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x17, 0x1e, 0x25, 0x2c, 0x33, 0x3a, 0x41, 0x48, 0x4f, 0x56,
+    0x5d, 0x64, 0x6b, 0x72, 0x79, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7,
+    0xce, 0xd5, 0xdc, 0xe3, 0xea, 0xe6, 0xdf, 0xd8, 0xd1, 0xca, 0xc3, 0xbc, 0xb5, 0xae, 0xa7, 0xa0,
+    0x99, 0x92, 0x8b, 0x84, 0x7c, 0x75, 0x6e, 0x67, 0x60, 0x59, 0x52, 0x4b, 0x44, 0x3d, 0x36, 0x2f,
+    0x28, 0x21, 0x1a, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a,
+    0x71, 0x78, 0x7f, 0x87, 0x8e, 0x95, 0x9c, 0xa3, 0xaa, 0xb1, 0xb8, 0xbf, 0xc6, 0xcd, 0xd4, 0xdb,
+    0xe2, 0xe9, 0xe7, 0xe0, 0xd9, 0xd2, 0xcb, 0xc4, 0xbd, 0xb6, 0xaf, 0xa8, 0xa1, 0x9a, 0x93, 0x8c,
+    0x85, 0x7e, 0x77, 0x6f, 0x68, 0x61, 0x5a, 0x53, 0x4c, 0x45, 0x3e, 0x37, 0x30, 0x29, 0x22, 0x1b,
+    0x14, 0x1b, 0x23, 0x2a, 0x31, 0x38, 0x3f, 0x46, 0x4d, 0x54, 0x5b, 0x62, 0x69, 0x70, 0x77, 0x7e,
+    0x85, 0x8c, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda, 0xe1, 0xe8, 0xe9,
+    0xe2, 0xda, 0xd3, 0xcc, 0xc5, 0xbe, 0xb7, 0xb0, 0xa9, 0xa2, 0x9b, 0x94, 0x8d, 0x86, 0x7f, 0x78,
+    0x71, 0x69, 0x62, 0x5b, 0x54, 0x4d, 0x46, 0x3f, 0x38, 0x31, 0x2a, 0x23, 0x1c, 0x15, 0x1a, 0x21,
+    0x29, 0x30, 0x37, 0x3e, 0x45, 0x4c, 0x53, 0x5a, 0x61, 0x68, 0x6f, 0x76, 0x7d, 0x84, 0x8b, 0x92,
+    0x99, 0xa1, 0xa8, 0xaf, 0xb6, 0xbd, 0xc4, 0xcb, 0xd2, 0xd9, 0xe0, 0xe7, 0xea, 0xe3, 0xdc, 0xd4,
+    0xcd, 0xc6, 0xbf, 0xb8, 0xb1, 0xaa, 0xa3, 0x9c, 0x95, 0x8e, 0x87, 0x80, 0x79, 0x72, 0x6b, 0x64,
+    0x5c, 0x55, 0x4e, 0x47, 0x40, 0x39, 0x32, 0x2b, 0x24, 0x1d, 0x16, 0x19, 0x20, 0x27, 0x2e, 0x36,
+    0x3d, 0x44, 0x4b, 0x52, 0x59, 0x60, 0x67, 0x6e, 0x75, 0x7c, 0x83, 0x8a, 0x91, 0x98, 0x9f, 0xa7,
+    0xae, 0xb5, 0xbc, 0xc3, 0xca, 0xd1, 0xd8, 0xdf, 0xe6, 0xeb, 0xe4, 0xdd, 0xd6, 0xcf, 0xc7, 0xc0,
+    0xb9, 0xb2, 0xab, 0xa4, 0x9d, 0x96, 0x8f, 0x88, 0x81, 0x7a, 0x73, 0x6c, 0x65, 0x5e, 0x57, 0x50,
+    0x49, 0x42, 0x3c, 0x35, 0x2e, 0x27, 0x20, 0x19, 0x1b, 0x22, 0x29, 0x30, 0x37, 0x3e, 0x44, 0x4b,
+    0x52, 0x59, 0x60, 0x67, 0x6e, 0x74, 0x7b, 0x82, 0x89, 0x90, 0x96, 0x9d, 0xa4, 0xaa, 0xb1, 0xb8,
+    0xbe, 0xc5, 0xcc, 0xd2, 0xd9, 0xdf, 0xe6, 0xdf, 0xd8, 0xd2, 0xcb, 0xc4, 0xbd, 0xb7, 0xb0, 0xa9,
+    0xa3, 0x9c, 0x96, 0x8f, 0x88, 0x82, 0x7b, 0x75, 0x6e, 0x68, 0x61, 0x5b, 0x54, 0x4e, 0x47, 0x41,
+    0x3b, 0x34, 0x2e, 0x27, 0x21, 0x20, 0x27, 0x2d, 0x34, 0x3a, 0x41, 0x47, 0x4e, 0x54, 0x5b, 0x61,
+    0x68, 0x6e, 0x74, 0x7b, 0x81, 0x87, 0x8e, 0x94, 0x9a, 0xa0, 0xa7, 0xad, 0xb3, 0xb9, 0xbf, 0xc6,
+    0xcc, 0xd2, 0xd8, 0xde, 0xda, 0xd3, 0xcd, 0xc7, 0xc0, 0xba, 0xb4, 0xae, 0xa8, 0xa1, 0x9b, 0x95,
+    0x8f, 0x89, 0x83, 0x7d, 0x76, 0x70, 0x6a, 0x64, 0x5e, 0x58, 0x52, 0x4c, 0x46, 0x40, 0x3a, 0x34,
+    0x2f, 0x29, 0x26, 0x2c, 0x32, 0x38, 0x3e, 0x44, 0x4a, 0x50, 0x56, 0x5c, 0x62, 0x68, 0x6e, 0x74,
+    0x7a, 0x80, 0x86, 0x8c, 0x92, 0x97, 0x9d, 0xa3, 0xa9, 0xae, 0xb4, 0xba, 0xc0, 0xc5, 0xcb, 0xd1,
+    0xd6, 0xd4, 0xce, 0xc8, 0xc2, 0xbd, 0xb7, 0xb1, 0xab, 0xa6, 0xa0, 0x9a, 0x94, 0x8f, 0x89, 0x83,
+    0x7e, 0x78, 0x72, 0x6d, 0x67, 0x62, 0x5c, 0x57, 0x51, 0x4b, 0x46, 0x40, 0x3b, 0x36, 0x30, 0x2c,
+    0x32, 0x37, 0x3d, 0x42, 0x48, 0x4e, 0x53, 0x59, 0x5e, 0x64, 0x69, 0x6f, 0x74, 0x7a, 0x7f, 0x85,
+    0x8a, 0x8f, 0x95, 0x9a, 0x9f, 0xa5, 0xaa, 0xaf, 0xb5, 0xba, 0xbf, 0xc4, 0xca, 0xcf, 0xce, 0xc9,
+    0xc3, 0xbe, 0xb9, 0xb3, 0xae, 0xa9, 0xa3, 0x9e, 0x99, 0x94, 0x8e, 0x89, 0x84, 0x7f, 0x79, 0x74,
+    0x6f, 0x6a, 0x65, 0x60, 0x5b, 0x56, 0x50, 0x4b, 0x46, 0x41, 0x3c, 0x37, 0x32, 0x37, 0x3c, 0x42,
+    0x47, 0x4c, 0x51, 0x56, 0x5b, 0x60, 0x65, 0x6a, 0x6f, 0x74, 0x79, 0x7e, 0x83, 0x88, 0x8d, 0x92,
+    0x97, 0x9c, 0xa1, 0xa6, 0xab, 0xaf, 0xb4, 0xb9, 0xbe, 0xc3, 0xc7, 0xc8, 0xc3, 0xbf, 0xba, 0xb5,
+    0xb0, 0xab, 0xa6, 0xa1, 0x9c, 0x97, 0x93, 0x8e, 0x89, 0x84, 0x80, 0x7b, 0x76, 0x71, 0x6d, 0x68,
+    0x63, 0x5f, 0x5a, 0x55, 0x51, 0x4c, 0x48, 0x43, 0x3e, 0x3a, 0x3d, 0x42, 0x46, 0x4b, 0x50, 0x54,
+    0x59, 0x5e, 0x62, 0x67, 0x6c, 0x70, 0x75, 0x79, 0x7e, 0x82, 0x87, 0x8b, 0x90, 0x94, 0x99, 0x9d,
+    0xa2, 0xa6, 0xaa, 0xaf, 0xb3, 0xb8, 0xbc, 0xc0, 0xc2, 0xbe, 0xb9, 0xb5, 0xb0, 0xac, 0xa8, 0xa3,
+    0x9f, 0x9a, 0x96, 0x92, 0x8d, 0x89, 0x85, 0x80, 0x7c, 0x78, 0x73, 0x6f, 0x6b, 0x67, 0x62, 0x5e,
+    0x5a, 0x56, 0x52, 0x4e, 0x4a, 0x45, 0x41, 0x43, 0x47, 0x4b, 0x50, 0x54, 0x58, 0x5c, 0x60, 0x65,
+    0x69, 0x6d, 0x71, 0x75, 0x79, 0x7d, 0x82, 0x86, 0x8a, 0x8e, 0x92, 0x96, 0x9a, 0x9e, 0xa2, 0xa6,
+    0xa9, 0xad, 0xb1, 0xb5, 0xb9, 0xbc, 0xb8, 0xb4, 0xb0, 0xac, 0xa8, 0xa4, 0xa0, 0x9c, 0x98, 0x94,
+    0x90, 0x8c, 0x89, 0x85, 0x81, 0x7d, 0x79, 0x75, 0x71, 0x6e, 0x6a, 0x66, 0x62, 0x5f, 0x5b, 0x57,
+    0x54, 0x50, 0x4c, 0x49, 0x49, 0x4d, 0x50, 0x54, 0x58, 0x5c, 0x60, 0x63, 0x67, 0x6b, 0x6e, 0x72,
+    0x76, 0x7a, 0x7d, 0x81, 0x84, 0x88, 0x8c, 0x8f, 0x93, 0x96, 0x9a, 0x9d, 0xa1, 0xa4, 0xa8, 0xab,
+    0xaf, 0xb2, 0xb5, 0xb2, 0xaf, 0xab, 0xa8, 0xa4, 0xa1, 0x9d, 0x99, 0x96, 0x92, 0x8f, 0x8c, 0x88,
+    0x85, 0x81, 0x7e, 0x7a, 0x77, 0x74, 0x70, 0x6d, 0x6a, 0x66, 0x63, 0x60, 0x5d, 0x59, 0x56, 0x53,
+    0x50, 0x4f, 0x52, 0x56, 0x59, 0x5c, 0x60, 0x63, 0x66, 0x6a, 0x6d, 0x70, 0x73, 0x77, 0x7a, 0x7d,
+    0x80, 0x83, 0x87, 0x8a, 0x8d, 0x90, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0xa2, 0xa5, 0xa8, 0xab, 0xae,
+    0xac, 0xa9, 0xa6, 0xa3, 0xa0, 0x9d, 0x9a, 0x97, 0x94, 0x91, 0x8d, 0x8a, 0x87, 0x84, 0x82, 0x7f,
+    0x7c, 0x79, 0x76, 0x73, 0x70, 0x6d, 0x6a, 0x67, 0x65, 0x62, 0x5f, 0x5c, 0x5a, 0x57, 0x55, 0x58,
+    0x5b, 0x5e, 0x61, 0x64, 0x67, 0x69, 0x6c, 0x6f, 0x72, 0x75, 0x77, 0x7a, 0x7d, 0x80, 0x82, 0x85,
+    0x88, 0x8b, 0x8d, 0x90, 0x92, 0x95, 0x98, 0x9a, 0x9d, 0x9f, 0xa2, 0xa5, 0xa7, 0xa6, 0xa4, 0xa1,
+    0x9e, 0x9c, 0x99, 0x96, 0x94, 0x91, 0x8e, 0x8c, 0x89, 0x87, 0x84, 0x82, 0x7f, 0x7d, 0x7a, 0x78,
+    0x75, 0x73, 0x70, 0x6e, 0x6c, 0x69, 0x67, 0x65, 0x62, 0x60, 0x5e, 0x5c, 0x5e, 0x61, 0x63, 0x65,
+    0x68, 0x6a, 0x6d, 0x6f, 0x71, 0x74, 0x76, 0x79, 0x7b, 0x7d, 0x7f, 0x82, 0x84, 0x86, 0x88, 0x8b,
+    0x8d, 0x8f, 0x91, 0x93, 0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa0, 0x9e, 0x9c, 0x99, 0x97, 0x95,
+    0x93, 0x91, 0x8e, 0x8c, 0x8a, 0x88, 0x86, 0x84, 0x82, 0x80, 0x7e, 0x7c, 0x7a, 0x78, 0x76, 0x74,
+    0x72, 0x70, 0x6e, 0x6c, 0x6a, 0x68, 0x66, 0x64, 0x63, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x70,
+    0x72, 0x74, 0x76, 0x78, 0x7a, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x85, 0x86, 0x88, 0x8a, 0x8c, 0x8d,
+    0x8f, 0x91, 0x93, 0x94, 0x96, 0x97, 0x99, 0x9a, 0x98, 0x96, 0x94, 0x92, 0x91, 0x8f, 0x8d, 0x8c,
+    0x8a, 0x88, 0x87, 0x85, 0x83, 0x82, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x78, 0x77, 0x75, 0x74, 0x72,
+    0x71, 0x6f, 0x6e, 0x6c, 0x6b, 0x6a, 0x6a, 0x6c, 0x6e, 0x6f, 0x71, 0x72, 0x74, 0x75, 0x77, 0x78,
+    0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c, 0x8e,
+    0x8f, 0x90, 0x91, 0x92, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8c, 0x8b, 0x8a, 0x89, 0x87, 0x86, 0x85,
+    0x84, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73,
+    0x72, 0x71, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d,
+    0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8b,
+    0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81,
+    0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x77,
+    0x77, 0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
+    0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x85,
+    0x85, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+static const pcm_sample_t PCM_SFX_GAME_OVER = { PCM_SFX_GAME_OVER_DATA, sizeof(PCM_SFX_GAME_OVER_DATA) };
+
+#endif // PCM_SFX_H
@@ -0,0 +1,80 @@
+#include "power.h"
+#include "clockmgr.h"
+
+/**
+ * @file power.c
+ * @brief Implementação da espera ociosa (WFI) e do modo dormant.
+ *
+ * A sequência de entrada no dormant (relógios no XOSC, PLLs desligados e
+ * parada do XOSC com os GPIOs como fonte de despertar) fica na HAL, em
+ * `hal_dormant_until_gpio`; o gerenciador de relógio a envolve com os avisos
+ * aos drivers (`clockmgr_dormant_until_gpio`).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @brief Sinaliza a expiração do tempo limite de `power_wait_until`.
+ */
+static volatile bool power_wait_timed_out;
+
+/**
+ * @brief Callback do alarme de tempo limite.
+ *
+ * @param id Identificador do alarme.
+ * @param user_data Não utilizado.
+ * @return 0 (o alarme não é reagendado).
+ */
+static int64_t power_wait_alarm_callback(hal_alarm_id_t id, void *user_data)
+{
+    (void) id;
+    (void) user_data;
+    power_wait_timed_out = true;
+    return 0;
+}
+
+/**
+ * @brief Dorme com WFI até que `ready()` retorne verdadeiro ou o tempo limite expire.
+ *
+ * @param[in] ready Condição avaliada com as interrupções mascaradas.
+ * @param[in] timeout_us Tempo máximo de espera em microssegundos (0 espera indefinidamente).
+ * @return `true` se a condição foi satisfeita, `false` se o tempo limite expirou.
+ */
+bool power_wait_until(bool (*ready)(void), uint32_t timeout_us)
+{
+    hal_alarm_id_t alarm = 0;
+    bool satisfied;
+
+    power_wait_timed_out = false;
+    if (timeout_us) alarm = hal_alarm_in_us(timeout_us, power_wait_alarm_callback, NULL, true);
+
+    while (true)
+    {
+        uint32_t status = hal_irq_save();
+        satisfied = ready();
+        if (satisfied || power_wait_timed_out)
+        {
+            hal_irq_restore(status);
+            break;
+        }
+        hal_wait_for_interrupt(); // Uma interrupção pendente acorda o núcleo mesmo com PRIMASK ativo
+        hal_irq_restore(status); // A interrupção é atendida aqui
+    }
+
+    if (alarm > 0 && !power_wait_timed_out) hal_alarm_cancel(alarm);
+    return satisfied;
+}
+
+/**
+ * @brief Coloca o RP2040 em modo dormant até uma borda de descida em um dos GPIOs.
+ *
+ * @param[in] gpio_mask Máscara de bits dos GPIOs que acordam o sistema.
+ */
+void power_dormant_until_gpio(uint32_t gpio_mask)
+{
+    clockmgr_dormant_until_gpio(gpio_mask);
+}
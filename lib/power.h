@@ -0,0 +1,69 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal.h"
+
+/**
+ * @file power.h
+ * @brief Funções de baixo consumo: espera por interrupção (WFI) e modo dormant.
+ *
+ * O laço principal usa estas funções para não consumir CPU nem barramento
+ * enquanto nada acontece: `power_wait_until` dorme com WFI até que uma
+ * condição (por exemplo, um evento de botão na fila) seja satisfeita, e
+ * `power_dormant_until_gpio` para todos os osciladores até que um botão seja
+ * pressionado.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Power Gerenciamento de Energia
+ * @brief Espera ociosa e modo dormant do RP2040.
+ * @{
+ */
+
+/**
+ * @brief Dorme com WFI até que `ready()` retorne verdadeiro ou o tempo limite expire.
+ *
+ * A verificação e o WFI são feitos com as interrupções mascaradas (PRIMASK),
+ * de modo que uma interrupção que torne a condição verdadeira logo antes do
+ * WFI não seja perdida: a interrupção pendente acorda o núcleo e é atendida
+ * assim que a máscara é removida. O tempo limite é implementado com um alarme
+ * de hardware, que também acorda o núcleo.
+ *
+ * @param[in] ready Condição avaliada com as interrupções mascaradas; deve ser curta.
+ * @param[in] timeout_us Tempo máximo de espera em microssegundos (0 espera indefinidamente).
+ * @return `true` se a condição foi satisfeita, `false` se o tempo limite expirou.
+ */
+bool power_wait_until(bool (*ready)(void), uint32_t timeout_us);
+
+/**
+ * @brief Coloca o RP2040 em modo dormant até uma borda de descida em um dos GPIOs.
+ *
+ * Os relógios passam a ser derivados do cristal, os PLLs são desligados e o
+ * cristal é parado. Uma borda de descida em qualquer GPIO de `gpio_mask`
+ * reativa o cristal; os relógios são então reinicializados e o relógio do
+ * sistema volta à frequência do gerenciador de relógio. Como em uma troca de
+ * relógio, os drivers registrados em `clockmgr` são avisados antes (o núcleo 1
+ * termina o quadro e os comandos publicados e para) e refazem seus divisores
+ * depois. A interrupção normal do GPIO continua habilitada e é atendida logo
+ * após o despertar.
+ *
+ * @warning O USB é desligado durante o dormant; a conexão serial via USB
+ *          precisa ser reestabelecida pelo host após o despertar.
+ *
+ * @param[in] gpio_mask Máscara de bits dos GPIOs que acordam o sistema.
+ */
+void power_dormant_until_gpio(uint32_t gpio_mask);
+
+/** @} */ // Fim do grupo "Power"
+
+#endif // POWER_H
@@ -0,0 +1,181 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+#include <string.h>
+#include "clockmgr.h"
+
+/**
+ * @file profiler.c
+ * @brief Estatísticas por zona e exportação binária.
+ *
+ * Formato do registro (little-endian):
+ *   "PRF1", u8 versão, u8 zonas, u8 faixas, u8 reservado, u32 clk_sys (Hz),
+ *   para cada zona: u8 id, u8 tamanho do nome, nome, u32 execuções,
+ *   u32 mínimo, u32 máximo, u64 soma, u16 faixas[faixas];
+ *   u16 Fletcher-16 de todos os bytes após a marca.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @brief Estatísticas de uma zona.
+ */
+typedef struct
+{
+    const char *name;                     /**< Nome (NULL = zona não registrada) */
+    uint32_t count;                       /**< Execuções medidas */
+    uint32_t min;                         /**< Menor duração em ciclos */
+    uint32_t max;                         /**< Maior duração em ciclos */
+    uint64_t sum;                         /**< Soma das durações em ciclos */
+    uint16_t hist[PROFILER_HIST_BINS];    /**< Histograma log2 (satura em 65535) */
+} profiler_zone_t;
+
+static profiler_zone_t profiler_zones[PROFILER_MAX_ZONES];
+static uint8_t profiler_sum1, profiler_sum2;
+static volatile uint32_t profiler_sys_hz;  // Relógio atual, atualizado nas trocas
+static uint32_t profiler_measured_hz;      // Relógio da última medição: o do registro enviado
+
+/**
+ * @brief Troca de relógio: os ciclos seguintes passam a valer outra duração.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio do sistema.
+ * @param user Não utilizado.
+ */
+static void profiler_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    (void) user;
+    if (event == CLOCKMGR_POST_CHANGE) profiler_sys_hz = sys_hz;
+}
+
+/**
+ * @brief Inicia o contador livre de ciclos e zera as estatísticas.
+ */
+void profiler_init(void)
+{
+    hal_cycle_counter_init();
+    profiler_sys_hz = hal_clock_sys_hz();
+    clockmgr_register(profiler_clock_changed, NULL);
+    profiler_reset();
+}
+
+/**
+ * @brief Associa um nome a uma zona.
+ *
+ * @param zone Identificador da zona.
+ * @param name Nome exibido pelo decodificador.
+ */
+void profiler_register_zone(uint8_t zone, const char *name)
+{
+    if (zone < PROFILER_MAX_ZONES) profiler_zones[zone].name = name;
+}
+
+/**
+ * @brief Acumula uma medição na zona.
+ *
+ * @param zone Identificador da zona.
+ * @param cycles Ciclos gastos.
+ */
+void profiler_record(uint8_t zone, uint32_t cycles)
+{
+    if (zone >= PROFILER_MAX_ZONES) return;
+    profiler_zone_t *z = &profiler_zones[zone];
+
+    // Faixa = número de bits significativos (0 ciclos cai na faixa 0)
+    uint8_t bin = (cycles == 0) ? 0 : (uint8_t) (32 - __builtin_clz(cycles));
+    if (bin >= PROFILER_HIST_BINS) bin = PROFILER_HIST_BINS - 1;
+
+    uint32_t status = hal_irq_save(); // Zonas também podem ser medidas em interrupções
+    if (z->count == 0 || cycles < z->min) z->min = cycles;
+    if (cycles > z->max) z->max = cycles;
+    z->count++;
+    z->sum += cycles;
+    profiler_measured_hz = profiler_sys_hz;
+    if (z->hist[bin] != UINT16_MAX) z->hist[bin]++;
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Zera as estatísticas de todas as zonas.
+ */
+void profiler_reset(void)
+{
+    uint32_t status = hal_irq_save();
+    for (uint8_t i = 0; i < PROFILER_MAX_ZONES; i++)
+    {
+        const char *name = profiler_zones[i].name;
+        memset(&profiler_zones[i], 0, sizeof(profiler_zones[i]));
+        profiler_zones[i].name = name;
+    }
+    profiler_measured_hz = 0;
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Envia bytes pela serial, acumulando a soma de verificação.
+ *
+ * @param data Bytes a enviar.
+ * @param len Quantidade de bytes.
+ */
+static void profiler_emit(const void *data, size_t len)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+    for (size_t i = 0; i < len; i++)
+    {
+        profiler_sum1 = (uint8_t) ((profiler_sum1 + bytes[i]) % 255);
+        profiler_sum2 = (uint8_t) ((profiler_sum2 + profiler_sum1) % 255);
+        hal_putc_raw(bytes[i]);
+    }
+}
+
+/**
+ * @brief Envia o registro binário de todas as zonas registradas pela serial.
+ */
+void profiler_dump(void)
+{
+    profiler_zone_t snapshot;
+    uint8_t header[4] = { PROFILER_DUMP_VERSION, 0, PROFILER_HIST_BINS, 0 };
+    // As zonas são medidas na partida; o registro costuma ser pedido no menu, em outro relógio
+    uint32_t clock_hz = profiler_measured_hz ? profiler_measured_hz : profiler_sys_hz;
+
+    for (uint8_t i = 0; i < PROFILER_MAX_ZONES; i++)
+    {
+        if (profiler_zones[i].name) header[1]++;
+    }
+
+    for (uint8_t i = 0; i < 4; i++) hal_putc_raw(PROFILER_DUMP_MAGIC[i]);
+    profiler_sum1 = profiler_sum2 = 0;
+    profiler_emit(header, sizeof(header));
+    profiler_emit(&clock_hz, sizeof(clock_hz)); // O RP2040 é little-endian, como o formato
+
+    for (uint8_t i = 0; i < PROFILER_MAX_ZONES; i++)
+    {
+        if (!profiler_zones[i].name) continue;
+
+        // Cópia consistente: a serial é lenta e as zonas continuam sendo medidas
+        uint32_t status = hal_irq_save();
+        snapshot = profiler_zones[i];
+        hal_irq_restore(status);
+
+        uint8_t name_len = (uint8_t) strnlen(snapshot.name, 255);
+        profiler_emit(&i, 1);
+        profiler_emit(&name_len, 1);
+        profiler_emit(snapshot.name, name_len);
+        profiler_emit(&snapshot.count, sizeof(snapshot.count));
+        profiler_emit(&snapshot.min, sizeof(snapshot.min));
+        profiler_emit(&snapshot.max, sizeof(snapshot.max));
+        profiler_emit(&snapshot.sum, sizeof(snapshot.sum));
+        profiler_emit(snapshot.hist, sizeof(snapshot.hist));
+    }
+
+    uint8_t checksum[2] = { profiler_sum1, profiler_sum2 };
+    for (uint8_t i = 0; i < 2; i++) hal_putc_raw(checksum[i]);
+    hal_flush();
+}
+
+#endif // PROFILER_ENABLED
@@ -0,0 +1,142 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file profiler.h
+ * @brief Perfilador por zonas com contagem de ciclos (SysTick) e histogramas log2.
+ *
+ * Cada zona nomeada acumula, em RAM, quantidade de execuções, mínimo, média,
+ * máximo e um histograma em potências de 2 dos ciclos gastos. O registro
+ * completo é enviado sob demanda como um bloco binário compacto pela serial
+ * (`profiler_dump`) e decodificado no host por `tools/profiler_decode.c`.
+ *
+ * As medidas usam o SysTick do núcleo que chama as macros, contando ciclos do
+ * clk_sys em 24 bits: zonas mais longas que 2^24 ciclos (131 ms a 128 MHz) não
+ * são medidas corretamente.
+ *
+ * Com `PROFILER_ENABLED` igual a 0, todas as macros e funções viram código
+ * vazio e nada é compilado.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Profiler Perfilador por Zonas
+ * @brief Medição de ciclos por etapa do quadro.
+ * @{
+ */
+
+/**
+ * @def PROFILER_ENABLED
+ * @brief 1 compila o perfilador; 0 remove todas as medições.
+ */
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+/**
+ * @def PROFILER_MAX_ZONES
+ * @brief Quantidade máxima de zonas.
+ */
+#define PROFILER_MAX_ZONES 16
+
+/**
+ * @def PROFILER_HIST_BINS
+ * @brief Faixas do histograma: a faixa k conta durações em [2^(k-1), 2^k) ciclos.
+ */
+#define PROFILER_HIST_BINS 25
+
+/**
+ * @def PROFILER_DUMP_MAGIC
+ * @brief Marca de início do registro binário ("PRF1").
+ */
+#define PROFILER_DUMP_MAGIC "PRF1"
+
+/**
+ * @def PROFILER_DUMP_VERSION
+ * @brief Versão do formato do registro binário.
+ */
+#define PROFILER_DUMP_VERSION 1
+
+#if PROFILER_ENABLED
+
+#include "hal.h"
+
+/**
+ * @brief Lê o contador de ciclos (decrescente, 24 bits; SysTick no RP2040).
+ *
+ * @return Valor atual do contador.
+ */
+static inline uint32_t profiler_now(void) { return hal_cycle_counter(); }
+
+/**
+ * @brief Inicia a medição de uma zona no escopo atual.
+ *
+ * @param zone Identificador da zona (0 a `PROFILER_MAX_ZONES` - 1).
+ */
+#define PROFILE_BEGIN(zone) uint32_t profiler_start_##zone = profiler_now()
+
+/**
+ * @brief Encerra a medição de uma zona iniciada com `PROFILE_BEGIN` no mesmo escopo.
+ *
+ * @param zone Identificador da zona.
+ */
+#define PROFILE_END(zone) profiler_record((zone), (profiler_start_##zone - profiler_now()) & 0xFFFFFFu)
+
+/**
+ * @brief Inicia o SysTick como contador livre de ciclos do núcleo atual e zera as estatísticas.
+ */
+void profiler_init(void);
+
+/**
+ * @brief Associa um nome a uma zona (o texto deve permanecer válido).
+ *
+ * @param zone Identificador da zona.
+ * @param name Nome exibido pelo decodificador.
+ */
+void profiler_register_zone(uint8_t zone, const char *name);
+
+/**
+ * @brief Acumula uma medição na zona.
+ *
+ * @param zone Identificador da zona.
+ * @param cycles Ciclos gastos.
+ */
+void profiler_record(uint8_t zone, uint32_t cycles);
+
+/**
+ * @brief Zera as estatísticas de todas as zonas (os nomes são mantidos).
+ */
+void profiler_reset(void);
+
+/**
+ * @brief Envia o registro binário de todas as zonas registradas pela serial.
+ *
+ * Os bytes são escritos com `putchar_raw`, sem conversão de fim de linha.
+ */
+void profiler_dump(void);
+
+#else
+
+#define PROFILE_BEGIN(zone) do { } while (0)
+#define PROFILE_END(zone) do { } while (0)
+static inline void profiler_init(void) { }
+static inline void profiler_register_zone(uint8_t zone, const char *name) { (void) zone; (void) name; }
+static inline void profiler_record(uint8_t zone, uint32_t cycles) { (void) zone; (void) cycles; }
+static inline void profiler_reset(void) { }
+static inline void profiler_dump(void) { }
+
+#endif // PROFILER_ENABLED
+
+/** @} */ // Fim do grupo "Profiler"
+
+#endif // PROFILER_H
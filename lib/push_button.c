@@ -1,25 +1,65 @@
 #include "push_button.h"
-#include "pico/stdlib.h"
+#include "workqueue.h"
 
 /**
- * @brief Tempo de debounce do botão em milissegundos.
+ * @brief Indica, na tabela de botões, um pino sem debounce individual.
  */
-#define DEBOUNCE_DELAY_MS 300
+#define PB_NO_SLOT 0xFF
 
 /**
- * @brief Flag para indicar a primeira configuração de IRQ.
+ * @brief Estado da máquina de debounce de um botão.
+ *
+ * Os campos marcados como "ISR" são escritos apenas pela interrupção, exceto
+ * durante a correção feita em `pb_get_event`, que ocorre com as interrupções
+ * mascaradas.
  */
-volatile bool FIRST_IRQ_USE = true;
+typedef struct
+{
+    uint8_t gpio;              /**< Pino do botão */
+    bool pressed;              /**< Estado estável atual (ISR) */
+    uint32_t debounce_us;      /**< Janela de debounce */
+    uint32_t long_press_us;    /**< Janela de toque longo (0 desativa) */
+    uint32_t double_press_us;  /**< Janela de toque duplo (0 desativa) */
+    uint32_t last_accept_us;   /**< Instante da última borda aceita (ISR) */
+    uint32_t last_press_us;    /**< Instante do último pressionamento aceito (ISR) */
+    uint32_t press_count;      /**< Pressionamentos aceitos; muda a cada PRESS (ISR) */
+    uint32_t long_check_count; /**< `press_count` no momento em que o toque longo foi avaliado */
+} pb_debouncer_t;
 
 /**
- * @brief Ponteiro para a função de callback de interrupção do botão.
+ * @brief Máquinas de debounce dos botões registrados.
+ */
+static pb_debouncer_t pb_debouncers[PB_MAX_BUTTONS];
+
+/**
+ * @brief Quantidade de botões registrados em `pb_debouncers`.
+ */
+static uint8_t pb_debouncer_count = 0;
+
+/**
+ * @brief Tabela GPIO -> índice em `pb_debouncers` (ou `PB_NO_SLOT`).
  */
-volatile gpio_irq_callback_t PB_IRQ_CALLBACK = NULL;
+static uint8_t pb_slot_of_gpio[32] = {
+    [0 ... 31] = PB_NO_SLOT
+};
 
 /**
- * @brief Armazena o tempo da última ativação do botão para controle de debounce.
+ * @brief Fila de eventos: escrita pela interrupção (head), lida pelo laço principal (tail).
  */
-volatile uint32_t PB_DEBOUNCE_LAST_TIME = 0;
+static pb_event_t pb_event_queue[PB_EVENT_QUEUE_LEN];
+static volatile uint32_t pb_event_head = 0;
+static volatile uint32_t pb_event_tail = 0;
+static volatile uint32_t pb_event_dropped = 0;
+
+/**
+ * @brief Flag para indicar a primeira configuração de IRQ.
+ */
+volatile bool FIRST_IRQ_USE = true;
+
+/**
+ * @brief Ponteiro para a função de callback de interrupção do botão.
+ */
+volatile hal_gpio_irq_callback_t PB_IRQ_CALLBACK = NULL;
 
 /**
  * @brief Configura o pino do botão como entrada e ativa o pull-up, se necessário.
@@ -29,8 +69,8 @@ volatile uint32_t PB_DEBOUNCE_LAST_TIME = 0;
  */
 void pb_config(uint8_t button_pin, bool pullup)
 {
-    gpio_init(button_pin); // Inicializa o pino do botão
-    if(pullup) gpio_pull_up(button_pin); // Ativa pull-up interno se necessário
+    hal_gpio_init(button_pin); // Inicializa o pino do botão
+    if(pullup) hal_gpio_pull_up(button_pin); // Ativa pull-up interno se necessário
 }
 
 /**
@@ -38,7 +78,7 @@ void pb_config(uint8_t button_pin, bool pullup)
  *
  * @param callback Função de callback a ser chamada quando o botão for pressionado.
  */
-void pb_set_irq_callback(gpio_irq_callback_t callback) { PB_IRQ_CALLBACK = callback; }
+void pb_set_irq_callback(hal_gpio_irq_callback_t callback) { PB_IRQ_CALLBACK = callback; }
 
 /**
  * @brief Habilita a interrupção no botão e registra a callback definida.
@@ -49,9 +89,9 @@ void pb_enable_irq(uint button_pin)
 {
     if(FIRST_IRQ_USE) {
         // Registra a callback e ativa a interrupção na borda de descida
-        gpio_set_irq_enabled_with_callback(button_pin, GPIO_IRQ_EDGE_FALL, true, PB_IRQ_CALLBACK);
+        hal_gpio_set_irq_enabled_with_callback(button_pin, HAL_GPIO_IRQ_EDGE_FALL, true, PB_IRQ_CALLBACK);
     } else {
-        gpio_set_irq_enabled(button_pin, GPIO_IRQ_EDGE_FALL, true); // Habilita a interrupção sem callback
+        hal_gpio_set_irq_enabled(button_pin, HAL_GPIO_IRQ_EDGE_FALL, true); // Habilita a interrupção sem callback
     }
 }
 
@@ -61,22 +101,234 @@ void pb_enable_irq(uint button_pin)
  * @param button_pin Pino do GPIO ao qual o botão está conectado.
  * @return `true` se o botão estiver pressionado, `false` caso contrário.
  */
-bool pb_is_button_pressed(uint8_t button_pin) { return (!gpio_get(button_pin)); }
+bool pb_is_button_pressed(uint8_t button_pin) { return (!hal_gpio_get(button_pin)); }
+
+/**
+ * @brief Coloca um evento na fila (lado produtor, chamado pela interrupção).
+ *
+ * @param gpio Pino do botão.
+ * @param type Tipo do evento.
+ * @param time_us Instante da borda.
+ */
+static void pb_event_push(uint8_t gpio, pb_event_type_t type, uint32_t time_us)
+{
+    uint32_t head = pb_event_head;
+    if (head - pb_event_tail >= PB_EVENT_QUEUE_LEN)
+    {
+        pb_event_dropped++; // Fila cheia: o laço principal não está drenando
+        return;
+    }
+    pb_event_t *slot = &pb_event_queue[head & (PB_EVENT_QUEUE_LEN - 1)];
+    slot->gpio = gpio;
+    slot->type = (uint8_t) type;
+    slot->time_us = time_us;
+    hal_dmb(); // O evento precisa estar escrito antes de ser publicado
+    pb_event_head = head + 1;
+}
 
 /**
- * @brief Verifica se o tempo de debounce já passou desde o último acionamento.
+ * @brief Aplica uma transição estável ao botão e gera os eventos correspondentes.
  *
- * @return `true` se o tempo de debounce já passou, `false` caso contrário.
+ * @param db Máquina de debounce do botão.
+ * @param pressed Novo estado estável.
+ * @param now Instante da transição.
+ * @param out Se não nulo, recebe o evento em vez de colocá-lo na fila.
+ * @return `true` se um evento foi entregue em `out`.
  */
-bool pb_is_debounce_delay_over()
+static bool pb_debouncer_accept(pb_debouncer_t *db, bool pressed, uint32_t now, pb_event_t *out)
 {
-    uint32_t current_time = to_ms_since_boot(get_absolute_time()); // Obtém o tempo atual desde o boot
-    bool debounce_time_elapsed = (current_time - PB_DEBOUNCE_LAST_TIME >= DEBOUNCE_DELAY_MS);
-    
-    if(debounce_time_elapsed)
+    bool is_double = pressed && db->double_press_us != 0 && db->press_count != 0 &&
+                     (now - db->last_press_us) <= db->double_press_us;
+    db->pressed = pressed;
+    db->last_accept_us = now;
+    if (pressed)
+    {
+        db->last_press_us = now;
+        db->press_count++;
+    }
+    pb_event_type_t type = pressed ? PB_EVENT_PRESS : PB_EVENT_RELEASE;
+    if (out)
     {
-        PB_DEBOUNCE_LAST_TIME = current_time; // Atualiza o tempo do último acionamento
+        out->gpio = db->gpio;
+        out->type = (uint8_t) type;
+        out->time_us = now;
+        if (is_double) pb_event_push(db->gpio, PB_EVENT_DOUBLE_PRESS, now);
         return true;
     }
+    pb_event_push(db->gpio, type, now);
+    if (is_double) pb_event_push(db->gpio, PB_EVENT_DOUBLE_PRESS, now);
+    return false;
+}
+
+/**
+ * @brief Callback de interrupção dos GPIOs quando há botões com debounce individual.
+ *
+ * Custo constante: uma consulta de tabela, uma comparação de tempo e no
+ * máximo dois eventos colocados na fila. Pinos sem debounce individual são
+ * repassados à callback do usuário.
+ *
+ * @param gpio Pino que gerou a interrupção.
+ * @param events Máscara de bordas ocorridas.
+ */
+static void pb_debounce_irq_callback(uint gpio, uint32_t events)
+{
+    uint32_t now = work_isr_begin();
+    uint8_t slot = (gpio < 32) ? pb_slot_of_gpio[gpio] : PB_NO_SLOT;
+    if (slot == PB_NO_SLOT)
+    {
+        if (PB_IRQ_CALLBACK) PB_IRQ_CALLBACK(gpio, events);
+    }
+    else
+    {
+        pb_debouncer_t *db = &pb_debouncers[slot];
+        bool pressed = !hal_gpio_get(gpio); // Botões ativos em nível baixo (pull-up)
+
+        // Ignora repiques: a borda só vale se o pino estava estável desde a última aceita
+        if (pressed != db->pressed && (now - db->last_accept_us) >= db->debounce_us) pb_debouncer_accept(db, pressed, now, NULL);
+    }
+    work_isr_end(now);
+}
+
+/**
+ * @brief Ativa o debounce individual de um botão, com geração de eventos.
+ *
+ * @param button_pin Pino GPIO do botão (já configurado com `pb_config`).
+ * @param debounce_ms Janela de debounce em milissegundos.
+ * @param long_press_ms Tempo pressionado para gerar `PB_EVENT_LONG_PRESS` (0 desativa).
+ * @param double_press_ms Intervalo máximo entre toques para gerar `PB_EVENT_DOUBLE_PRESS` (0 desativa).
+ * @return `false` se já houver `PB_MAX_BUTTONS` botões com debounce individual.
+ */
+bool pb_debounce_enable(uint8_t button_pin, uint16_t debounce_ms, uint16_t long_press_ms, uint16_t double_press_ms)
+{
+    if (pb_debouncer_count >= PB_MAX_BUTTONS || button_pin >= 32) return false;
+
+    pb_debouncer_t *db = &pb_debouncers[pb_debouncer_count];
+    db->gpio = button_pin;
+    db->pressed = pb_is_button_pressed(button_pin);
+    db->debounce_us = (uint32_t) debounce_ms * 1000u;
+    db->long_press_us = (uint32_t) long_press_ms * 1000u;
+    db->double_press_us = (uint32_t) double_press_ms * 1000u;
+    db->last_accept_us = hal_time_us32();
+    db->last_press_us = 0;
+    db->press_count = 0;
+    db->long_check_count = 0;
+    pb_slot_of_gpio[button_pin] = pb_debouncer_count++;
+
+    // O callback de GPIO é único por núcleo: registra o do debounce, que repassa os demais pinos
+    hal_gpio_set_irq_enabled_with_callback(button_pin, HAL_GPIO_IRQ_EDGE_FALL | HAL_GPIO_IRQ_EDGE_RISE, true, &pb_debounce_irq_callback);
+    FIRST_IRQ_USE = false;
+    return true;
+}
+
+/**
+ * @brief Verifica, sem retirar, se há eventos na fila preenchida pela interrupção.
+ *
+ * @return `true` se houver ao menos um evento pendente.
+ */
+bool pb_has_event(void)
+{
+    return pb_event_head != pb_event_tail;
+}
+
+/**
+ * @brief Quantidade de eventos descartados por fila cheia desde o início.
+ *
+ * @return Contador de eventos descartados.
+ */
+uint32_t pb_dropped_events(void)
+{
+    return pb_event_dropped;
+}
+
+/**
+ * @brief Tempo até a próxima verificação que `pb_get_event` precisa fazer por conta própria.
+ *
+ * @return Microssegundos até a borda pendente assentar ou o toque longo vencer (ao menos 1),
+ *         ou 0 se nenhum botão depende do tempo.
+ */
+uint32_t pb_settle_timeout_us(void)
+{
+    uint32_t now = hal_time_us32();
+    uint32_t timeout = 0;
+    for (uint8_t i = 0; i < pb_debouncer_count; i++)
+    {
+        const pb_debouncer_t *db = &pb_debouncers[i];
+        uint32_t remaining;
+
+        // Nível diferente do estado estável: uma borda caiu dentro da janela e foi ignorada
+        if (pb_is_button_pressed(db->gpio) != db->pressed)
+        {
+            uint32_t elapsed = now - db->last_accept_us;
+            remaining = elapsed < db->debounce_us ? db->debounce_us - elapsed : 1;
+        }
+        else if (db->pressed && db->long_press_us != 0 && db->long_check_count != db->press_count)
+        {
+            uint32_t elapsed = now - db->last_press_us;
+            remaining = elapsed < db->long_press_us ? db->long_press_us - elapsed : 1;
+        }
+        else continue;
+        if (timeout == 0 || remaining < timeout) timeout = remaining;
+    }
+    return timeout;
+}
+
+/**
+ * @brief Verifica toques longos e bordas perdidas dentro da janela de debounce.
+ *
+ * Executada com as interrupções mascaradas, pois pode alterar o estado que a
+ * interrupção também escreve.
+ *
+ * @param event Evento gerado, se houver.
+ * @return `true` se um evento foi gerado.
+ */
+static bool pb_poll_debouncers(pb_event_t *event)
+{
+    uint32_t now = hal_time_us32();
+    for (uint8_t i = 0; i < pb_debouncer_count; i++)
+    {
+        pb_debouncer_t *db = &pb_debouncers[i];
+        uint32_t status = hal_irq_save();
+        bool pressed = pb_is_button_pressed(db->gpio);
+
+        // Nível diferente do estado estável após a janela: a borda caiu dentro do debounce
+        if (pressed != db->pressed && (now - db->last_accept_us) >= db->debounce_us)
+        {
+            bool delivered = pb_debouncer_accept(db, pressed, now, event);
+            hal_irq_restore(status);
+            return delivered;
+        }
+
+        // Toque longo: reportado uma única vez por pressionamento
+        if (db->pressed && db->long_press_us != 0 && db->long_check_count != db->press_count &&
+            (now - db->last_press_us) >= db->long_press_us)
+        {
+            db->long_check_count = db->press_count;
+            hal_irq_restore(status);
+            event->gpio = db->gpio;
+            event->type = PB_EVENT_LONG_PRESS;
+            event->time_us = now;
+            return true;
+        }
+        hal_irq_restore(status);
+    }
     return false;
 }
+
+/**
+ * @brief Retira o próximo evento de botão, se houver.
+ *
+ * @param event Evento retirado.
+ * @return `true` se um evento foi retirado, `false` se não há eventos.
+ */
+bool pb_get_event(pb_event_t *event)
+{
+    uint32_t tail = pb_event_tail;
+    if (tail != pb_event_head)
+    {
+        *event = pb_event_queue[tail & (PB_EVENT_QUEUE_LEN - 1)];
+        hal_dmb(); // Termina a leitura antes de liberar a posição para a interrupção
+        pb_event_tail = tail + 1;
+        return true;
+    }
+    return pb_poll_debouncers(event);
+}
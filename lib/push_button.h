@@ -2,7 +2,7 @@
 #define PUSH_BUTTON_C
 
 #include <stdint.h>
-#include "pico/stdlib.h"
+#include "hal.h"
 
 // Definição dos pinos de conexão dos botões
 #define BUTTON_A_PIN 5      /**< Define o pino GPIO do botão A */
@@ -15,6 +15,12 @@
 #define pb_config_btn_b() pb_config(BUTTON_B_PIN, true)  /**< Configura o botão B com pull-up */
 #define pb_is_button_a_pressed() pb_is_button_pressed(BUTTON_A)
 
+#define PB_DEBOUNCE_DEFAULT_MS 50      /**< Janela de debounce padrão de cada botão */
+#define PB_LONG_PRESS_DEFAULT_MS 800   /**< Tempo pressionado para gerar um toque longo */
+#define PB_DOUBLE_PRESS_DEFAULT_MS 300 /**< Intervalo máximo entre dois toques de um toque duplo */
+#define PB_MAX_BUTTONS 8               /**< Quantidade máxima de botões com debounce individual */
+#define PB_EVENT_QUEUE_LEN 32          /**< Capacidade da fila de eventos (potência de dois) */
+
 /**
  * @file push_button.c
  * @brief Este arquivo contém funções e definições que permitem
@@ -25,10 +31,30 @@
  * @date 31/01/2025
  */
 
+/**
+ * @brief Tipos de evento gerados pelo debounce individual dos botões.
+ */
+typedef enum
+{
+    PB_EVENT_PRESS,        /**< Botão pressionado (borda estável de descida) */
+    PB_EVENT_RELEASE,      /**< Botão solto (borda estável de subida) */
+    PB_EVENT_LONG_PRESS,   /**< Botão mantido pressionado por mais que a janela de toque longo */
+    PB_EVENT_DOUBLE_PRESS  /**< Segundo toque dentro da janela de toque duplo (após o PRESS) */
+} pb_event_type_t;
+
+/**
+ * @brief Evento de botão entregue ao laço principal.
+ */
+typedef struct
+{
+    uint8_t gpio;        /**< Pino do botão */
+    uint8_t type;        /**< Um dos valores de `pb_event_type_t` */
+    uint32_t time_us;    /**< Instante da borda que originou o evento */
+} pb_event_t;
+
 /** Variáveis externas */
 extern volatile bool FIRST_IRQ_USE; /**< Variável de controle para a primeira utilização da interrupção */
-extern volatile gpio_irq_callback_t PB_IRQ_CALLBACK; /**< Função callback para a interrupção do botão */
-extern volatile uint32_t PB_DEBOUNCE_LAST_TIME;
+extern volatile hal_gpio_irq_callback_t PB_IRQ_CALLBACK; /**< Função callback para a interrupção do botão */
 
 /**
  * @brief Configura o pino do botão para o modo desejado (com ou sem pull-up).
@@ -50,7 +76,7 @@ void pb_config(uint8_t button_pin, bool pullup);
  * 
  * @param callback Função callback a ser chamada durante a interrupção do botão.
  */
-void pb_set_irq_callback(gpio_irq_callback_t callback);
+void pb_set_irq_callback(hal_gpio_irq_callback_t callback);
 
 
 /**
@@ -65,6 +91,65 @@ void pb_enable_irq(uint button_pin);
 
 bool pb_is_button_pressed(uint8_t button_pin);
 
-bool pb_is_debounce_delay_over();
+/**
+ * @brief Ativa o debounce individual de um botão, com geração de eventos.
+ *
+ * A interrupção do pino passa a ser tratada nas duas bordas por uma máquina
+ * de estados própria do botão: uma borda só é aceita se o pino estiver estável
+ * há pelo menos `debounce_ms` desde a última borda aceita. Cada borda aceita
+ * gera um evento que é colocado em uma fila lock-free (um produtor, a
+ * interrupção; um consumidor, o laço principal). A rotina de interrupção tem
+ * custo constante e não altera nada além do estado do próprio botão.
+ *
+ * Interrupções de pinos que não usam debounce individual continuam sendo
+ * repassadas à callback registrada com `pb_set_irq_callback`.
+ *
+ * @param button_pin Pino GPIO do botão (já configurado com `pb_config`).
+ * @param debounce_ms Janela de debounce em milissegundos.
+ * @param long_press_ms Tempo pressionado para gerar `PB_EVENT_LONG_PRESS` (0 desativa).
+ * @param double_press_ms Intervalo máximo entre toques para gerar `PB_EVENT_DOUBLE_PRESS` (0 desativa).
+ * @return `false` se já houver `PB_MAX_BUTTONS` botões com debounce individual.
+ */
+bool pb_debounce_enable(uint8_t button_pin, uint16_t debounce_ms, uint16_t long_press_ms, uint16_t double_press_ms);
+
+/**
+ * @brief Retira o próximo evento de botão, se houver.
+ *
+ * Deve ser chamada apenas pelo laço principal. Além de esvaziar a fila
+ * preenchida pela interrupção, detecta toques longos e corrige o estado de
+ * botões cuja última borda tenha caído dentro da janela de debounce (por
+ * exemplo, um toque mais curto que a janela), de forma que nenhum
+ * pressionamento ou liberação seja perdido.
+ *
+ * @param event Evento retirado.
+ * @return `true` se um evento foi retirado, `false` se não há eventos.
+ */
+bool pb_get_event(pb_event_t *event);
+
+/**
+ * @brief Verifica, sem retirar, se há eventos na fila preenchida pela interrupção.
+ *
+ * @return `true` se houver ao menos um evento pendente.
+ */
+bool pb_has_event(void);
+
+/**
+ * @brief Quantidade de eventos descartados por fila cheia desde o início.
+ *
+ * @return Contador de eventos descartados.
+ */
+uint32_t pb_dropped_events(void);
+
+/**
+ * @brief Tempo até a próxima verificação que `pb_get_event` precisa fazer por conta própria.
+ *
+ * Bordas aceitas chegam pela interrupção, mas uma borda ignorada dentro da
+ * janela de debounce e o toque longo só são percebidos quando `pb_get_event`
+ * é chamada depois do prazo. Quem dorme esperando eventos usa este valor
+ * como tempo limite; com 0, pode esperar apenas pela próxima interrupção.
+ *
+ * @return Microssegundos até o próximo prazo (ao menos 1), ou 0 se nenhum botão depende do tempo.
+ */
+uint32_t pb_settle_timeout_us(void);
 
 #endif //PUSH_BUTTON_H
@@ -0,0 +1,182 @@
+#include "raster.h"
+#include <stdlib.h>
+
+/**
+ * @file raster.c
+ * @brief Trechos de coluna com máscara e as formas montadas sobre eles.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @brief Escreve as linhas `y0..y1` (da RAM, já recortadas) de uma coluna.
+ */
+static void raster_column(uint8_t *column, uint8_t y0, uint8_t y1, bool value)
+{
+    uint8_t p0 = y0 >> 3, p1 = y1 >> 3;
+    uint8_t first = (uint8_t) (0xFFu << (y0 & 7));
+    uint8_t last = (uint8_t) (0xFFu >> (7 - (y1 & 7)));
+
+    if (p0 == p1) first &= last;
+    if (value) column[p0] |= first;
+    else column[p0] &= (uint8_t) ~first;
+    if (p0 == p1) return;
+
+    for (uint8_t p = p0 + 1; p < p1; p++) column[p] = value ? 0xFF : 0x00;
+    if (value) column[p1] |= last;
+    else column[p1] &= (uint8_t) ~last;
+}
+
+void raster_vspan(ssd1306_t *ssd, int16_t x, int16_t y0, int16_t y1, bool value)
+{
+    if (x < 0 || x >= ssd->width) return;
+    if (y0 < 0) y0 = 0;
+    if (y1 >= ssd->height) y1 = ssd->height - 1;
+    if (y0 > y1) return;
+
+    uint8_t *column = ssd->ram_buffer + 1 + x * ssd->pages;
+
+    // A linha de tela y fica na linha y + start_line da RAM (anel de `height` linhas)
+    y0 += ssd->start_line;
+    y1 += ssd->start_line;
+    if (y0 >= ssd->height)
+    {
+        y0 -= ssd->height;
+        y1 -= ssd->height;
+    }
+    else if (y1 >= ssd->height)
+    {
+        raster_column(column, 0, (uint8_t) (y1 - ssd->height), value);
+        y1 = ssd->height - 1;
+    }
+    raster_column(column, (uint8_t) y0, (uint8_t) y1, value);
+}
+
+void raster_fill_circle(ssd1306_t *ssd, int16_t cx, int16_t cy, uint8_t r, bool value)
+{
+    int32_t limit = (int32_t) r * r + r; // r² + r arredonda a borda como o círculo do ponto médio
+    int16_t h = r;
+
+    raster_vspan(ssd, cx, cy - r, cy + r, value);
+    for (int16_t dx = 1; dx <= r; dx++)
+    {
+        // A meia-altura só diminui com dx: no total, r passos
+        while ((int32_t) h * h + (int32_t) dx * dx > limit) h--;
+        raster_vspan(ssd, cx - dx, cy - h, cy + h, value);
+        raster_vspan(ssd, cx + dx, cy - h, cy + h, value);
+    }
+}
+
+/**
+ * @brief Percorre uma aresta com Bresenham, alargando o intervalo de cada coluna visível.
+ *
+ * A aresta é sempre percorrida da esquerda para a direita: nos empates do
+ * Bresenham, os dois sentidos acendem pixels diferentes, e uma aresta
+ * repetida (polígono degenerado, linha de espessura 1) engrossaria.
+ */
+static void raster_edge(int16_t *top, int16_t *bottom, int16_t width, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+    if (x0 > x1 || (x0 == x1 && y0 > y1))
+    {
+        int16_t t = x0;
+        x0 = x1;
+        x1 = t;
+        t = y0;
+        y0 = y1;
+        y1 = t;
+    }
+
+    int16_t dx = (int16_t) abs(x1 - x0), dy = (int16_t) -abs(y1 - y0);
+    int16_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    while (true)
+    {
+        if (x0 >= 0 && x0 < width)
+        {
+            if (y0 < top[x0]) top[x0] = y0;
+            if (y0 > bottom[x0]) bottom[x0] = y0;
+        }
+        if (x0 == x1 && y0 == y1) break;
+        int32_t e2 = 2 * err;
+        if (e2 > dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void raster_fill_convex(ssd1306_t *ssd, const raster_point_t *points, uint8_t count, bool value)
+{
+    int16_t top[WIDTH], bottom[WIDTH];
+    int16_t x_min = INT16_MAX, x_max = INT16_MIN;
+
+    if (count == 0 || count > RASTER_MAX_VERTICES) return;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (points[i].x < x_min) x_min = points[i].x;
+        if (points[i].x > x_max) x_max = points[i].x;
+    }
+    // Recorte horizontal, uma vez para o polígono inteiro
+    if (x_min < 0) x_min = 0;
+    if (x_max >= ssd->width) x_max = ssd->width - 1;
+    if (x_min > x_max) return;
+
+    for (int16_t x = x_min; x <= x_max; x++)
+    {
+        top[x] = INT16_MAX;
+        bottom[x] = INT16_MIN;
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const raster_point_t *a = &points[i], *b = &points[(i + 1) % count];
+        raster_edge(top, bottom, ssd->width, a->x, a->y, b->x, b->y);
+    }
+    for (int16_t x = x_min; x <= x_max; x++) raster_vspan(ssd, x, top[x], bottom[x], value);
+}
+
+/**
+ * @brief `v * k / length`, arredondado para o inteiro mais próximo.
+ */
+static int16_t raster_scale(int32_t v, int32_t k, int32_t length)
+{
+    return (int16_t) ((2 * v * k + (v < 0 ? -length : length)) / (2 * length));
+}
+
+void raster_thick_line(ssd1306_t *ssd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool value)
+{
+    int32_t dx = x1 - x0, dy = y1 - y0;
+    int16_t ax = 0, ay = 0, bx = 0, by = 0;
+
+    if (thickness > 1 && (dx || dy))
+    {
+        // Comprimento inteiro por Newton. Além do pixel do eixo, a borda do lado
+        // da normal (-dy, dx) fica a (espessura - 1) / 2 pixels e a do outro lado,
+        // a espessura / 2: com espessura par, o pixel a mais vai para o outro lado
+        int32_t sq = dx * dx + dy * dy;
+        int32_t length = sq;
+        for (int32_t next = (length + 1) / 2; next < length; next = (length + sq / length) / 2) length = next;
+        ax = raster_scale(-dy, (thickness - 1) / 2, length);
+        ay = raster_scale(dx, (thickness - 1) / 2, length);
+        bx = raster_scale(-dy, thickness / 2, length);
+        by = raster_scale(dx, thickness / 2, length);
+    }
+
+    const raster_point_t quad[4] = {
+        { (int16_t) (x0 + ax), (int16_t) (y0 + ay) },
+        { (int16_t) (x1 + ax), (int16_t) (y1 + ay) },
+        { (int16_t) (x1 - bx), (int16_t) (y1 - by) },
+        { (int16_t) (x0 - bx), (int16_t) (y0 - by) },
+    };
+    raster_fill_convex(ssd, quad, 4, value);
+}
@@ -0,0 +1,108 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/**
+ * @file raster.h
+ * @brief Círculos, polígonos convexos e linhas grossas preenchidos por trechos de coluna.
+ *
+ * Com o endereçamento vertical do SSD1306, uma coluna é contígua no
+ * `ram_buffer` (um byte por página), enquanto pixels vizinhos na horizontal
+ * ficam em bytes distintos. Por isso as formas são varridas coluna a coluna:
+ * cada coluna coberta vira um trecho vertical `y0..y1`, recortado uma vez e
+ * escrito com uma máscara na primeira e na última página e bytes inteiros no
+ * meio (no máximo 8 escritas, contra até 64 chamadas de `ssd1306_pixel`).
+ *
+ * As coordenadas são da tela e podem sair dela (a forma é recortada). Com a
+ * linha inicial do display deslocada (`tilecanvas_render`), os trechos são
+ * levados para a RAM como em `ssd1306_pixel`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Raster Rasterização por Trechos
+ * @brief Formas preenchidas escritas em bytes de coluna.
+ * @{
+ */
+
+/**
+ * @def RASTER_MAX_VERTICES
+ * @brief Maior número de vértices de um polígono.
+ */
+#define RASTER_MAX_VERTICES 16
+
+/**
+ * @brief Vértice de um polígono, em coordenadas da tela.
+ */
+typedef struct
+{
+    int16_t x;
+    int16_t y;
+} raster_point_t;
+
+/**
+ * @brief Acende ou apaga as linhas `y0..y1` (inclusive) da coluna `x`.
+ *
+ * @param ssd Display.
+ * @param x Coluna.
+ * @param y0 Primeira linha.
+ * @param y1 Última linha (`y1 < y0` não desenha nada).
+ * @param value `true` para acender.
+ */
+void raster_vspan(ssd1306_t *ssd, int16_t x, int16_t y0, int16_t y1, bool value);
+
+/**
+ * @brief Preenche um círculo.
+ *
+ * As meias-alturas das colunas são obtidas de forma incremental, sem raiz
+ * quadrada: O(r) operações além da escrita dos trechos.
+ *
+ * @param ssd Display.
+ * @param cx Coluna do centro.
+ * @param cy Linha do centro.
+ * @param r Raio em pixels (0 = um pixel).
+ * @param value `true` para acender.
+ */
+void raster_fill_circle(ssd1306_t *ssd, int16_t cx, int16_t cy, uint8_t r, bool value);
+
+/**
+ * @brief Preenche um polígono convexo, bordas incluídas.
+ *
+ * Cada aresta é percorrida uma vez, registrando a menor e a maior linha de
+ * cada coluna que cruza; depois cada coluna vira um trecho. Para um polígono
+ * não convexo, cada coluna é preenchida entre os extremos dela.
+ *
+ * @param ssd Display.
+ * @param points Vértices, em qualquer sentido.
+ * @param count Quantidade (1 a `RASTER_MAX_VERTICES`).
+ * @param value `true` para acender.
+ */
+void raster_fill_convex(ssd1306_t *ssd, const raster_point_t *points, uint8_t count, bool value);
+
+/**
+ * @brief Desenha uma linha grossa: o quadrilátero que envolve o segmento, preenchido.
+ *
+ * @param ssd Display.
+ * @param x0 Coluna do início.
+ * @param y0 Linha do início.
+ * @param x1 Coluna do fim.
+ * @param y1 Linha do fim.
+ * @param thickness Espessura em pixels, medida na perpendicular (1 = a linha de Bresenham, como `ssd1306_line` traçada
+ *                  da esquerda para a direita). Com espessura par, o pixel a mais fica do lado da normal (dy, -dx).
+ * @param value `true` para acender.
+ */
+void raster_thick_line(ssd1306_t *ssd, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t thickness, bool value);
+
+/** @} */ // Fim do grupo "Raster"
+
+#endif // RASTER_H
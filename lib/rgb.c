@@ -1,5 +1,55 @@
 #include "rgb.h"
-#include "hardware/pwm.h"
+#include "clockmgr.h"
+#include "workqueue.h"
+
+/**
+ * @brief Curva gama 2.2 em Q16: round((i / 255)^2.2 * 65535).
+ */
+static const uint16_t RGB_GAMMA_Q16[256] = {
+    0,     0,     2,     4,     7,    11,    17,    24,    32,    42,    53,    65,    79,    94,   111,   129,
+    148,   169,   192,   216,   242,   270,   299,   330,   362,   396,   432,   469,   508,   549,   591,   635,
+    681,   729,   779,   830,   883,   938,   995,  1053,  1113,  1175,  1239,  1305,  1373,  1443,  1514,  1587,
+    1663,  1740,  1819,  1900,  1983,  2068,  2155,  2243,  2334,  2427,  2521,  2618,  2717,  2817,  2920,  3024,
+    3131,  3240,  3350,  3463,  3578,  3694,  3813,  3934,  4057,  4182,  4309,  4438,  4570,  4703,  4838,  4976,
+    5115,  5257,  5401,  5547,  5695,  5845,  5998,  6152,  6309,  6468,  6629,  6792,  6957,  7124,  7294,  7466,
+    7640,  7816,  7994,  8175,  8358,  8543,  8730,  8919,  9111,  9305,  9501,  9699,  9900, 10102, 10307, 10515,
+    10724, 10936, 11150, 11366, 11585, 11806, 12029, 12254, 12482, 12712, 12944, 13179, 13416, 13655, 13896, 14140,
+    14386, 14635, 14885, 15138, 15394, 15652, 15912, 16174, 16439, 16706, 16975, 17247, 17521, 17798, 18077, 18358,
+    18642, 18928, 19216, 19507, 19800, 20095, 20393, 20694, 20996, 21301, 21609, 21919, 22231, 22546, 22863, 23182,
+    23504, 23829, 24156, 24485, 24817, 25151, 25487, 25826, 26168, 26512, 26858, 27207, 27558, 27912, 28268, 28627,
+    28988, 29351, 29717, 30086, 30457, 30830, 31206, 31585, 31966, 32349, 32735, 33124, 33514, 33908, 34304, 34702,
+    35103, 35507, 35913, 36321, 36732, 37146, 37562, 37981, 38402, 38825, 39252, 39680, 40112, 40546, 40982, 41421,
+    41862, 42306, 42753, 43202, 43654, 44108, 44565, 45025, 45487, 45951, 46418, 46888, 47360, 47835, 48313, 48793,
+    49275, 49761, 50249, 50739, 51232, 51728, 52226, 52727, 53230, 53736, 54245, 54756, 55270, 55787, 56306, 56828,
+    57352, 57879, 58409, 58941, 59476, 60014, 60554, 61097, 61642, 62190, 62741, 63295, 63851, 64410, 64971, 65535
+};
+
+/**
+ * @brief Estado de um canal do motor de fade.
+ */
+typedef struct
+{
+    uint gpio;          /**< Pino do canal */
+    int32_t level_q16;  /**< Nível perceptual atual (0 a 255) em Q16 */
+    int32_t step_q16;   /**< Incremento por tick em Q16 */
+    uint8_t target;     /**< Nível perceptual alvo */
+    int16_t written;    /**< Último índice da tabela escrito no CC (-1 força a escrita) */
+} rgb_fade_channel_t;
+
+/**
+ * @brief Tabela gama na escala do wrap dos LEDs (nível perceptual -> CC).
+ */
+static uint16_t rgb_fade_lut[256];
+
+/**
+ * @brief Canais vermelho, verde e azul do motor de fade.
+ */
+static rgb_fade_channel_t rgb_fade_channels[3];
+
+/**
+ * @brief Ticks restantes da transição atual (0 = parado).
+ */
+static volatile uint32_t rgb_fade_ticks_left = 0;
 
 /** 
  * @brief Calcula o valor de intensidade para o LED com base na porcentagem fornecida.
@@ -23,6 +73,44 @@ static uint16_t calculate_led_intensity_value(uint8_t intensity)
     return (uint16_t) ((MAX_LED_INTENSITY * intensity) / 100u);
 }
 
+/**
+ * @brief Troca de relógio: refaz o divisor dos LEDs para manter a frequência do PWM.
+ *
+ * O wrap (e com ele os níveis já escritos) não muda, então o brilho é o mesmo;
+ * abaixo do divisor mínimo (1,0) o PWM só fica mais lento.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio do sistema.
+ * @param user LEDs inicializados por `rgb_init_all`.
+ */
+static void rgb_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    const rgb_t *rgb = (const rgb_t *) user;
+    if (event != CLOCKMGR_POST_CHANGE) return;
+
+    uint64_t counts_16 = (uint64_t) rgb->pwm_hz * ((uint32_t) rgb->wrap + 1u);
+    uint32_t div_16 = (uint32_t) (((uint64_t) sys_hz * 16u + counts_16 / 2) / counts_16);
+    if (div_16 < 16) div_16 = 16;
+    else if (div_16 > 0xFFF) div_16 = 0xFFF;
+    hal_pwm_set_divider_wrap(rgb->red, (uint16_t) div_16, rgb->wrap);
+    hal_pwm_set_divider_wrap(rgb->green, (uint16_t) div_16, rgb->wrap);
+    hal_pwm_set_divider_wrap(rgb->blue, (uint16_t) div_16, rgb->wrap);
+}
+
+/**
+ * @brief Troca de relógio: refaz o divisor do tick do fade.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio (não usado; o divisor é lido da HAL).
+ * @param user Não utilizado.
+ */
+static void rgb_fade_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    (void) sys_hz;
+    (void) user;
+    if (event == CLOCKMGR_POST_CHANGE) hal_pwm_tick_set_rate(RGB_FADE_TICK_SLICE, RGB_FADE_TICK_HZ);
+}
+
 /** 
  * @brief Inicializa os pinos GPIO para controlar os LEDs RGB com PWM.
  * 
@@ -33,37 +121,19 @@ static uint16_t calculate_led_intensity_value(uint8_t intensity)
  */
 void rgb_init_all(rgb_t *rgb, uint8_t red, uint8_t green, uint8_t blue, float clkdiv, uint16_t wrap)
 {
-    uint slice_r, slice_g, slice_b;
-    
-    // Configura os pinos dos LEDs como pinos PWM
-    gpio_set_function(red, GPIO_FUNC_PWM);
-    gpio_set_function(green, GPIO_FUNC_PWM);
-    gpio_set_function(blue, GPIO_FUNC_PWM);
-
-    // Obtém o número do "slice" para cada pino
-    slice_r = pwm_gpio_to_slice_num(red);
-    slice_g = pwm_gpio_to_slice_num(green);
-    slice_b = pwm_gpio_to_slice_num(blue);
-
-    pwm_set_clkdiv(slice_r, clkdiv);
-    pwm_set_clkdiv(slice_g, clkdiv);
-    pwm_set_clkdiv(slice_b, clkdiv);
-    
-    pwm_set_wrap(slice_r, wrap);
-    pwm_set_wrap(slice_g, wrap);
-    pwm_set_wrap(slice_b, wrap);
-
-    pwm_set_gpio_level(red, 0);
-    pwm_set_gpio_level(green, 0);
-    pwm_set_gpio_level(blue, 0);
+    uint16_t div_16 = (uint16_t) (clkdiv * 16.0f); // Divisor em ponto fixo 8.4
 
-    pwm_set_enabled(slice_r, true);
-    pwm_set_enabled(slice_g, true);
-    pwm_set_enabled(slice_b, true);
+    // Configura os pinos dos LEDs como pinos PWM, apagados
+    hal_pwm_gpio_init(red, div_16, wrap);
+    hal_pwm_gpio_init(green, div_16, wrap);
+    hal_pwm_gpio_init(blue, div_16, wrap);
 
     rgb->red = red;
     rgb->green = green;
     rgb->blue = blue;
+    rgb->wrap = wrap;
+    rgb->pwm_hz = (uint32_t) (((uint64_t) hal_clock_sys_hz() * 16u) / ((uint64_t) div_16 * ((uint32_t) wrap + 1u)));
+    clockmgr_register(rgb_clock_changed, rgb);
 }
 
 /** 
@@ -78,7 +148,7 @@ void rgb_init_all(rgb_t *rgb, uint8_t red, uint8_t green, uint8_t blue, float cl
 void rgb_turn_on_red(const rgb_t *pins, uint8_t intensity)
 {
     //uint16_t led_intensity = calculate_led_intensity_value(intensity); // Calcula a intensidade do LED
-    pwm_set_gpio_level(pins->red, intensity); // Acende o LED vermelho com a intensidade calculada
+    hal_pwm_set_level(pins->red, intensity); // Acende o LED vermelho com a intensidade calculada
 }
 
 /** 
@@ -90,7 +160,7 @@ void rgb_turn_on_red(const rgb_t *pins, uint8_t intensity)
  */
 void rgb_turn_off_red(const rgb_t *pins)
 {
-    pwm_set_gpio_level(pins->red, 0); // Desliga o LED vermelho
+    hal_pwm_set_level(pins->red, 0); // Desliga o LED vermelho
 }
 
 /** 
@@ -105,7 +175,7 @@ void rgb_turn_off_red(const rgb_t *pins)
 void rgb_turn_on_green(const rgb_t *pins, uint8_t intensity)
 {
     //uint16_t led_intensity = calculate_led_intensity_value(intensity); // Calcula a intensidade do LED
-    pwm_set_gpio_level(pins->green, intensity); // Acende o LED verde com a intensidade calculada
+    hal_pwm_set_level(pins->green, intensity); // Acende o LED verde com a intensidade calculada
 }
 
 /** 
@@ -117,7 +187,7 @@ void rgb_turn_on_green(const rgb_t *pins, uint8_t intensity)
  */
 void rgb_turn_off_green(const rgb_t *pins)
 {
-    pwm_set_gpio_level(pins->green, 0); // Desliga o LED verde
+    hal_pwm_set_level(pins->green, 0); // Desliga o LED verde
 }
 
 /** 
@@ -132,7 +202,7 @@ void rgb_turn_off_green(const rgb_t *pins)
 void rgb_turn_on_blue(const rgb_t *pins, uint8_t intensity)
 {
     //uint16_t led_intensity = calculate_led_intensity_value(intensity); // Calcula a intensidade do LED
-    pwm_set_gpio_level(pins->blue, intensity); // Acende o LED azul
+    hal_pwm_set_level(pins->blue, intensity); // Acende o LED azul
 }
 
 /** 
@@ -144,7 +214,7 @@ void rgb_turn_on_blue(const rgb_t *pins, uint8_t intensity)
  */
 void rgb_turn_off_blue(const rgb_t *pins)
 {
-    pwm_set_gpio_level(pins->blue, 0); // Desliga o LED azul
+    hal_pwm_set_level(pins->blue, 0); // Desliga o LED azul
 }
 
 /** 
@@ -158,9 +228,9 @@ void rgb_turn_off_blue(const rgb_t *pins)
  */
 void rgb_turn_on_white(const rgb_t *pins, uint8_t intensity) {
     uint16_t led_intensity = calculate_led_intensity_value(intensity / 3u); // Calcula a intensidade para branco
-    pwm_set_gpio_level(pins->red, led_intensity);   // Acende o LED vermelho para o branco
-    pwm_set_gpio_level(pins->green, led_intensity); // Acende o LED verde para o branco
-    pwm_set_gpio_level(pins->blue, led_intensity);  // Acende o LED azul para o branco
+    hal_pwm_set_level(pins->red, led_intensity);   // Acende o LED vermelho para o branco
+    hal_pwm_set_level(pins->green, led_intensity); // Acende o LED verde para o branco
+    hal_pwm_set_level(pins->blue, led_intensity);  // Acende o LED azul para o branco
 }
 
 /** 
@@ -171,18 +241,141 @@ void rgb_turn_on_white(const rgb_t *pins, uint8_t intensity) {
  * @param pins Ponteiro para a estrutura contendo os pinos GPIO dos LEDs.
  */
 void rgb_turn_off_white(const rgb_t *pins) {
-    pwm_set_gpio_level(pins->red, 0);   // Desliga o LED vermelho
-    pwm_set_gpio_level(pins->green, 0); // Desliga o LED verde
-    pwm_set_gpio_level(pins->blue, 0);  // Desliga o LED azul
+    hal_pwm_set_level(pins->red, 0);   // Desliga o LED vermelho
+    hal_pwm_set_level(pins->green, 0); // Desliga o LED verde
+    hal_pwm_set_level(pins->blue, 0);  // Desliga o LED azul
 }
 
 void turn_off_led_by_gpio(uint8_t pin)
 {
-    pwm_set_gpio_level(pin, 0);
+    hal_pwm_set_level(pin, 0);
 }
 
 void rgb_turn_on_by_gpio(uint8_t pin, uint8_t intensity)
 {
     uint16_t led_intensity = calculate_led_intensity_value(intensity);
-    pwm_set_gpio_level(pin, led_intensity);
-}
\ No newline at end of file
+    hal_pwm_set_level(pin, led_intensity);
+}
+
+/**
+ * @brief Escreve no CC o nível do canal, se ele mudou desde a última escrita.
+ *
+ * @param ch Canal a atualizar.
+ */
+static void rgb_fade_write_channel(rgb_fade_channel_t *ch)
+{
+    int16_t index = (int16_t) (ch->level_q16 >> 16);
+    if (index == ch->written) return;
+    ch->written = index;
+    hal_pwm_set_level(ch->gpio, rgb_fade_lut[index]);
+}
+
+/**
+ * @brief Interrupção de wrap do slice de tick: avança todos os canais um passo.
+ */
+static void rgb_fade_irq_handler(void)
+{
+    uint32_t ticks_left = rgb_fade_ticks_left;
+    if (ticks_left == 0) return; // Tick atrasado de um fade já encerrado
+    uint32_t isr_start = work_isr_begin();
+    ticks_left--;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        rgb_fade_channel_t *ch = &rgb_fade_channels[i];
+        // O último passo cai exatamente no alvo, sem acúmulo de erro de arredondamento
+        ch->level_q16 = ticks_left ? ch->level_q16 + ch->step_q16 : (int32_t) ch->target << 16;
+        rgb_fade_write_channel(ch);
+    }
+
+    rgb_fade_ticks_left = ticks_left;
+    if (ticks_left == 0) hal_pwm_tick_set_enabled(RGB_FADE_TICK_SLICE, false); // Sem trabalho até o próximo fade
+    work_isr_end(isr_start);
+}
+
+/**
+ * @brief Inicializa o motor de transições de cor (fade) do LED RGB.
+ *
+ * @param rgb Estrutura inicializada por `rgb_init_all`.
+ */
+void rgb_fade_init(const rgb_t *rgb)
+{
+    uint16_t i;
+    uint32_t top = (uint32_t) rgb->wrap + 1u;
+
+    for (i = 0; i < 256; i++) rgb_fade_lut[i] = (uint16_t) (((uint32_t) RGB_GAMMA_Q16[i] * top + 32768u) >> 16);
+
+    rgb_fade_channels[0].gpio = rgb->red;
+    rgb_fade_channels[1].gpio = rgb->green;
+    rgb_fade_channels[2].gpio = rgb->blue;
+    for (i = 0; i < 3; i++)
+    {
+        rgb_fade_channels[i].level_q16 = 0;
+        rgb_fade_channels[i].step_q16 = 0;
+        rgb_fade_channels[i].target = 0;
+        rgb_fade_channels[i].written = -1;
+    }
+
+    hal_pwm_tick_init(RGB_FADE_TICK_SLICE, RGB_FADE_TICK_HZ, rgb_fade_irq_handler);
+    clockmgr_register(rgb_fade_clock_changed, NULL);
+}
+
+/**
+ * @brief Inicia uma transição da cor atual até a cor alvo.
+ *
+ * @param red Nível alvo do vermelho (0 a 255).
+ * @param green Nível alvo do verde (0 a 255).
+ * @param blue Nível alvo do azul (0 a 255).
+ * @param duration_ms Duração da transição; 0 aplica a cor imediatamente.
+ */
+void rgb_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms)
+{
+    uint8_t targets[3] = { red, green, blue };
+    uint32_t ticks = ((uint32_t) duration_ms * RGB_FADE_TICK_HZ) / 1000u;
+
+    // Para o tick enquanto o estado é reescrito; a cor intermediária atual vira o ponto de partida
+    hal_pwm_tick_set_enabled(RGB_FADE_TICK_SLICE, false);
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        rgb_fade_channel_t *ch = &rgb_fade_channels[i];
+        ch->target = targets[i];
+        if (ticks == 0)
+        {
+            ch->level_q16 = (int32_t) targets[i] << 16;
+            rgb_fade_write_channel(ch);
+        }
+        else
+        {
+            ch->step_q16 = (((int32_t) targets[i] << 16) - ch->level_q16) / (int32_t) ticks;
+        }
+    }
+
+    rgb_fade_ticks_left = ticks;
+    if (ticks)
+    {
+        hal_pwm_tick_set_enabled(RGB_FADE_TICK_SLICE, true);
+    }
+}
+
+/**
+ * @brief Aplica uma cor imediatamente, cancelando qualquer transição.
+ *
+ * @param red Nível do vermelho (0 a 255).
+ * @param green Nível do verde (0 a 255).
+ * @param blue Nível do azul (0 a 255).
+ */
+void rgb_set_color(uint8_t red, uint8_t green, uint8_t blue)
+{
+    rgb_fade_to(red, green, blue, 0);
+}
+
+/**
+ * @brief Informa se há uma transição em andamento.
+ *
+ * @return `true` enquanto a cor atual não atingiu o alvo.
+ */
+bool rgb_fade_is_active(void)
+{
+    return rgb_fade_ticks_left != 0;
+}
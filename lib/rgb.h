@@ -9,7 +9,7 @@
 #define WHITE       5             /**< Define a cor branca para os LEDs */
 #define BLUE_MARINE 6             /**< Define a cor azul-marinho para os LEDs */
 
-#include "pico/stdlib.h"
+#include "hal.h"
 
 /** 
  * @file rgb.h
@@ -27,11 +27,27 @@
  */
 
 
+/**
+ * @brief Frequência do tick do motor de transições (fade), em Hz.
+ */
+#define RGB_FADE_TICK_HZ 500u
+
+/**
+ * @brief Slice de PWM, sem pinos em uso como PWM, que gera o tick do fade.
+ *
+ * Os pinos do slice 7 (GPIO 14 e 15) são usados pelo I2C do display; o
+ * contador do slice continua disponível e sua interrupção de wrap serve
+ * de base de tempo.
+ */
+#define RGB_FADE_TICK_SLICE 7u
+
 typedef struct
 {
     uint red;    /**< Pino do LED vermelho */
     uint green;  /**< Pino do LED verde */
     uint blue;   /**< Pino do LED azul */
+    uint16_t wrap; /**< Valor de wrap dos slices PWM dos LEDs */
+    uint32_t pwm_hz; /**< Frequência do PWM dos LEDs, mantida nas trocas de relógio */
 } rgb_t;
 
 
@@ -110,6 +126,53 @@ void rgb_turn_on_white(const rgb_t *pins, uint8_t intensity);
  */
 void rgb_turn_off_white(const rgb_t *pins);
 
+/**
+ * @brief Inicializa o motor de transições de cor (fade) do LED RGB.
+ *
+ * Monta a tabela de correção gama (256 níveis) na escala do wrap dos LEDs e
+ * configura o slice `RGB_FADE_TICK_SLICE` para interromper a cada
+ * 1/`RGB_FADE_TICK_HZ` s. A cada tick, a interrupção avança a cor atual em
+ * direção ao alvo e escreve os registradores CC; quando a transição termina,
+ * a interrupção é desligada até o próximo `rgb_fade_to`.
+ *
+ * @note O canal verde divide o slice 5 com o buzzer A. Escritas de nível no
+ *       outro canal do slice feitas pelo laço principal durante um fade podem
+ *       sobrescrever um passo intermediário, que é corrigido no tick seguinte.
+ *
+ * @param rgb Estrutura inicializada por `rgb_init_all`.
+ */
+void rgb_fade_init(const rgb_t *rgb);
+
+/**
+ * @brief Inicia uma transição da cor atual até a cor alvo.
+ *
+ * Os níveis são perceptuais (0 a 255) e passam pela tabela gama antes de ir
+ * ao PWM. Uma nova chamada durante uma transição parte da cor intermediária
+ * atual, sem saltos.
+ *
+ * @param red Nível alvo do vermelho (0 a 255).
+ * @param green Nível alvo do verde (0 a 255).
+ * @param blue Nível alvo do azul (0 a 255).
+ * @param duration_ms Duração da transição; 0 aplica a cor imediatamente.
+ */
+void rgb_fade_to(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms);
+
+/**
+ * @brief Aplica uma cor imediatamente, cancelando qualquer transição.
+ *
+ * @param red Nível do vermelho (0 a 255).
+ * @param green Nível do verde (0 a 255).
+ * @param blue Nível do azul (0 a 255).
+ */
+void rgb_set_color(uint8_t red, uint8_t green, uint8_t blue);
+
+/**
+ * @brief Informa se há uma transição em andamento.
+ *
+ * @return `true` enquanto a cor atual não atingiu o alvo.
+ */
+bool rgb_fade_is_active(void);
+
 void turn_off_led_by_gpio(uint8_t pin);
 
 void rgb_turn_on_by_gpio(uint8_t pin, uint8_t intensity);
@@ -0,0 +1,53 @@
+#include "serial_tx.h"
+#include "hal.h"
+
+/**
+ * @file serial_tx.c
+ * @brief Ring de bytes com entrada por quadros inteiros e um único escritor da serial.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+_Static_assert((SERIAL_TX_RING_BYTES & (SERIAL_TX_RING_BYTES - 1)) == 0, "SERIAL_TX_RING_BYTES precisa ser potência de 2");
+
+static uint8_t ring[SERIAL_TX_RING_BYTES];
+static uint32_t ring_head, ring_tail; // Contadores livres; índice = contador % SERIAL_TX_RING_BYTES
+
+bool serial_tx_frame(const uint8_t *frame, size_t length)
+{
+    if (length > SERIAL_TX_RING_BYTES - (ring_head - ring_tail)) return false;
+    for (size_t i = 0; i < length; i++) ring[(ring_head + i) % SERIAL_TX_RING_BYTES] = frame[i];
+    ring_head += (uint32_t) length;
+    return true;
+}
+
+void serial_tx_drain(void)
+{
+    while (ring_head != ring_tail)
+    {
+        // Trecho contíguo até o fim do ring; a volta fica para a próxima iteração
+        uint32_t start = ring_tail % SERIAL_TX_RING_BYTES;
+        uint32_t length = ring_head - ring_tail;
+        if (length > SERIAL_TX_RING_BYTES - start) length = SERIAL_TX_RING_BYTES - start;
+        size_t n = hal_serial_try_write(ring + start, length);
+        if (n == 0) return; // Transmissão cheia: continua na próxima chamada
+        ring_tail += (uint32_t) n;
+    }
+}
+
+size_t serial_tx_pending(void) { return ring_head - ring_tail; }
+
+bool serial_tx_flush(uint32_t timeout_ms)
+{
+    for (uint32_t waited = 0;; waited++)
+    {
+        serial_tx_drain();
+        if (ring_head == ring_tail) return true;
+        if (waited >= timeout_ms) return false;
+        hal_sleep_ms(1);
+    }
+}
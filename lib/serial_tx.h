@@ -0,0 +1,77 @@
+#ifndef SERIAL_TX_H
+#define SERIAL_TX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file serial_tx.h
+ * @brief Fila de transmissão única da serial, com quadros sempre inteiros.
+ *
+ * A telemetria e o registro tokenizado dividem o mesmo enlace. Como
+ * `hal_serial_try_write` aceita só o que cabe no momento, dois produtores que
+ * escrevessem cada um a sua parte intercalariam um quadro no meio do outro, e
+ * o decodificador perderia os dois. Por isso os produtores só entregam
+ * quadros inteiros a esta fila (`serial_tx_frame`, tudo ou nada), e apenas
+ * `serial_tx_drain` escreve na serial: o corte de um envio parcial cai sempre
+ * dentro de um único fluxo de bytes, na ordem em que os quadros entraram.
+ *
+ * Quem escreve direto na serial (os despejos binários do perfilador e da
+ * gravação) chama antes `serial_tx_flush`, para não cortar um quadro já
+ * começado.
+ *
+ * Só o laço principal do núcleo 0 usa a fila.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup SerialTx Transmissão serial
+ * @{
+ */
+
+/**
+ * @def SERIAL_TX_RING_BYTES
+ * @brief Capacidade da fila em bytes (potência de 2).
+ */
+#define SERIAL_TX_RING_BYTES 1024
+
+/**
+ * @brief Coloca um quadro inteiro na fila, ou nada dele.
+ *
+ * @param frame Bytes do quadro.
+ * @param length Tamanho, até `SERIAL_TX_RING_BYTES`.
+ * @return `false` se o quadro não couber agora (o produtor tenta de novo depois).
+ */
+bool serial_tx_frame(const uint8_t *frame, size_t length);
+
+/**
+ * @brief Passa à serial o que couber agora, sem esperar.
+ */
+void serial_tx_drain(void);
+
+/**
+ * @brief Bytes ainda na fila.
+ *
+ * @return Bytes pendentes.
+ */
+size_t serial_tx_pending(void);
+
+/**
+ * @brief Espera a fila esvaziar, dormindo entre as tentativas.
+ *
+ * @param timeout_ms Espera máxima.
+ * @return `false` se o computador não leu tudo a tempo (a fila continua com o restante).
+ */
+bool serial_tx_flush(uint32_t timeout_ms);
+
+/** @} */ // Fim do grupo "SerialTx"
+
+#endif // SERIAL_TX_H
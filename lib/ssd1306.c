@@ -1,7 +1,8 @@
 #include "ssd1306.h"
 #include "font.h"
+#include <string.h>
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, hal_i2c_t *i2c) {
   ssd->width = width;
   ssd->height = height;
   ssd->pages = height / 8U;
@@ -11,6 +12,12 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
   ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
+  ssd->start_line = 0;
+  ssd->sent_start_line = 0;
+  ssd->orientation = SSD1306_ROTATE_0;
+  ssd->panel_buffer = NULL;
+  ssd->gray_bits = 0;
+  ssd->gray_planes = NULL;
 }
 
 void ssd1306_config(ssd1306_t *ssd) {
@@ -43,33 +50,276 @@ void ssd1306_config(ssd1306_t *ssd) {
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   ssd->port_buffer[1] = command;
-  i2c_write_blocking(
+  hal_i2c_write(
     ssd->i2c_port,
     ssd->address,
     ssd->port_buffer,
-    2,
-    false
+    2
   );
 }
 
+// Janela de escrita em uma só transação: com o controle 0x00, todos os bytes
+// seguintes são comandos, em vez de uma transação (0x80, comando) para cada um
+static void ssd1306_window(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+  const uint8_t commands[] = { 0x00, SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, p0, p1 };
+  hal_i2c_write(ssd->i2c_port, ssd->address, commands, sizeof commands);
+}
+
 void ssd1306_send_data(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_COL_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
-  ssd1306_command(ssd, SET_PAGE_ADDR);
-  ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
-  i2c_write_blocking(
+  const uint8_t *frame = ssd->ram_buffer;
+  uint8_t columns = ssd->width, pages = ssd->pages;
+
+  if (ssd->orientation & SSD1306_TRANSPOSE) {
+    ssd1306_to_panel(ssd, ssd->panel_buffer);
+    frame = ssd->panel_buffer;
+    columns = ssd->height;
+    pages = ssd->width / 8U;
+  }
+  ssd1306_window(ssd, 0, columns - 1, 0, pages - 1);
+  hal_i2c_write(
+    ssd->i2c_port,
+    ssd->address,
+    frame,
+    ssd->bufsize
+  );
+  // Depois dos dados, para que a nova rolagem apareça junto com o quadro que a usa
+  if (ssd->start_line != ssd->sent_start_line) {
+    ssd1306_command(ssd, SET_DISP_START_LINE | ssd->start_line);
+    ssd->sent_start_line = ssd->start_line;
+  }
+}
+
+// Envia só as colunas x0..x1: com endereçamento vertical elas são contíguas no
+// buffer, e o byte anterior à primeira leva o controle 0x40 durante o envio.
+// Transpostas, as colunas do quadro viram linhas do painel: vai o quadro inteiro
+void ssd1306_send_columns(ssd1306_t *ssd, uint8_t x0, uint8_t x1) {
+  if (ssd->orientation & SSD1306_TRANSPOSE) {
+    ssd1306_send_data(ssd);
+    return;
+  }
+  uint8_t *start = ssd->ram_buffer + (size_t) x0 * ssd->pages;
+  uint8_t saved = *start;
+
+  ssd1306_window(ssd, x0, x1, 0, ssd->pages - 1);
+  *start = 0x40;
+  hal_i2c_write(
     ssd->i2c_port,
     ssd->address,
-    ssd->ram_buffer,
-    ssd->bufsize,
-    false
+    start,
+    (size_t) (x1 - x0 + 1) * ssd->pages + 1
   );
+  *start = saved;
+}
+
+// Muda a orientação e o tamanho lógico do quadro (largura e altura trocam com
+// a transposição). O conteúdo do ram_buffer não é convertido: redesenhe e
+// envie o quadro inteiro, pois o remapeamento de segmentos só vale para os
+// dados escritos depois dele. Com transposição, a rolagem por start_line fica
+// desligada: ela desloca linhas do painel, que seriam colunas do quadro
+void ssd1306_set_orientation(ssd1306_t *ssd, uint8_t orientation) {
+  if ((orientation ^ ssd->orientation) & SSD1306_TRANSPOSE) {
+    uint8_t width = ssd->width;
+    ssd->width = ssd->height;
+    ssd->height = width;
+    ssd->pages = ssd->height / 8U;
+  }
+  if ((orientation & SSD1306_TRANSPOSE) && ssd->panel_buffer == NULL) {
+    ssd->panel_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+    ssd->panel_buffer[0] = 0x40;
+  }
+  if (orientation & SSD1306_TRANSPOSE)
+    ssd->start_line = 0;
+  ssd->orientation = orientation;
+
+  // A montagem padrão (ssd1306_config) já usa os dois remapeamentos
+  ssd1306_command(ssd, SET_SEG_REMAP | ((orientation & SSD1306_MIRROR_X) ? 0x00 : 0x01));
+  ssd1306_command(ssd, SET_COM_OUT_DIR | ((orientation & SSD1306_MIRROR_Y) ? 0x00 : 0x08));
+}
+
+// Transpõe um bloco de 8x8 bits guardado em duas palavras (bytes 0..3 em lo,
+// 4..7 em hi, o byte i nos bits 8i..8i+7): o bit j do byte i vai para o bit i
+// do byte j. São três trocas em paralelo (SWAR), de blocos de 1x1, 2x2 e 4x4
+// bits pela diagonal; só a última cruza as duas palavras
+static inline void ssd1306_transpose8(uint32_t *lo, uint32_t *hi) {
+  uint32_t a = *lo, b = *hi, t;
+
+  t = (a ^ (a >> 7)) & 0x00AA00AAu;
+  a ^= t ^ (t << 7);
+  t = (b ^ (b >> 7)) & 0x00AA00AAu;
+  b ^= t ^ (t << 7);
+  t = (a ^ (a >> 14)) & 0x0000CCCCu;
+  a ^= t ^ (t << 14);
+  t = (b ^ (b >> 14)) & 0x0000CCCCu;
+  b ^= t ^ (t << 14);
+  t = (a ^ (b << 4)) & 0xF0F0F0F0u;
+  a ^= t;
+  b ^= t >> 4;
+  *lo = a;
+  *hi = b;
+}
+
+// Monta em panel (bufsize bytes, com o 0x40 em panel[0]) o quadro transposto,
+// na ordem de endereçamento vertical do painel. As colunas 8p..8p+7 do quadro,
+// na página q, formam um bloco de 8x8 que vira a página p das colunas
+// 8q..8q+7 do painel: um bloco por vez, lido e escrito com passo de coluna
+void ssd1306_to_panel(const ssd1306_t *ssd, uint8_t *panel) {
+  uint8_t frame_pages = ssd->pages, panel_pages = ssd->width / 8U;
+
+  for (uint8_t p = 0; p < panel_pages; p++) {
+    const uint8_t *src = ssd->ram_buffer + 1 + (size_t) p * 8U * frame_pages;
+    for (uint8_t q = 0; q < frame_pages; q++, src++) {
+      uint32_t lo = src[0] | (uint32_t) src[frame_pages] << 8 |
+                    (uint32_t) src[2 * frame_pages] << 16 | (uint32_t) src[3 * frame_pages] << 24;
+      uint32_t hi = src[4 * frame_pages] | (uint32_t) src[5 * frame_pages] << 8 |
+                    (uint32_t) src[6 * frame_pages] << 16 | (uint32_t) src[7 * frame_pages] << 24;
+      ssd1306_transpose8(&lo, &hi);
+
+      uint8_t *dst = panel + 1 + (size_t) q * 8U * panel_pages + p;
+      for (uint8_t j = 0; j < 4; j++, lo >>= 8, hi >>= 8) {
+        dst[j * panel_pages] = (uint8_t) lo;
+        dst[(j + 4) * panel_pages] = (uint8_t) hi;
+      }
+    }
+  }
+}
+
+// Percorre os grupos de colunas alteradas somando os bytes de fio das janelas
+// e, com send, as envia e atualiza shown. dirty tem, por coluna, uma máscara
+// das páginas alteradas. Um grupo junta as colunas seguidas com a mesma
+// máscara M (atravessando até SSD1306_DELTA_MAX_GAP colunas sem alterações);
+// cada sequência de páginas de M é uma janela
+static size_t ssd1306_delta_pass(ssd1306_t *ssd, const uint8_t *dirty, uint8_t *shown, const uint8_t *next, bool send) {
+  static uint8_t window[WIDTH * HEIGHT / 8 + 1]; // Bytes da janela, reunidos coluna a coluna
+  uint8_t pages = ssd->pages;
+  size_t cost = 0;
+  uint8_t x = 0;
+
+  while (x < ssd->width) {
+    uint8_t mask = dirty[x];
+    if (mask == 0) {
+      x++;
+      continue;
+    }
+    uint8_t x0 = x, x1 = x;
+    for (uint8_t c = x + 1, gap = 0; c < ssd->width && (dirty[c] == mask || dirty[c] == 0); c++) {
+      if (dirty[c]) {
+        x1 = c;
+        gap = 0;
+      } else if (++gap > SSD1306_DELTA_MAX_GAP) {
+        break;
+      }
+    }
+    x = x1 + 1;
+
+    for (uint8_t p0 = 0; p0 < pages; p0++) {
+      if (!((mask >> p0) & 1))
+        continue;
+      uint8_t p1 = p0;
+      while (p1 + 1 < pages && ((mask >> (p1 + 1)) & 1))
+        p1++;
+      uint8_t rows = p1 - p0 + 1;
+      cost += SSD1306_DELTA_WINDOW_COST + (size_t) (x1 - x0 + 1) * rows;
+
+      if (send) {
+        uint8_t *out = window + 1;
+        window[0] = 0x40;
+        for (uint8_t c = x0; c <= x1; c++, out += rows) {
+          memcpy(out, next + 1 + c * pages + p0, rows);
+          memcpy(shown + 1 + c * pages + p0, out, rows);
+        }
+        ssd1306_window(ssd, x0, x1, p0, p1);
+        hal_i2c_write(ssd->i2c_port, ssd->address, window, (size_t) (out - window));
+      }
+      p0 = p1;
+    }
+  }
+  return cost;
 }
 
+// Envia só o que mudou de shown para next (quadros de bufsize bytes, com o 0x40
+// no byte 0) e atualiza shown. As janelas são planejadas antes: se custarem
+// mais que o quadro inteiro, vai o quadro inteiro. Devolve os bytes de fio
+// (dados e janelas). Sem transposição e com até 8 páginas
+size_t ssd1306_send_delta(ssd1306_t *ssd, uint8_t *shown, const uint8_t *next) {
+  uint8_t dirty[WIDTH];
+  uint8_t pages = ssd->pages;
+  size_t full = ssd->bufsize + SSD1306_DELTA_WINDOW_COST;
+  size_t cost;
+
+  for (uint8_t x = 0; x < ssd->width; x++) {
+    const uint8_t *have = shown + 1 + x * pages, *want = next + 1 + x * pages;
+    dirty[x] = 0;
+    for (uint8_t p = 0; p < pages; p++)
+      if (have[p] != want[p])
+        dirty[x] |= (uint8_t) (1 << p);
+  }
+
+  cost = ssd1306_delta_pass(ssd, dirty, shown, next, false);
+  if (cost >= full) {
+    ssd1306_window(ssd, 0, ssd->width - 1, 0, pages - 1);
+    hal_i2c_write(ssd->i2c_port, ssd->address, next, ssd->bufsize);
+    memcpy(shown + 1, next + 1, ssd->bufsize - 1);
+    cost = full;
+  } else if (cost > 0) {
+    ssd1306_delta_pass(ssd, dirty, shown, next, true);
+  }
+  if (ssd->start_line != ssd->sent_start_line) {
+    ssd1306_command(ssd, SET_DISP_START_LINE | ssd->start_line);
+    ssd->sent_start_line = ssd->start_line;
+  }
+  return cost;
+}
+
+// Liga o modo em tons de cinza com 1 a SSD1306_GRAY_MAX_BITS planos (todos
+// apagados) ou o desliga com 0. Os planos usam as linhas da RAM: a rolagem por
+// start_line volta a 0. Não vale com a transposição (nem com mais de 8 páginas)
+bool ssd1306_gray_init(ssd1306_t *ssd, uint8_t bits) {
+  free(ssd->gray_planes);
+  ssd->gray_planes = NULL;
+  ssd->gray_bits = 0;
+  if (bits == 0)
+    return true;
+  if (bits > SSD1306_GRAY_MAX_BITS || ssd->pages > 8 || (ssd->orientation & SSD1306_TRANSPOSE))
+    return false;
+
+  ssd->gray_planes = calloc((size_t) bits * ssd->bufsize, sizeof(uint8_t));
+  if (ssd->gray_planes == NULL)
+    return false;
+  ssd->gray_bits = bits;
+  for (uint8_t k = 0; k < bits; k++)
+    ssd1306_gray_plane(ssd, k)[0] = 0x40;
+  ssd->start_line = 0;
+  return true;
+}
+
+// level vai de 0 (apagado) a 2^gray_bits - 1 (aceso o tempo todo)
+void ssd1306_gray_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, uint8_t level) {
+  uint16_t index = (y >> 3) + x * ssd->pages + 1;
+  uint8_t mask = (uint8_t) (1 << (y & 0b111));
+  for (uint8_t k = 0; k < ssd->gray_bits; k++, level >>= 1) {
+    uint8_t *plane = ssd1306_gray_plane(ssd, k);
+    if (level & 1)
+      plane[index] |= mask;
+    else
+      plane[index] &= (uint8_t) ~mask;
+  }
+}
+
+// Copia o ram_buffer para os planos: pixels acesos ficam com o nível level, apagados com 0
+void ssd1306_gray_from_mono(ssd1306_t *ssd, uint8_t level) {
+  for (uint8_t k = 0; k < ssd->gray_bits; k++) {
+    uint8_t *plane = ssd1306_gray_plane(ssd, k);
+    if ((level >> k) & 1)
+      memcpy(plane + 1, ssd->ram_buffer + 1, ssd->bufsize - 1);
+    else
+      memset(plane + 1, 0, ssd->bufsize - 1);
+  }
+}
+
+// y é a linha na tela: com a linha inicial deslocada, ela fica na linha y + start_line da RAM
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
-  uint16_t index = (y >> 3) + (x << 3) + 1;
+  y = (uint8_t) ((y + ssd->start_line) & (ssd->height - 1));
+  uint16_t index = (y >> 3) + x * ssd->pages + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
@@ -153,11 +403,10 @@ void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value
     ssd1306_pixel(ssd, x, y, value);
 }
 
-// Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+// Colunas (bit 0 = linha de cima) do caractere; o glifo 0 (vazio) para os não suportados
+const uint8_t *ssd1306_glyph(char c)
 {
   uint16_t index = 0;
-  char ver=c;
   if (c >= 'A' && c <= 'Z')
   {
     index = (c - 'A' + 11) * 8;
@@ -169,10 +418,17 @@ void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
   {
     index = (c - 'a' + 37) * 8;
   }
+  return &font[index];
+}
+
+// Função para desenhar um caractere
+void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+{
+  const uint8_t *glyph = ssd1306_glyph(c);
   
   for (uint8_t i = 0; i < 8; ++i)
   {
-    uint8_t line = font[index + i];
+    uint8_t line = glyph[i];
     for (uint8_t j = 0; j < 8; ++j)
     {
       ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
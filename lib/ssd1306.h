@@ -1,10 +1,16 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
-#include "pico/stdlib.h"
-#include "hardware/i2c.h"
+#include "hal.h"
 
 #define WIDTH 128
 #define HEIGHT 64
 
+#define SSD1306_GRAY_MAX_BITS 3      // Planos de bits do modo em tons de cinza (até 8 níveis)
+#define SSD1306_DELTA_MAX_GAP 2      // Colunas iguais que ainda juntam dois trechos alterados em uma janela
+#define SSD1306_DELTA_WINDOW_COST 12 // Bytes de fio de uma janela: comandos, endereço e controle dos dados
+
 typedef enum {
   SET_CONTRAST = 0x81,
   SET_ENTIRE_ON = 0xA4,
@@ -25,19 +31,51 @@ typedef enum {
   SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+// Orientação da montagem. Os espelhamentos usam o remapeamento de segmentos e
+// de COM do próprio controlador (custo zero); a transposição, que troca
+// largura e altura, é feita em software a cada envio, em blocos de 8x8 bits
+typedef enum {
+  SSD1306_MIRROR_X = 0x01,  // Colunas do painel invertidas
+  SSD1306_MIRROR_Y = 0x02,  // Linhas do painel invertidas
+  SSD1306_TRANSPOSE = 0x04, // Coluna x do quadro vira a linha x do painel
+  SSD1306_ROTATE_0 = 0x00,
+  SSD1306_ROTATE_90 = SSD1306_TRANSPOSE | SSD1306_MIRROR_X,  // Sentido horário
+  SSD1306_ROTATE_180 = SSD1306_MIRROR_X | SSD1306_MIRROR_Y,
+  SSD1306_ROTATE_270 = SSD1306_TRANSPOSE | SSD1306_MIRROR_Y
+} ssd1306_orientation_t;
+
 typedef struct {
   uint8_t width, height, pages, address;
-  i2c_inst_t *i2c_port;
+  hal_i2c_t *i2c_port;
   bool external_vcc;
   uint8_t *ram_buffer;
   size_t bufsize;
   uint8_t port_buffer[2];
+  uint8_t start_line;      // Linha da RAM mostrada no topo (rolagem vertical por hardware)
+  uint8_t sent_start_line; // Última linha inicial enviada ao display
+  uint8_t orientation;     // Combinação de ssd1306_orientation_t
+  uint8_t *panel_buffer;   // Quadro na ordem do painel, montado no envio (só com transposição)
+  uint8_t gray_bits;       // Planos do modo em tons de cinza (0 = desligado)
+  uint8_t *gray_planes;    // gray_bits quadros de bufsize bytes; o plano k vale 2^k na média
 } ssd1306_t;
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, hal_i2c_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_send_columns(ssd1306_t *ssd, uint8_t x0, uint8_t x1);
+void ssd1306_set_orientation(ssd1306_t *ssd, uint8_t orientation);
+void ssd1306_to_panel(const ssd1306_t *ssd, uint8_t *panel);
+size_t ssd1306_send_delta(ssd1306_t *ssd, uint8_t *shown, const uint8_t *next);
+
+bool ssd1306_gray_init(ssd1306_t *ssd, uint8_t bits);
+void ssd1306_gray_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, uint8_t level);
+void ssd1306_gray_from_mono(ssd1306_t *ssd, uint8_t level);
+
+// Plano k do modo em tons de cinza, no formato do ram_buffer (0x40 no byte 0)
+static inline uint8_t *ssd1306_gray_plane(const ssd1306_t *ssd, uint8_t plane) {
+  return ssd->gray_planes + (size_t) plane * ssd->bufsize;
+}
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
@@ -46,4 +84,7 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+const uint8_t *ssd1306_glyph(char c);
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+
+#endif // SSD1306_H
@@ -0,0 +1,97 @@
+#include "telemetry.h"
+#include "serial_tx.h"
+#include <string.h>
+
+/**
+ * @file telemetry.c
+ * @brief Ring de registros com descarte do mais antigo e envio não bloqueante.
+ *
+ * Um registro só sai do ring quando cabe inteiro na fila comum da serial
+ * (`serial_tx`), de modo que o descarte nunca corta um registro já começado.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+static uint8_t ring[TELEMETRY_RING_RECORDS][TELEMETRY_RECORD_BYTES];
+static uint32_t ring_head, ring_tail; // Contadores livres; índice = contador % TELEMETRY_RING_RECORDS
+
+static uint32_t period_us;
+static uint32_t last_us;
+static bool started;
+static uint8_t seq;
+static telemetry_stats_t stats;
+
+static void put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) p[i] = (uint8_t) (value >> (8 * i));
+}
+
+static uint16_t fletcher16(const uint8_t *data, size_t length)
+{
+    uint16_t a = 0, b = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        a = (uint16_t) ((a + data[i]) % 255);
+        b = (uint16_t) ((b + a) % 255);
+    }
+    return (uint16_t) ((b << 8) | a);
+}
+
+void telemetry_init(uint32_t period)
+{
+    period_us = period;
+    ring_head = ring_tail = 0;
+    started = false;
+    seq = 0;
+    memset(&stats, 0, sizeof stats);
+}
+
+bool telemetry_due(uint32_t now_us)
+{
+    return period_us && (!started || now_us - last_us >= period_us);
+}
+
+void telemetry_push(const telemetry_sample_t *sample)
+{
+    uint8_t *r;
+
+    if (ring_head - ring_tail == TELEMETRY_RING_RECORDS)
+    {
+        ring_tail++; // Computador atrasado: perde-se o mais antigo
+        stats.dropped++;
+    }
+    r = ring[ring_head % TELEMETRY_RING_RECORDS];
+
+    r[0] = TELEMETRY_SYNC0;
+    r[1] = TELEMETRY_SYNC1;
+    r[2] = TELEMETRY_VERSION;
+    r[3] = seq++;
+    put_le(r + 4, sample->time_us, 4);
+    put_le(r + 8, sample->pixels, 2);
+    r[10] = sample->cursor_x;
+    r[11] = sample->cursor_y;
+    put_le(r + 12, sample->frame_us, 2);
+    put_le(r + 14, fletcher16(r + 2, 12), 2);
+
+    ring_head++;
+    stats.records++;
+    last_us = sample->time_us;
+    started = true;
+}
+
+void telemetry_drain(void)
+{
+    // Fila cheia: o registro fica no ring (e pode ser descartado) até a próxima chamada
+    while (ring_head != ring_tail && serial_tx_frame(ring[ring_tail % TELEMETRY_RING_RECORDS], TELEMETRY_RECORD_BYTES))
+    {
+        ring_tail++;
+        stats.sent++;
+    }
+    serial_tx_drain();
+}
+
+void telemetry_get_stats(telemetry_stats_t *out) { *out = stats; }
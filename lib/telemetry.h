@@ -0,0 +1,137 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file telemetry.h
+ * @brief Telemetria binária da partida, enviada pela serial sem bloquear.
+ *
+ * A cada período (por exemplo, 10 vezes por segundo) o jogo gera um registro
+ * de tamanho fixo com o instante, os pixels restantes, a posição do cursor e
+ * o tempo de CPU do último quadro. Gerar um registro é apenas codificá-lo em
+ * um ring em RAM; `telemetry_drain` passa os registros inteiros à fila comum
+ * da serial (`serial_tx`), que envia somente o que cabe no buffer de
+ * transmissão naquele momento. Se o computador não estiver lendo, o ring
+ * enche e os registros mais antigos são descartados, de modo que o laço do
+ * jogo nunca espera pela serial.
+ *
+ * Os registros dividem a serial com as mensagens do registro; o decodificador
+ * (`tools/telemetry_decode.c`) os encontra pela marca de sincronismo e pela
+ * soma de verificação e detecta registros perdidos pela sequência.
+ *
+ * Formato (16 bytes, little-endian):
+ *     0xA5 0x5A | versão u8 | sequência u8 | instante_us u32 | pixels u16 |
+ *     cursor_x u8 | cursor_y u8 | quadro_us u16 | Fletcher-16 dos bytes 2 a 13 u16
+ *
+ * O módulo não depende do Pico SDK e é compilado também no host.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Telemetry Telemetria
+ * @brief Métricas da partida em registros binários de tamanho fixo.
+ * @{
+ */
+
+/**
+ * @def TELEMETRY_SYNC0
+ * @brief Primeiro byte de sincronismo (fora da faixa ASCII das mensagens).
+ */
+#define TELEMETRY_SYNC0 0xA5
+
+/**
+ * @def TELEMETRY_SYNC1
+ * @brief Segundo byte de sincronismo.
+ */
+#define TELEMETRY_SYNC1 0x5A
+
+/**
+ * @def TELEMETRY_VERSION
+ * @brief Versão do formato do registro.
+ */
+#define TELEMETRY_VERSION 1
+
+/**
+ * @def TELEMETRY_RECORD_BYTES
+ * @brief Tamanho de um registro.
+ */
+#define TELEMETRY_RECORD_BYTES 16
+
+/**
+ * @def TELEMETRY_RING_RECORDS
+ * @brief Registros guardados enquanto a serial não os leva (potência de 2).
+ */
+#define TELEMETRY_RING_RECORDS 32
+
+/**
+ * @brief Métricas de um instante da partida.
+ */
+typedef struct
+{
+    uint32_t time_us;     /**< Instante (relógio de microssegundos). */
+    uint16_t pixels;      /**< Pixels ainda acesos. */
+    uint8_t cursor_x;     /**< Coluna do cursor. */
+    uint8_t cursor_y;     /**< Linha do cursor. */
+    uint16_t frame_us;    /**< Tempo de CPU do último quadro. */
+} telemetry_sample_t;
+
+/**
+ * @brief Contadores do canal.
+ */
+typedef struct
+{
+    uint32_t records;     /**< Registros gerados. */
+    uint32_t sent;        /**< Registros entregues inteiros à fila da serial. */
+    uint32_t dropped;     /**< Registros descartados com o ring cheio. */
+} telemetry_stats_t;
+
+/**
+ * @brief Esvazia o ring e define o período entre registros.
+ *
+ * @param period_us Intervalo mínimo entre registros (0 desliga a telemetria).
+ */
+void telemetry_init(uint32_t period_us);
+
+/**
+ * @brief Indica se já passou o período desde o último registro.
+ *
+ * Permite ao chamador só calcular as métricas caras (como contar os pixels)
+ * quando elas serão usadas.
+ *
+ * @param now_us Instante atual.
+ * @return `true` se `telemetry_push` deve ser chamada agora.
+ */
+bool telemetry_due(uint32_t now_us);
+
+/**
+ * @brief Codifica um registro no ring, descartando o mais antigo se estiver cheio.
+ *
+ * @param sample Métricas; `time_us` também marca o início do próximo período.
+ */
+void telemetry_push(const telemetry_sample_t *sample);
+
+/**
+ * @brief Passa à fila da serial os registros que couberem inteiros e envia o que couber agora, sem esperar.
+ */
+void telemetry_drain(void);
+
+/**
+ * @brief Lê os contadores do canal.
+ *
+ * @param[out] stats Destino.
+ */
+void telemetry_get_stats(telemetry_stats_t *stats);
+
+/** @} */ // Fim do grupo "Telemetry"
+
+#endif // TELEMETRY_H
@@ -0,0 +1,204 @@
+#include "tilecanvas.h"
+#include <string.h>
+
+/**
+ * @file tilecanvas.c
+ * @brief Mapa de ladrilhos com banco deduplicado e renderização por bytes de coluna.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#define TILE_EMPTY 0
+#define TILE_FULL 1
+#define TILE_FIRST_UNIQUE 2
+
+#define ROWS_ALL 0x0101010101010101ull // Um bit em cada coluna: multiplicado por uma máscara de linhas, a repete nas 8
+
+static inline uint64_t tilecanvas_bits(const tilecanvas_t *canvas, uint8_t entry)
+{
+    if (entry == TILE_EMPTY) return 0;
+    if (entry == TILE_FULL) return ~0ull;
+    return canvas->unique[entry - TILE_FIRST_UNIQUE];
+}
+
+/**
+ * @brief Solta a referência de um valor do mapa.
+ */
+static void tilecanvas_release(tilecanvas_t *canvas, uint8_t entry)
+{
+    if (entry == TILE_FULL) canvas->full_tiles--;
+    if (entry < TILE_FIRST_UNIQUE) return;
+    if (--canvas->refs[entry - TILE_FIRST_UNIQUE] == 0) canvas->unique_used--;
+}
+
+/**
+ * @brief Valor do mapa para um ladrilho: vazio, cheio, uma entrada igual ou uma nova.
+ *
+ * Chamada depois de soltar a referência antiga, para que a entrada que ficou
+ * livre possa ser reaproveitada pelo mesmo ladrilho.
+ */
+static uint8_t tilecanvas_acquire(tilecanvas_t *canvas, uint64_t bits)
+{
+    if (bits == 0) return TILE_EMPTY;
+    if (bits == ~0ull)
+    {
+        canvas->full_tiles++;
+        return TILE_FULL;
+    }
+
+    int free_slot = -1;
+    for (uint16_t i = 0; i < canvas->unique_end; i++)
+    {
+        if (canvas->refs[i] == 0)
+        {
+            if (free_slot < 0) free_slot = i;
+        }
+        else if (canvas->unique[i] == bits)
+        {
+            canvas->refs[i]++;
+            return (uint8_t) (i + TILE_FIRST_UNIQUE);
+        }
+    }
+    if (free_slot < 0 && canvas->unique_end < TILECANVAS_UNIQUE_TILES) free_slot = canvas->unique_end++;
+
+    if (free_slot < 0)
+    {
+        canvas->overflows++;
+        return tilecanvas_acquire(canvas, __builtin_popcountll(bits) > 32 ? ~0ull : 0);
+    }
+    canvas->unique[free_slot] = bits;
+    canvas->refs[free_slot] = 1;
+    canvas->unique_used++;
+    return (uint8_t) (free_slot + TILE_FIRST_UNIQUE);
+}
+
+bool tilecanvas_init(tilecanvas_t *canvas, uint16_t width, uint16_t height)
+{
+    if ((width | height) & 7 || width < WIDTH || height < HEIGHT) return false;
+    if ((uint32_t) (width / 8) * (height / 8) > TILECANVAS_MAX_TILES) return false;
+
+    canvas->width = width;
+    canvas->height = height;
+    canvas->width_tiles = width / 8;
+    canvas->height_tiles = height / 8;
+    memset(canvas->map, TILE_EMPTY, sizeof canvas->map);
+    memset(canvas->refs, 0, sizeof canvas->refs);
+    canvas->unique_used = canvas->unique_end = canvas->full_tiles = 0;
+    canvas->overflows = 0;
+    return true;
+}
+
+void tilecanvas_put_tile(tilecanvas_t *canvas, uint16_t tx, uint16_t ty, uint64_t bits)
+{
+    if (tx >= canvas->width_tiles || ty >= canvas->height_tiles) return;
+
+    uint8_t *entry = &canvas->map[(uint32_t) ty * canvas->width_tiles + tx];
+    if (tilecanvas_bits(canvas, *entry) == bits) return; // Apagar o que já está apagado é o caso comum
+
+    // Única referência: altera a entrada no lugar, se o novo conteúdo não existir em outra
+    if (*entry >= TILE_FIRST_UNIQUE && canvas->refs[*entry - TILE_FIRST_UNIQUE] == 1 && bits != 0 && bits != ~0ull)
+    {
+        bool shared = false;
+        for (uint16_t i = 0; i < canvas->unique_end && !shared; i++) shared = canvas->refs[i] && canvas->unique[i] == bits;
+        if (!shared)
+        {
+            canvas->unique[*entry - TILE_FIRST_UNIQUE] = bits;
+            return;
+        }
+    }
+    tilecanvas_release(canvas, *entry);
+    *entry = tilecanvas_acquire(canvas, bits);
+}
+
+void tilecanvas_fill_rect(tilecanvas_t *canvas, int32_t x, int32_t y, uint16_t width, uint16_t height, bool value)
+{
+    int32_t x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+    int32_t x1 = x + width, y1 = y + height;
+    if (x1 > canvas->width) x1 = canvas->width;
+    if (y1 > canvas->height) y1 = canvas->height;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int32_t ty = y0 >> 3; ty <= (y1 - 1) >> 3; ty++)
+    {
+        // Linhas cobertas dentro do ladrilho, repetidas em todas as colunas
+        int32_t r0 = (y0 > ty * 8) ? y0 - ty * 8 : 0;
+        int32_t r1 = (y1 < ty * 8 + 8) ? y1 - ty * 8 : 8;
+        uint64_t rows = (uint64_t) ((0xFFu << r0) & (0xFFu >> (8 - r1)) & 0xFF) * ROWS_ALL;
+
+        for (int32_t tx = x0 >> 3; tx <= (x1 - 1) >> 3; tx++)
+        {
+            int32_t c0 = (x0 > tx * 8) ? x0 - tx * 8 : 0;
+            int32_t c1 = (x1 < tx * 8 + 8) ? x1 - tx * 8 : 8;
+            uint64_t mask = rows & ((~0ull >> (64 - 8 * (c1 - c0))) << (8 * c0));
+
+            uint64_t bits = tilecanvas_bits(canvas, canvas->map[(uint32_t) ty * canvas->width_tiles + tx]);
+            tilecanvas_put_tile(canvas, (uint16_t) tx, (uint16_t) ty, value ? bits | mask : bits & ~mask);
+        }
+    }
+}
+
+bool tilecanvas_get_pixel(const tilecanvas_t *canvas, uint16_t x, uint16_t y)
+{
+    if (x >= canvas->width || y >= canvas->height) return false;
+    uint64_t bits = tilecanvas_bits(canvas, canvas->map[(uint32_t) (y >> 3) * canvas->width_tiles + (x >> 3)]);
+    return (bits >> (8 * (x & 7) + (y & 7))) & 1;
+}
+
+uint32_t tilecanvas_count_lit(const tilecanvas_t *canvas)
+{
+    uint32_t count = (uint32_t) canvas->full_tiles * 64;
+    for (uint16_t i = 0; i < canvas->unique_end; i++)
+        if (canvas->refs[i]) count += (uint32_t) canvas->refs[i] * __builtin_popcountll(canvas->unique[i]);
+    return count;
+}
+
+void tilecanvas_render(const tilecanvas_t *canvas, ssd1306_t *ssd, uint16_t view_x, uint16_t view_y)
+{
+    if (view_x > canvas->width - WIDTH) view_x = canvas->width - WIDTH;
+    if (view_y > canvas->height - HEIGHT) view_y = canvas->height - HEIGHT;
+
+    // A RAM é um anel de 64 linhas e a linha de tela 0 fica na linha `start`
+    // da RAM. Com isso, cada página da RAM guarda um ladrilho inteiro: as
+    // páginas abaixo de `start` têm o começo da janela e as de cima, o fim
+    // (8 linhas de ladrilhos adiante). Só a página que contém `start`, quando
+    // ele não é múltiplo de 8, junta os dois: as linhas a partir de `start`
+    // são do começo da janela e as anteriores, do fim.
+    uint8_t start = view_y & (HEIGHT - 1);
+    uint8_t split_page = start >> 3;
+    uint64_t wrap_rows = ((1ull << (start & 7)) - 1) * ROWS_ALL;
+    uint16_t first_ty = (view_y & ~(HEIGHT - 1)) >> 3;
+    uint16_t first_tx = view_x >> 3;
+    uint8_t first_cx = view_x & 7;
+    uint8_t *column = ssd->ram_buffer + 1;
+
+    ssd->start_line = start;
+
+    for (uint8_t page = 0; page < ssd->pages; page++)
+    {
+        uint16_t ty = first_ty + page + (page < split_page ? HEIGHT / 8 : 0);
+        const uint8_t *row = &canvas->map[(uint32_t) ty * canvas->width_tiles];
+        const uint8_t *wrap = (page == split_page && wrap_rows) ? row + canvas->width_tiles * (HEIGHT / 8) : NULL;
+
+        uint16_t tx = first_tx;
+        uint8_t cx = first_cx;
+        uint64_t bits = 0;
+        for (uint8_t x = 0; x < WIDTH; x++)
+        {
+            if (x == 0 || cx == 0)
+            {
+                bits = tilecanvas_bits(canvas, row[tx]);
+                if (wrap) bits = (bits & ~wrap_rows) | (tilecanvas_bits(canvas, wrap[tx]) & wrap_rows);
+            }
+            column[x * ssd->pages + page] = (uint8_t) (bits >> (8 * cx));
+            if (++cx == 8)
+            {
+                cx = 0;
+                tx++;
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#ifndef TILECANVAS_H
+#define TILECANVAS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+/**
+ * @file tilecanvas.h
+ * @brief Tela virtual maior que o display, guardada em ladrilhos de 8x8 com deduplicação.
+ *
+ * O mapa tem um byte por ladrilho: vazio, cheio ou o índice de um ladrilho
+ * único em um banco compartilhado. Ladrilhos iguais usam a mesma entrada do
+ * banco (com contagem de referências), e uma escrita que torna um ladrilho
+ * vazio ou cheio devolve sua entrada. Assim, um nível de 1024x512 cabe em
+ * cerca de 10 KB, contra 64 KB em 1 bit por pixel.
+ *
+ * Cada ladrilho é um `uint64_t` no formato das páginas do SSD1306: o byte `c`
+ * é a coluna `c` e o bit `r` dele é a linha `r` (bit 0 em cima). A
+ * renderização da janela copia bytes de coluna direto para o `ram_buffer`, sem
+ * deslocamentos: o deslocamento vertical dentro da página é feito pela linha
+ * inicial do display (`start_line`), que mostra a RAM como um anel de 64
+ * linhas. Só a página onde o anel se fecha junta dois ladrilhos, por máscara.
+ *
+ * Sem bancos livres, um ladrilho novo é arredondado para vazio ou cheio
+ * (o mais próximo) e contado em `overflows`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Tile_Canvas Tela Virtual em Ladrilhos
+ * @brief Níveis maiores que o display, com rolagem.
+ * @{
+ */
+
+/**
+ * @def TILECANVAS_MAX_TILES
+ * @brief Ladrilhos do maior nível (1024x512 por padrão).
+ */
+#ifndef TILECANVAS_MAX_TILES
+#define TILECANVAS_MAX_TILES ((1024 / 8) * (512 / 8))
+#endif
+
+/**
+ * @def TILECANVAS_UNIQUE_TILES
+ * @brief Entradas do banco de ladrilhos únicos (o mapa usa 2 valores para vazio e cheio).
+ */
+#define TILECANVAS_UNIQUE_TILES 254
+
+/**
+ * @brief Tela virtual; grande demais para a pilha, deve ser estática.
+ */
+typedef struct
+{
+    uint16_t width, height;                  /**< Tamanho em pixels (múltiplos de 8). */
+    uint16_t width_tiles, height_tiles;      /**< Tamanho em ladrilhos. */
+    uint8_t map[TILECANVAS_MAX_TILES];       /**< 0 = vazio, 1 = cheio, n = `unique[n - 2]`. */
+    uint64_t unique[TILECANVAS_UNIQUE_TILES]; /**< Ladrilhos únicos, em colunas. */
+    uint16_t refs[TILECANVAS_UNIQUE_TILES];  /**< Ladrilhos do mapa que usam cada entrada (0 = livre). */
+    uint16_t unique_used;                    /**< Entradas com referências. */
+    uint16_t unique_end;                     /**< Uma além da maior entrada já usada. */
+    uint16_t full_tiles;                     /**< Ladrilhos cheios no mapa. */
+    uint32_t overflows;                      /**< Ladrilhos arredondados por falta de entradas. */
+} tilecanvas_t;
+
+/**
+ * @brief Monta um ladrilho a partir de 8 bytes de coluna.
+ *
+ * @param columns Colunas da esquerda para a direita (bit 0 = linha de cima).
+ * @return Ladrilho.
+ */
+static inline uint64_t tilecanvas_tile(const uint8_t columns[8])
+{
+    uint64_t bits = 0;
+    for (int c = 7; c >= 0; c--) bits = (bits << 8) | columns[c];
+    return bits;
+}
+
+/**
+ * @brief Inicia uma tela vazia.
+ *
+ * @param canvas Tela.
+ * @param width Largura em pixels, múltipla de 8 e de pelo menos `WIDTH`.
+ * @param height Altura em pixels, múltipla de 8 e de pelo menos `HEIGHT`.
+ * @return `false` se o tamanho não couber em `TILECANVAS_MAX_TILES`.
+ */
+bool tilecanvas_init(tilecanvas_t *canvas, uint16_t width, uint16_t height);
+
+/**
+ * @brief Substitui um ladrilho inteiro.
+ *
+ * @param canvas Tela.
+ * @param tx Coluna do ladrilho.
+ * @param ty Linha do ladrilho.
+ * @param bits Conteúdo (veja `tilecanvas_tile`).
+ */
+void tilecanvas_put_tile(tilecanvas_t *canvas, uint16_t tx, uint16_t ty, uint64_t bits);
+
+/**
+ * @brief Acende ou apaga um retângulo, recortado pelas bordas da tela.
+ *
+ * @param canvas Tela.
+ * @param x Coluna do canto superior esquerdo (pode ser negativa).
+ * @param y Linha do canto superior esquerdo (pode ser negativa).
+ * @param width Largura.
+ * @param height Altura.
+ * @param value `true` para acender.
+ */
+void tilecanvas_fill_rect(tilecanvas_t *canvas, int32_t x, int32_t y, uint16_t width, uint16_t height, bool value);
+
+/**
+ * @brief Lê um pixel.
+ *
+ * @param canvas Tela.
+ * @param x Coluna.
+ * @param y Linha.
+ * @return `true` se aceso (fora da tela, `false`).
+ */
+bool tilecanvas_get_pixel(const tilecanvas_t *canvas, uint16_t x, uint16_t y);
+
+/**
+ * @brief Conta os pixels acesos da tela inteira sem percorrer o mapa.
+ *
+ * @param canvas Tela.
+ * @return Pixels acesos.
+ */
+uint32_t tilecanvas_count_lit(const tilecanvas_t *canvas);
+
+/**
+ * @brief Copia a janela de 128x64 que começa em (`view_x`, `view_y`) para o display.
+ *
+ * Ajusta `ssd->start_line`; o que for desenhado depois com `ssd1306_pixel`
+ * continua nas coordenadas da tela. A janela é limitada às bordas da tela.
+ *
+ * @param canvas Tela.
+ * @param ssd Display (o `ram_buffer` inteiro é reescrito).
+ * @param view_x Coluna da tela virtual no canto esquerdo do display.
+ * @param view_y Linha da tela virtual no topo do display.
+ */
+void tilecanvas_render(const tilecanvas_t *canvas, ssd1306_t *ssd, uint16_t view_x, uint16_t view_y);
+
+/** @} */ // Fim do grupo "Tile_Canvas"
+
+#endif // TILECANVAS_H
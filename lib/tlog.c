@@ -0,0 +1,170 @@
+#include "tlog.h"
+#include "fmt.h"
+#include "hal.h"
+#include "serial_tx.h"
+
+/**
+ * @file tlog.c
+ * @brief Ring de mensagens e envio em quadros binários ou em texto.
+ *
+ * Cada mensagem ocupa no ring uma palavra de cabeçalho (número, argumentos e
+ * sequência), o instante e os argumentos. A gravação mascara as interrupções
+ * para reservar e copiar as palavras; o envio, só no laço principal, lê sem
+ * travas entre o fim e o início. No modo tokenizado, cada quadro só sai do
+ * ring para a fila comum da serial (`serial_tx`) quando cabe nela inteiro.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#if TLOG_TOKENIZED == 0
+/**
+ * @brief Formatos, só necessários no modo texto.
+ */
+static const char *const tlog_formats[TLOG_COUNT] = {
+#define TLOG_FORMAT(name, argc, format) format,
+    TLOG_MESSAGES(TLOG_FORMAT)
+#undef TLOG_FORMAT
+};
+#endif
+
+static uint32_t ring[TLOG_RING_WORDS];
+static volatile uint32_t ring_head; // Contadores livres; índice = contador % TLOG_RING_WORDS
+static volatile uint32_t ring_tail;
+static uint8_t seq;
+static tlog_stats_t stats;
+
+#if TLOG_TOKENIZED
+static uint8_t tx_frame[TLOG_FRAME_MAX_BYTES];
+static uint8_t tx_len; // Quadro montado à espera de espaço na fila da serial (0: nenhum)
+
+static void put_le(uint8_t *p, uint32_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++) p[i] = (uint8_t) (value >> (8 * i));
+}
+#endif
+
+void tlog_init(void)
+{
+    static const uint8_t argcs[TLOG_COUNT] = {
+#define TLOG_ARGC(name, argc, format) argc,
+        TLOG_MESSAGES(TLOG_ARGC)
+#undef TLOG_ARGC
+    };
+    uint32_t hash = tlog_dictionary_hash(argcs, TLOG_COUNT);
+
+    ring_head = ring_tail = 0;
+    seq = 0;
+    stats.written = stats.dropped = 0;
+#if TLOG_TOKENIZED
+    tx_len = 0;
+#endif
+    TLOG(BOOT, hash);
+}
+
+void tlog_write(uint16_t id, const uint32_t *args, uint8_t argc)
+{
+    uint32_t status = hal_irq_save();
+    uint32_t head = ring_head;
+
+    if (TLOG_RING_WORDS - (head - ring_tail) < 2u + argc)
+    {
+        seq++; // A lacuna na sequência mostra a perda ao decodificador
+        stats.dropped++;
+        hal_irq_restore(status);
+        return;
+    }
+    ring[head++ % TLOG_RING_WORDS] = id | (uint32_t) argc << 16 | (uint32_t) seq++ << 24;
+    ring[head++ % TLOG_RING_WORDS] = hal_time_us32();
+    for (uint8_t i = 0; i < argc; i++) ring[head++ % TLOG_RING_WORDS] = args[i];
+    ring_head = head;
+    stats.written++;
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Retira a mensagem mais antiga do ring.
+ *
+ * @return `false` se o ring estiver vazio.
+ */
+static bool tlog_pop(uint32_t *header, uint32_t *time_us, uint32_t *args)
+{
+    uint32_t tail = ring_tail;
+    if (tail == ring_head) return false;
+
+    *header = ring[tail++ % TLOG_RING_WORDS];
+    *time_us = ring[tail++ % TLOG_RING_WORDS];
+    uint8_t argc = (uint8_t) (*header >> 16);
+    for (uint8_t i = 0; i < argc; i++) args[i] = ring[tail++ % TLOG_RING_WORDS];
+    hal_dmb(); // As palavras foram lidas antes de liberar o espaço
+    ring_tail = tail;
+    return true;
+}
+
+#if TLOG_TOKENIZED
+
+/**
+ * @brief Monta o quadro binário de uma mensagem em `tx_frame`.
+ */
+static void tlog_encode(uint32_t header, uint32_t time_us, const uint32_t *args)
+{
+    uint8_t argc = (uint8_t) (header >> 16);
+    uint8_t s1 = 0, s2 = 0;
+    uint8_t len = 10;
+
+    tx_frame[0] = TLOG_SYNC0;
+    tx_frame[1] = TLOG_SYNC1;
+    put_le(tx_frame + 2, header & 0xFFFF, 2);
+    tx_frame[4] = argc;
+    tx_frame[5] = (uint8_t) (header >> 24);
+    put_le(tx_frame + 6, time_us, 4);
+    for (uint8_t i = 0; i < argc; i++, len += 4) put_le(tx_frame + len, args[i], 4);
+    for (uint8_t i = 2; i < len; i++)
+    {
+        s1 = (uint8_t) ((s1 + tx_frame[i]) % 255);
+        s2 = (uint8_t) ((s2 + s1) % 255);
+    }
+    tx_frame[len++] = s1;
+    tx_frame[len++] = s2;
+    tx_len = len;
+}
+
+void tlog_drain(void)
+{
+    uint32_t header, time_us, args[TLOG_MAX_ARGS];
+
+    while (true)
+    {
+        if (tx_len == 0)
+        {
+            if (!tlog_pop(&header, &time_us, args)) break;
+            tlog_encode(header, time_us, args);
+        }
+        if (!serial_tx_frame(tx_frame, tx_len)) break; // Fila cheia: o quadro espera a próxima chamada
+        tx_len = 0;
+    }
+    serial_tx_drain();
+}
+
+#else
+
+void tlog_drain(void)
+{
+    uint32_t header, time_us, args[TLOG_MAX_ARGS];
+    char line[96];
+
+    while (tlog_pop(&header, &time_us, args))
+    {
+        uint16_t id = (uint16_t) header;
+        size_t len = fmt_render(line, sizeof line, id < TLOG_COUNT ? tlog_formats[id] : "?", args, (uint8_t) (header >> 16));
+        for (size_t i = 0; i < len; i++) hal_putc_raw(line[i]);
+        hal_putc_raw('\n');
+    }
+}
+
+#endif // TLOG_TOKENIZED
+
+void tlog_get_stats(tlog_stats_t *out) { *out = stats; }
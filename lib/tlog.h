@@ -0,0 +1,185 @@
+#ifndef TLOG_H
+#define TLOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "tlog_messages.h"
+
+/**
+ * @file tlog.h
+ * @brief Registro de mensagens tokenizado, com formatação adiada.
+ *
+ * `TLOG(NOME, args...)` não formata nada: grava em um ring de palavras o
+ * número da mensagem, o instante e os argumentos como `uint32_t` (algumas
+ * dezenas de ciclos, com as interrupções mascaradas só durante a cópia). Os
+ * textos ficam no dicionário `tlog_messages.h` e não ocupam a flash do
+ * firmware. `tlog_drain`, chamada pelo laço principal, envia as mensagens:
+ *  - `TLOG_TOKENIZED` = 1 (padrão): quadros binários pela serial, sem
+ *    bloquear, pela mesma fila da telemetria (`serial_tx`), refeitos em texto
+ *    no computador por `tools/tlog_decode.c`;
+ *  - `TLOG_TOKENIZED` = 0: o texto é montado por `fmt_render` e escrito na
+ *    serial, como faria um `printf` (usado no build do host).
+ * Com o ring cheio, a mensagem nova é descartada; a sequência de cada quadro
+ * permite ao decodificador contar as perdas.
+ *
+ * Formato do quadro (little-endian):
+ *     0xA5 0xC3 | mensagem u16 | argumentos u8 | sequência u8 | instante_us u32 |
+ *     argumentos u32... | Fletcher-16 dos bytes desde a mensagem u16
+ *
+ * Só o núcleo 0 pode registrar mensagens (interrupções incluídas).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup TLog Registro Tokenizado
+ * @brief Mensagens como número e argumentos, com o texto refeito fora do caminho quente.
+ * @{
+ */
+
+/**
+ * @def TLOG_TOKENIZED
+ * @brief 1 para enviar quadros binários, 0 para enviar o texto já formatado.
+ */
+#ifndef TLOG_TOKENIZED
+#define TLOG_TOKENIZED 1
+#endif
+
+/**
+ * @def TLOG_SYNC0
+ * @brief Primeiro byte de sincronismo (o mesmo da telemetria).
+ */
+#define TLOG_SYNC0 0xA5
+
+/**
+ * @def TLOG_SYNC1
+ * @brief Segundo byte de sincronismo, que distingue as mensagens da telemetria.
+ */
+#define TLOG_SYNC1 0xC3
+
+/**
+ * @def TLOG_MAX_ARGS
+ * @brief Maior número de argumentos de uma mensagem.
+ */
+#define TLOG_MAX_ARGS 8
+
+/**
+ * @def TLOG_RING_WORDS
+ * @brief Palavras do ring (potência de 2); cada mensagem ocupa 2 + argumentos.
+ */
+#define TLOG_RING_WORDS 256
+
+/**
+ * @def TLOG_FRAME_MAX_BYTES
+ * @brief Maior quadro binário.
+ */
+#define TLOG_FRAME_MAX_BYTES (10 + 4 * TLOG_MAX_ARGS + 2)
+
+/**
+ * @brief Números das mensagens, na ordem do dicionário.
+ */
+typedef enum
+{
+#define TLOG_ENUM_ID(name, argc, format) TLOG_##name,
+    TLOG_MESSAGES(TLOG_ENUM_ID)
+#undef TLOG_ENUM_ID
+    TLOG_COUNT
+} tlog_id_t;
+
+/**
+ * @brief Argumentos esperados por mensagem (`TLOG_ARGC_NOME`).
+ */
+enum
+{
+#define TLOG_ENUM_ARGC(name, argc, format) TLOG_ARGC_##name = argc,
+    TLOG_MESSAGES(TLOG_ENUM_ARGC)
+#undef TLOG_ENUM_ARGC
+};
+
+/**
+ * @def TLOG_NARGS
+ * @brief Conta os argumentos de uma chamada (constante de compilação).
+ */
+#define TLOG_NARGS(...) (sizeof((uint32_t[]) { 0, ##__VA_ARGS__ }) / sizeof(uint32_t) - 1)
+
+/**
+ * @def TLOG
+ * @brief Registra a mensagem `TLOG_<name>` com seus argumentos inteiros.
+ *
+ * O número de argumentos é conferido na compilação contra o dicionário.
+ */
+#define TLOG(name, ...)                                                                          \
+    do                                                                                           \
+    {                                                                                            \
+        _Static_assert(TLOG_NARGS(__VA_ARGS__) == TLOG_ARGC_##name,                              \
+                       "TLOG(" #name "): quantidade de argumentos diferente de tlog_messages.h"); \
+        tlog_write(TLOG_##name, (const uint32_t[TLOG_ARGC_##name + 1]) { 0, ##__VA_ARGS__ } + 1,  \
+                   TLOG_ARGC_##name);                                                            \
+    } while (0)
+
+/**
+ * @brief Contadores do registro.
+ */
+typedef struct
+{
+    uint32_t written;  /**< Mensagens aceitas no ring. */
+    uint32_t dropped;  /**< Mensagens descartadas com o ring cheio. */
+} tlog_stats_t;
+
+/**
+ * @brief Hash FNV-1a da forma do dicionário (quantos argumentos tem cada mensagem).
+ *
+ * Calculado pelo firmware e pelo decodificador com as próprias cópias do
+ * dicionário, sem os textos (que não vão para o firmware tokenizado);
+ * valores diferentes indicam mensagens incluídas, removidas ou com outros argumentos.
+ *
+ * @param argcs Argumentos de cada mensagem, na ordem do dicionário.
+ * @param count Mensagens.
+ * @return Hash.
+ */
+static inline uint32_t tlog_dictionary_hash(const uint8_t *argcs, size_t count)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t m = 0; m < count; m++) hash = (hash ^ argcs[m]) * 16777619u;
+    return (hash ^ (uint32_t) count) * 16777619u;
+}
+
+/**
+ * @brief Esvazia o ring e registra a mensagem `BOOT` com o hash do dicionário.
+ */
+void tlog_init(void);
+
+/**
+ * @brief Copia uma mensagem para o ring (use a macro `TLOG`).
+ *
+ * @param id Mensagem.
+ * @param args Argumentos.
+ * @param argc Quantidade, até `TLOG_MAX_ARGS`.
+ */
+void tlog_write(uint16_t id, const uint32_t *args, uint8_t argc);
+
+/**
+ * @brief Envia as mensagens pendentes.
+ *
+ * No modo tokenizado, os quadros entram inteiros na fila comum da serial
+ * (`serial_tx`), que passa adiante só o que cabe agora (nunca espera).
+ */
+void tlog_drain(void);
+
+/**
+ * @brief Lê os contadores do registro.
+ *
+ * @param[out] stats Destino.
+ */
+void tlog_get_stats(tlog_stats_t *stats);
+
+/** @} */ // Fim do grupo "TLog"
+
+#endif // TLOG_H
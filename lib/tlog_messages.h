@@ -0,0 +1,50 @@
+#ifndef TLOG_MESSAGES_H
+#define TLOG_MESSAGES_H
+
+/**
+ * @file tlog_messages.h
+ * @brief Dicionário das mensagens de `lib/tlog`: nome, argumentos e formato.
+ *
+ * É a única fonte dos textos: o firmware só guarda o número de cada
+ * mensagem (a posição nesta lista) e o decodificador do computador
+ * (`tools/tlog_decode.c`) inclui este mesmo arquivo para refazer os textos.
+ * Novas mensagens entram no fim da lista, para que capturas antigas
+ * continuem legíveis; o hash do dicionário enviado no boot acusa
+ * decodificadores desatualizados.
+ *
+ * Formatos: `%u`, `%d`, `%x`, `%c` e `%%` (veja `lib/fmt.h`).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+// X(nome, argumentos, formato)
+#define TLOG_MESSAGES(X) \
+    X(BOOT, 1, "log dictionary %x") \
+    X(STORE_UNAVAILABLE, 0, "Persistent store unavailable") \
+    X(SYSTEM_INITIALIZED, 0, "System initialized...") \
+    X(GAME_STARTED, 0, "Game started") \
+    X(CORE_UTILIZATION, 4, "core0 %u.%u%% core1 %u.%u%%") \
+    X(GAME_ENDED, 0, "Game ended") \
+    X(PIXELS_REMAIN, 1, "%u pixels remain") \
+    X(REPLAY_MATCHES, 1, "Replay matches (%u frames)") \
+    X(REPLAY_MISMATCH, 1, "Replay MISMATCH (%u frames)") \
+    X(ROUND_RECORDED, 1, "Round recorded: %u bytes") \
+    X(ROUND_RECORDED_TRUNCATED, 1, "Round recorded: %u bytes (truncated)") \
+    X(NEW_HIGH_SCORE, 2, "New high score #%u: %u pixels") \
+    X(WORK_STATS, 5, "ISR max %u us, work queue max depth %u/%u/%u, dropped %u") \
+    X(TELEMETRY_STATS, 2, "Telemetry %u records, %u dropped") \
+    X(FLASH_WRITE_FAILED, 0, "Flash write failed") \
+    X(CALIBRATION_LOADED, 0, "Joystick calibration loaded") \
+    X(CALIBRATED, 7, "Joystick calibrated: x %u/%u/%u y %u/%u/%u dz %u") \
+    X(REPLAYING, 0, "Replaying last round") \
+    X(LOG_STATS, 2, "Log %u messages, %u dropped") \
+    X(CLOCK_CHANGED, 2, "clk_sys %u kHz (switch %u us)") \
+    X(CLOCK_UNAVAILABLE, 1, "clk_sys %u kHz not reachable by the PLL") \
+    X(WORLD_STATS, 3, "World tiles: %u unique, %u full, %u rounded") \
+    X(GRAY_REFRESH, 6, "Gray planes: %u Hz, worst cycle %u us, %u bytes/cycle, flicker-free %u, on-time %u/%u us") \
+    X(CALIBRATION_REJECTED, 0, "Joystick calibration rejected, keeping the previous one")
+
+#endif // TLOG_MESSAGES_H
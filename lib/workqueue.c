@@ -0,0 +1,182 @@
+#include "workqueue.h"
+#include "hal.h"
+
+/**
+ * @file workqueue.c
+ * @brief Filas circulares por prioridade e instrumentação das interrupções.
+ *
+ * Cada fila tem um índice de escrita (`head`, alterado com as interrupções
+ * mascaradas, pois várias interrupções podem publicar) e um de leitura
+ * (`tail`, alterado só pelo laço principal).
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @brief Item de trabalho de tamanho fixo.
+ */
+typedef struct
+{
+    work_fn_t fn;  /**< Função a executar */
+    uint32_t arg;  /**< Argumento */
+} work_item_t;
+
+/**
+ * @brief Fila de uma prioridade.
+ */
+typedef struct
+{
+    work_item_t items[WORK_QUEUE_LEN];
+    volatile uint32_t head; /**< Escrito pelos produtores, com interrupções mascaradas */
+    volatile uint32_t tail; /**< Escrito pelo consumidor */
+} work_ring_t;
+
+static work_ring_t work_rings[WORK_PRIO_COUNT];
+static volatile work_stats_t work_stats;
+static volatile uint32_t work_max_isr_us[2]; // Um por núcleo: cada um só escreve o seu, sem disputa entre núcleos
+
+/**
+ * @brief Publica um item de trabalho; pode ser chamada de interrupções.
+ *
+ * @param priority Fila de destino.
+ * @param fn Função a executar.
+ * @param arg Argumento da função.
+ * @return `false` se a fila estava cheia.
+ */
+bool work_post(work_priority_t priority, work_fn_t fn, uint32_t arg)
+{
+    work_ring_t *ring = &work_rings[priority];
+    bool posted = false;
+
+    uint32_t status = hal_irq_save();
+    uint32_t head = ring->head;
+    uint32_t depth = head - ring->tail;
+    if (depth < WORK_QUEUE_LEN)
+    {
+        work_item_t *item = &ring->items[head & (WORK_QUEUE_LEN - 1)];
+        item->fn = fn;
+        item->arg = arg;
+        ring->head = head + 1;
+        if (depth + 1 > work_stats.max_depth[priority]) work_stats.max_depth[priority] = (uint8_t) (depth + 1);
+        posted = true;
+    }
+    else
+    {
+        work_stats.dropped++;
+    }
+    hal_irq_restore(status);
+    return posted;
+}
+
+/**
+ * @brief Retira o item mais prioritário.
+ *
+ * @param[out] item Item retirado.
+ * @return `false` se todas as filas estão vazias.
+ */
+static bool work_take(work_item_t *item)
+{
+    for (uint8_t p = 0; p < WORK_PRIO_COUNT; p++)
+    {
+        work_ring_t *ring = &work_rings[p];
+        uint32_t tail = ring->tail;
+        if (tail == ring->head) continue;
+        *item = ring->items[tail & (WORK_QUEUE_LEN - 1)];
+        hal_dmb(); // Item copiado antes de a posição ser liberada aos produtores
+        ring->tail = tail + 1;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Executa itens pendentes, da prioridade mais alta para a mais baixa.
+ *
+ * @param budget Máximo de itens a executar (0 executa todos).
+ * @return Quantidade de itens executados.
+ */
+uint32_t work_dispatch(uint32_t budget)
+{
+    work_item_t item;
+    uint32_t executed = 0;
+
+    while ((budget == 0 || executed < budget) && work_take(&item))
+    {
+        item.fn(item.arg);
+        executed++;
+    }
+    work_stats.executed += executed;
+    return executed;
+}
+
+/**
+ * @brief Informa se há itens pendentes em qualquer fila.
+ *
+ * @return `true` se houver trabalho a executar.
+ */
+bool work_pending(void)
+{
+    for (uint8_t p = 0; p < WORK_PRIO_COUNT; p++)
+    {
+        if (work_rings[p].head != work_rings[p].tail) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Marca o início de uma interrupção instrumentada.
+ *
+ * @return Instante de entrada.
+ */
+uint32_t work_isr_begin(void)
+{
+    return hal_time_us32();
+}
+
+/**
+ * @brief Marca o fim de uma interrupção instrumentada.
+ *
+ * Pode ser chamada nos dois núcleos: cada um atualiza só o próprio máximo.
+ *
+ * @param start_us Valor retornado por `work_isr_begin`.
+ */
+void work_isr_end(uint32_t start_us)
+{
+    uint32_t elapsed = hal_time_us32() - start_us;
+    volatile uint32_t *max_us = &work_max_isr_us[hal_core_num()];
+    uint32_t status = hal_irq_save();
+    if (elapsed > *max_us) *max_us = elapsed;
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Copia as estatísticas acumuladas.
+ *
+ * @param[out] stats Estatísticas.
+ */
+void work_get_stats(work_stats_t *stats)
+{
+    uint32_t status = hal_irq_save();
+    stats->max_isr_us = work_max_isr_us[0] > work_max_isr_us[1] ? work_max_isr_us[0] : work_max_isr_us[1];
+    for (uint8_t p = 0; p < WORK_PRIO_COUNT; p++) stats->max_depth[p] = work_stats.max_depth[p];
+    stats->dropped = work_stats.dropped;
+    stats->executed = work_stats.executed;
+    hal_irq_restore(status);
+}
+
+/**
+ * @brief Zera as estatísticas.
+ */
+void work_reset_stats(void)
+{
+    uint32_t status = hal_irq_save();
+    work_max_isr_us[0] = work_max_isr_us[1] = 0; // Uma medida do outro núcleo feita agora pode sobreviver; é só uma amostra
+    for (uint8_t p = 0; p < WORK_PRIO_COUNT; p++) work_stats.max_depth[p] = 0;
+    work_stats.dropped = 0;
+    work_stats.executed = 0;
+    hal_irq_restore(status);
+}
@@ -0,0 +1,126 @@
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file workqueue.h
+ * @brief Fila de trabalho adiado ("bottom half") para rotinas de interrupção.
+ *
+ * Uma interrupção faz só o mínimo e publica um item de tamanho fixo (função e
+ * argumento) com `work_post`; o laço principal executa os itens com
+ * `work_dispatch`, da prioridade mais alta para a mais baixa. A publicação
+ * mascara as interrupções por poucas instruções (o Cortex-M0+ não tem
+ * instruções atômicas de leitura-modificação-escrita), e o consumo não usa
+ * travas. O módulo registra a maior duração de interrupção medida com
+ * `work_isr_begin`/`work_isr_end`, em qualquer núcleo, e a maior ocupação de
+ * cada fila.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @version 1.0
+ * @license GNU General Public License v3.0 (GPLv3)
+ *
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+/**
+ * @defgroup Work_Queue Fila de Trabalho Adiado
+ * @brief Execução no laço principal de trabalho originado em interrupções.
+ * @{
+ */
+
+/**
+ * @def WORK_QUEUE_LEN
+ * @brief Capacidade de cada fila de prioridade (potência de 2).
+ */
+#define WORK_QUEUE_LEN 16
+
+/**
+ * @brief Prioridades de execução, da mais alta para a mais baixa.
+ */
+typedef enum
+{
+    WORK_PRIO_HIGH = 0, /**< Estado do jogo, ações do usuário */
+    WORK_PRIO_NORMAL,   /**< Saídas visuais e sonoras */
+    WORK_PRIO_LOW,      /**< Registro, estatísticas */
+    WORK_PRIO_COUNT
+} work_priority_t;
+
+/**
+ * @brief Função de um item de trabalho.
+ *
+ * @param arg Argumento fornecido em `work_post`.
+ */
+typedef void (*work_fn_t)(uint32_t arg);
+
+/**
+ * @brief Estatísticas da fila e das interrupções instrumentadas.
+ */
+typedef struct
+{
+    uint32_t max_isr_us;                      /**< Maior duração de interrupção medida, nos dois núcleos */
+    uint8_t max_depth[WORK_PRIO_COUNT];       /**< Maior ocupação de cada fila */
+    uint32_t dropped;                         /**< Itens descartados por fila cheia */
+    uint32_t executed;                        /**< Itens executados */
+} work_stats_t;
+
+/**
+ * @brief Publica um item de trabalho; pode ser chamada de interrupções.
+ *
+ * @param priority Fila de destino.
+ * @param fn Função a executar no laço principal.
+ * @param arg Argumento da função.
+ * @return `false` se a fila estava cheia (o item é descartado e contado).
+ */
+bool work_post(work_priority_t priority, work_fn_t fn, uint32_t arg);
+
+/**
+ * @brief Executa itens pendentes, da prioridade mais alta para a mais baixa.
+ *
+ * Depois de cada item a busca recomeça pela prioridade mais alta, de modo
+ * que um item urgente publicado durante a execução passa na frente.
+ *
+ * @param budget Máximo de itens a executar (0 executa todos).
+ * @return Quantidade de itens executados.
+ */
+uint32_t work_dispatch(uint32_t budget);
+
+/**
+ * @brief Informa se há itens pendentes em qualquer fila.
+ *
+ * @return `true` se houver trabalho a executar.
+ */
+bool work_pending(void);
+
+/**
+ * @brief Marca o início de uma interrupção instrumentada.
+ *
+ * @return Instante de entrada, a ser passado para `work_isr_end`.
+ */
+uint32_t work_isr_begin(void);
+
+/**
+ * @brief Marca o fim de uma interrupção instrumentada e atualiza a maior duração.
+ *
+ * @param start_us Valor retornado por `work_isr_begin`.
+ */
+void work_isr_end(uint32_t start_us);
+
+/**
+ * @brief Copia as estatísticas acumuladas.
+ *
+ * @param[out] stats Estatísticas.
+ */
+void work_get_stats(work_stats_t *stats);
+
+/**
+ * @brief Zera as estatísticas.
+ */
+void work_reset_stats(void);
+
+/** @} */ // Fim do grupo "Work_Queue"
+
+#endif // WORKQUEUE_H
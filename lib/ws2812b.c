@@ -1,7 +1,6 @@
 #include "ws2812b.h"
-#include "hardware/clocks.h"
+#include "clockmgr.h"
 #include <stdlib.h>
-#include "../generated/ws2812b.pio.h"
 
 /**
  * @brief Inverte horizontalmente a matriz 5x5 de LEDs.
@@ -135,9 +134,27 @@ void ws2812b_turn_off_all(const ws2812b_t *ws)
  * @param sm Número da máquina de estado (state machine).
  * @param data Dados a serem enviados para os LEDs.
  */
-void send_ws2812b_data(PIO pio, uint sm, uint32_t data)
+void send_ws2812b_data(hal_pio_t pio, uint sm, uint32_t data)
 {
-    pio_sm_put_blocking(pio, sm, data); // Envia o dado para o PIO, bloqueando até o envio ser completado
+    hal_ws2812_put(pio, sm, data); // Envia o dado para o PIO, bloqueando até haver espaço na FIFO
+}
+
+/**
+ * @brief Troca de relógio: termina o quadro em curso e refaz o divisor do PIO.
+ *
+ * Um bit enviado durante a troca sairia com a duração errada e mudaria a cor
+ * de um LED; por isso o FIFO é esvaziado antes.
+ *
+ * @param event Momento da troca.
+ * @param sys_hz Novo relógio (não usado; o divisor é lido da HAL).
+ * @param user Controlador WS2812B.
+ */
+static void ws2812b_clock_changed(clockmgr_event_t event, uint32_t sys_hz, void *user)
+{
+    ws2812b_t *ws = (ws2812b_t *) user;
+    (void) sys_hz;
+    if (event == CLOCKMGR_PRE_CHANGE) hal_ws2812_wait_idle(ws->pio, ws->state_machine_id);
+    else hal_ws2812_set_clock(ws->pio, ws->state_machine_id);
 }
 
 /**
@@ -149,40 +166,15 @@ void send_ws2812b_data(PIO pio, uint sm, uint32_t data)
  * @param pin Pino GPIO conectado ao LED WS2812B.
  * @return Ponteiro para o controlador WS2812B inicializado.
  */
-ws2812b_t *init_ws2812b(PIO pio, uint8_t pin)
+ws2812b_t *init_ws2812b(hal_pio_t pio, uint8_t pin)
 {
     ws2812b_t *ws = malloc(sizeof(ws2812b_t)); // Aloca memória para a estrutura que representará o controlador WS2812B
-    uint offset = pio_add_program(pio, &ws2812_program); // Adiciona o programa WS2812 ao PIO
-    uint sm = pio_claim_unused_sm(pio, true); // Requisita uma máquina de estado livre no PIO
-
-    pio_sm_config c = ws2812_program_get_default_config(offset); // Obtém a configuração padrão do programa WS2812
-
-    // Configura o pino para ser utilizado como saída de controle para o WS2812
-    sm_config_set_set_pins(&c, pin, 1);
-    
-    pio_gpio_init(pio, pin); // Inicializa o pino no PIO
-
-    // Configura a direção do pino para saída
-    pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
-
-    // Configura a frequência do clock do PIO para 8 MHz (8.000.000 Hz)
-    float div = clock_get_hz(clk_sys) / 8000000.0;
-    sm_config_set_clkdiv(&c, div); // Define o divisor do clock do PIO
-
-    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX); // Configura o PIO para usar a FIFO de transmissão
-
-    sm_config_set_out_shift(&c, false, true, 24); // Configura o shift de 24 bits na saída
-
-    sm_config_set_out_special(&c, true, false, false); // Define a configuração especial de saída
-
-    // Inicializa a máquina de estado com a configuração definida
-    pio_sm_init(pio, sm, offset, &c);
-    pio_sm_set_enabled(pio, sm, true); // Habilita a máquina de estado
 
-    // Inicializa o controlador WS2812B
+    // Programa WS2812 em uma máquina de estado livre do PIO, a 800 kHz no pino informado
+    ws->state_machine_id = hal_ws2812_init(pio, pin);
     ws->out_pin = pin;
-    ws->state_machine_id = sm;
     ws->pio = pio;
+    clockmgr_register(ws2812b_clock_changed, ws);
 
     return ws; // Retorna o controlador WS2812B configurado
 }
@@ -216,8 +208,8 @@ void ws2812b_draw_b(const uint8_t *glyph, const uint8_t color, const uint8_t int
     for(i = 0; i < 25; i++) {
         if(glyph[24-i] == 1) {
             composite_value = ws2812b_compose_led_value(color, intensity); // Calcula o valor do LED
-            send_ws2812b_data(pio0, 0, composite_value); // Envia o dado para o pino 0 do PIO0
+            send_ws2812b_data(HAL_PIO0, 0, composite_value); // Envia o dado para o pino 0 do PIO0
         }
-        else send_ws2812b_data(pio0, 0, 0); // Envia 0 para apagar o LED
+        else send_ws2812b_data(HAL_PIO0, 0, 0); // Envia 0 para apagar o LED
     }
 }
@@ -2,7 +2,7 @@
 #define WS2812B_H
 
 #include <stdint.h>
-#include "hardware/pio.h"
+#include "hal.h"
 #include "ws2812b_definitions.h"
 
 #define WS2812B_PIN 7             /**< Pino GPIO utilizado para controlar o WS2812B */
@@ -39,7 +39,7 @@
  */
 
 typedef struct {
-    PIO pio;                 /**< Ponteiro para o controlador PIO utilizado para comunicação com os LEDs */
+    hal_pio_t pio;           /**< Ponteiro para o controlador PIO utilizado para comunicação com os LEDs */
     uint state_machine_id;   /**< ID da máquina de estado (state machine) que controla o envio dos dados para os LEDs */
     uint8_t out_pin;         /**< Pino GPIO ao qual o WS2812B está conectado */
 } ws2812b_t;
@@ -56,7 +56,7 @@ typedef struct {
  * 
  * @return ws2812b_t* Retorna um ponteiro para a estrutura `ws2812b_t` contendo as configurações do WS2812B.
  */
-ws2812b_t *init_ws2812b(PIO pio, uint8_t pin);
+ws2812b_t *init_ws2812b(hal_pio_t pio, uint8_t pin);
 
 /**
  * @brief Desenha uma imagem (glyph) na matriz de LEDs WS2812B.
@@ -94,7 +94,7 @@ void ws2812b_turn_off_all(const ws2812b_t *ws);
  * @param sm O identificador da máquina de estado (state machine) que controla a transmissão de dados.
  * @param data O valor de 24 bits a ser enviado, representando a cor e intensidade dos LEDs.
  */
-void send_ws2812b_data(PIO pio, uint sm, uint32_t data);
+void send_ws2812b_data(hal_pio_t pio, uint sm, uint32_t data);
 
 /**
  * @brief Prepara a imagem (glyph) para exibição.
@@ -1,8 +1,7 @@
 #include "ws2812b_motion.h"
 #include "ws2812b.h"
 #include "ws2812b_definitions.h"
-#include "pico/stdlib.h"
-#include "hardware/pio.h"
+#include "hal.h"
 #include <string.h>
 #include <stdlib.h>
 
@@ -17,13 +16,13 @@ static void ws2812b_motion_slide(const ws2812b_t *ws, const uint8_t *glyph, uint
 
     memcpy(aux_glyph, glyph, GLYPH_SIZE);
     ws2812b_draw(ws, glyph, color, intensity);
-    sleep_ms(250);
+    hal_sleep_ms(250);
     for(i = 0; i < 4; i++)
     {
         shift_function(aux_glyph, shifted_glyph); // Chama a função de deslocamento (esquerda/direita)
         ws2812b_draw(ws, shifted_glyph, color, intensity);
         memcpy(aux_glyph, shifted_glyph, GLYPH_SIZE);
-        sleep_ms(250);
+        hal_sleep_ms(250);
     }
     free(shifted_glyph);
     free(aux_glyph);
@@ -110,6 +109,6 @@ void ws2812b_motion_transition(const ws2812b_t *ws, const Command *last_cmd, con
     } else if (last_cmd->pattern > cmd->pattern) {
         ws2812b_motion_slide_left(ws, NUMERIC_GLYPHS[last_cmd->pattern], last_cmd->color, last_cmd->intensity);
     }
-    sleep_ms(50);
+    hal_sleep_ms(50);
     ws2812b_draw(ws, NUMERIC_GLYPHS[cmd->pattern], cmd->color, cmd->intensity);
 }
\ No newline at end of file
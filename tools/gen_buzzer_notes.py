@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""
+Gera lib/mlt8530_notes.h: divisor (8.4) e wrap de PWM pré-calculados para as
+128 notas MIDI em cada frequência de sistema suportada.
+
+Para cada nota é escolhido o par (divisor, wrap) com o menor erro de afinação;
+em caso de empate, o de maior período (mais resolução de volume). Assim,
+iniciar uma nota no firmware é uma consulta à tabela, sem divisões.
+
+Uso:
+    python3 tools/gen_buzzer_notes.py > lib/mlt8530_notes.h
+"""
+
+CLOCKS_KHZ = (48000, 125000, 128000, 133000)
+A4_MIDI, A4_HZ = 69, 440.0
+
+
+def midi_hz(note):
+    return A4_HZ * 2.0 ** ((note - A4_MIDI) / 12.0)
+
+
+def solve(clock_hz, freq):
+    best = None
+    for div_16 in range(16, 0x1000):
+        period = round(clock_hz * 16 / (div_16 * freq))
+        if period < 2 or period > 65536:
+            continue
+        err = abs(clock_hz * 16 / (div_16 * period) - freq) / freq
+        key = (round(err, 9), -period)
+        if best is None or key < best[0]:
+            best = (key, div_16, period)
+    return best[1], best[2] - 1, best[0][0]
+
+
+def main():
+    out = []
+    out.append("#ifndef MLT8530_NOTES_H")
+    out.append("#define MLT8530_NOTES_H")
+    out.append("")
+    out.append("/**")
+    out.append(" * @file mlt8530_notes.h")
+    out.append(" * @brief Tabelas de divisor/wrap de PWM para as notas MIDI (gerado por tools/gen_buzzer_notes.py).")
+    out.append(" *")
+    out.append(" * Não edite à mão: altere o script e gere novamente.")
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("/** @brief Quantidade de notas MIDI tabeladas. */")
+    out.append("#define BUZZER_MIDI_NOTES 128")
+    out.append("")
+    out.append("/** @brief Configuração de PWM de uma nota: divisor em 8.4 e valor de wrap. */")
+    out.append("typedef struct")
+    out.append("{")
+    out.append("    uint16_t div_16; /**< Divisor de clock em ponto fixo 8.4 */")
+    out.append("    uint16_t top;    /**< Wrap do contador (período - 1) */")
+    out.append("} buzzer_pwm_setting_t;")
+    out.append("")
+    out.append("/** @brief Frequência de cada nota MIDI em centésimos de Hz (para clocks sem tabela). */")
+    out.append("static const uint32_t BUZZER_MIDI_FREQ_CHZ[BUZZER_MIDI_NOTES] = {")
+    chz = [round(midi_hz(n) * 100) for n in range(128)]
+    for r in range(0, 128, 8):
+        out.append("    " + ", ".join("%7d" % v for v in chz[r:r + 8]) + ",")
+    out.append("};")
+    worst = {}
+    for khz in CLOCKS_KHZ:
+        out.append("")
+        out.append("/** @brief Notas MIDI com clk_sys = %d kHz. */" % khz)
+        out.append("static const buzzer_pwm_setting_t BUZZER_NOTES_%dKHZ[BUZZER_MIDI_NOTES] = {" % khz)
+        row = []
+        worst[khz] = 0.0
+        for n in range(128):
+            div_16, top, err = solve(khz * 1000, midi_hz(n))
+            worst[khz] = max(worst[khz], err)
+            row.append("{%4d, %5d}" % (div_16, top))
+            if len(row) == 6:
+                out.append("    " + ", ".join(row) + ",")
+                row = []
+        if row:
+            out.append("    " + ", ".join(row) + ",")
+        out.append("};")
+    out.append("")
+    out.append("/** @brief Associação entre clk_sys (Hz) e tabela de notas. */")
+    out.append("typedef struct")
+    out.append("{")
+    out.append("    uint32_t clock_hz;                   /**< Frequência de sistema da tabela */")
+    out.append("    const buzzer_pwm_setting_t *notes;   /**< Tabela de 128 notas */")
+    out.append("} buzzer_note_table_t;")
+    out.append("")
+    out.append("/** @brief Tabelas disponíveis (pior erro de afinação entre parênteses). */")
+    out.append("static const buzzer_note_table_t BUZZER_NOTE_TABLES[] = {")
+    for khz in CLOCKS_KHZ:
+        out.append("    {%du, BUZZER_NOTES_%dKHZ}, // (%.4f%%)" % (khz * 1000, khz, worst[khz] * 100))
+    out.append("};")
+    out.append("")
+    out.append("#endif // MLT8530_NOTES_H")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Gera lib/oled_assets.h: imagens de 1 bit para o display, comprimidas em
+PackBits, para `oledgfx_draw_asset` (lib/oledgfx.c).
+
+Uso:
+    python3 tools/gen_oled_assets.py > lib/oled_assets.h
+
+Os bytes vão página a página e, em cada página, da coluna da esquerda para
+a da direita (bit 0 = linha de cima da página). Nessa ordem as áreas lisas
+e os traços horizontais viram repetições longas; na ordem do `ram_buffer`
+(coluna a coluna, endereçamento vertical), bytes vizinhos na mesma página
+ficam a 8 posições de distância e quase nada se repete. O decodificador
+escreve cada byte direto na sua posição do `ram_buffer`, com passo de uma
+coluna.
+
+PackBits: um byte de cabeçalho `n` seguido de
+    n = 0..127    n + 1 bytes literais;
+    n = 129..255  um byte repetido 257 - n vezes (2 a 128);
+    n = 128       nada (não é gerado).
+
+As imagens são desenhadas aqui, com uma fonte 5x7 ampliada, para não
+depender de arquivos de imagem. Para usar um desenho, carregue-o em uma
+matriz de pixels (0/1) e passe-a a `emit`.
+"""
+
+# Fonte 5x7 só com as letras usadas
+FONT = {
+    "A": ["01110", "10001", "10001", "11111", "10001", "10001", "10001"],
+    "E": ["11111", "10000", "10000", "11110", "10000", "10000", "11111"],
+    "F": ["11111", "10000", "10000", "11110", "10000", "10000", "10000"],
+    "I": ["11111", "00100", "00100", "00100", "00100", "00100", "11111"],
+    "M": ["10001", "11011", "10101", "10101", "10001", "10001", "10001"],
+    "R": ["11110", "10001", "10001", "11110", "10100", "10010", "10001"],
+    "S": ["01111", "10000", "10000", "01110", "00001", "00001", "11110"],
+    "T": ["11111", "00100", "00100", "00100", "00100", "00100", "00100"],
+}
+
+
+def canvas(width, height):
+    return [[0] * width for _ in range(height)]
+
+
+def rect(img, x0, y0, x1, y1, value=1):
+    for y in range(max(0, y0), min(len(img), y1)):
+        for x in range(max(0, x0), min(len(img[0]), x1)):
+            img[y][x] = value
+
+
+def frame(img, thickness):
+    h, w = len(img), len(img[0])
+    rect(img, 0, 0, w, thickness)
+    rect(img, 0, h - thickness, w, h)
+    rect(img, 0, 0, thickness, h)
+    rect(img, w - thickness, 0, w, h)
+
+
+def text(img, string, x, y, scale):
+    """Escreve `string` com a fonte 5x7 ampliada `scale` vezes (1 coluna de espaço)."""
+    for ch in string:
+        for r, row in enumerate(FONT[ch]):
+            for c, bit in enumerate(row):
+                if bit == "1":
+                    rect(img, x + c * scale, y + r * scale, x + (c + 1) * scale, y + (r + 1) * scale)
+        x += 6 * scale
+
+
+def text_width(string, scale):
+    return 6 * scale * len(string) - scale
+
+
+def splash():
+    """Tela de abertura: moldura, título grande e uma faixa de "pixels a apagar"."""
+    img = canvas(128, 64)
+    frame(img, 2)
+    text(img, "ERASE", (128 - text_width("ERASE", 4)) // 2, 6, 4)
+    text(img, "IT", (128 - text_width("IT", 2)) // 2, 38, 2)
+    # Xadrez com colunas faltando: o que o jogador apaga
+    for y in range(54, 60):
+        for x in range(8, 120):
+            if (x // 2 + y // 2) % 2 == 0 and (x // 8) % 5 != 3:
+                img[y][x] = 1
+    return img
+
+
+def game_over():
+    """Fim da partida: "FIM" grande em uma moldura grossa."""
+    img = canvas(96, 40)
+    rect(img, 0, 0, 96, 40)
+    rect(img, 3, 3, 93, 37, 0)
+    text(img, "FIM", (96 - text_width("FIM", 4)) // 2, 6, 4)
+    return img
+
+
+def to_pages(img):
+    height, width = len(img), len(img[0])
+    assert height % 8 == 0, "a altura deve ser múltipla de 8 (páginas inteiras)"
+    out = []
+    for page in range(height // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                byte |= img[page * 8 + bit][x] << bit
+            out.append(byte)
+    return out
+
+
+def packbits(data):
+    out, i, n = [], 0, len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += [257 - run, data[i]]
+            i += run
+            continue
+        # Literais até o início de uma repetição de 2 ou mais
+        start = i
+        while i < n and i - start < 128 and not (i + 1 < n and data[i + 1] == data[i]):
+            i += 1
+        out += [i - start - 1] + data[start:i]
+    return out
+
+
+def unpackbits(packed):
+    out, i = [], 0
+    while i < len(packed):
+        n = packed[i]
+        i += 1
+        if n < 128:
+            out += packed[i:i + n + 1]
+            i += n + 1
+        elif n > 128:
+            out += [packed[i]] * (257 - n)
+            i += 1
+    return out
+
+
+def emit(name, img, out):
+    raw = to_pages(img)
+    packed = packbits(raw)
+    assert unpackbits(packed) == raw
+    width, pages = len(img[0]), len(img) // 8
+    out.append("")
+    out.append("/** @brief %s: %dx%d pixels, %d bytes (%d sem compressão). */" % (name, width, pages * 8, len(packed), len(raw)))
+    out.append("static const uint8_t OLED_ASSET_%s_DATA[%d] = {" % (name, len(packed)))
+    for r in range(0, len(packed), 16):
+        out.append("    " + ", ".join("0x%02x" % v for v in packed[r:r + 16]) + ",")
+    out.append("};")
+    out.append("static const oledgfx_asset_t OLED_ASSET_%s = { OLED_ASSET_%s_DATA, sizeof(OLED_ASSET_%s_DATA), %d, %d };"
+               % (name, name, name, width, pages))
+
+
+def main():
+    out = [
+        "#ifndef OLED_ASSETS_H",
+        "#define OLED_ASSETS_H",
+        "",
+        "/**",
+        " * @file oled_assets.h",
+        " * @brief Imagens do display (1 bit, PackBits) geradas por tools/gen_oled_assets.py.",
+        " *",
+        " * Não edite à mão: altere o script e gere novamente.",
+        " */",
+        "",
+        "#include \"oledgfx.h\"",
+    ]
+    emit("SPLASH", splash(), out)
+    emit("GAME_OVER", game_over(), out)
+    out.append("")
+    out.append("#endif // OLED_ASSETS_H")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Gera lib/pcm_sfx.h: efeitos sonoros PCM de 8 bits sem sinal (128 = silêncio)
+para lib/pcm_audio.c, sintetizados aqui para não depender de arquivos WAV.
+
+Uso:
+    python3 tools/gen_pcm_sfx.py > lib/pcm_sfx.h
+
+Para usar uma gravação, converta-a para mono, 16 kHz, 8 bits sem sinal e
+substitua a função geradora correspondente pela leitura do arquivo.
+"""
+
+import math
+import random
+
+SAMPLE_RATE = 16000
+
+
+def to_u8(samples):
+    return [max(0, min(255, int(round(128 + 127 * s)))) for s in samples]
+
+
+def erase_crunch():
+    """Ruído em amostragem-e-retenção com decaimento rápido (apagar pixels)."""
+    rng = random.Random(7)
+    n = int(0.07 * SAMPLE_RATE)
+    out, held = [], 0.0
+    for i in range(n):
+        if i % 3 == 0:
+            held = rng.uniform(-1.0, 1.0)
+        env = math.exp(-i / (0.018 * SAMPLE_RATE))
+        out.append(0.8 * held * env)
+    return out
+
+
+def countdown_tick():
+    """Clique curto: senoide de 1,8 kHz com decaimento exponencial."""
+    n = int(0.025 * SAMPLE_RATE)
+    return [0.9 * math.sin(2 * math.pi * 1800 * i / SAMPLE_RATE) * math.exp(-i / (0.005 * SAMPLE_RATE))
+            for i in range(n)]
+
+
+def game_over():
+    """Três notas descendentes (Sol4, Mi4, Dó4) em onda triangular com envelope."""
+    out = []
+    for freq, dur in ((392.0, 0.2), (329.63, 0.2), (261.63, 0.5)):
+        n = int(dur * SAMPLE_RATE)
+        attack, release = int(0.005 * SAMPLE_RATE), int(0.06 * SAMPLE_RATE)
+        for i in range(n):
+            phase = (freq * i / SAMPLE_RATE) % 1.0
+            tri = 4 * abs(phase - 0.5) - 1
+            env = min(1.0, i / attack, (n - i) / release)
+            out.append(0.85 * tri * env)
+    return out
+
+
+def emit(name, samples, out):
+    data = to_u8(samples)
+    out.append("")
+    out.append("/** @brief %s: %d amostras (%d ms). */" % (name, len(data), len(data) * 1000 // SAMPLE_RATE))
+    out.append("static const uint8_t PCM_SFX_%s_DATA[%d] = {" % (name, len(data)))
+    for r in range(0, len(data), 16):
+        out.append("    " + ", ".join("0x%02x" % v for v in data[r:r + 16]) + ",")
+    out.append("};")
+    out.append("static const pcm_sample_t PCM_SFX_%s = { PCM_SFX_%s_DATA, sizeof(PCM_SFX_%s_DATA) };" % (name, name, name))
+
+
+def main():
+    out = [
+        "#ifndef PCM_SFX_H",
+        "#define PCM_SFX_H",
+        "",
+        "/**",
+        " * @file pcm_sfx.h",
+        " * @brief Efeitos sonoros PCM (8 bits, %d Hz) gerados por tools/gen_pcm_sfx.py." % SAMPLE_RATE,
+        " *",
+        " * Não edite à mão: altere o script e gere novamente.",
+        " */",
+        "",
+        "#include \"pcm_audio.h\"",
+        "",
+        "#if PCM_SAMPLE_RATE_HZ != %d" % SAMPLE_RATE,
+        "#error \"pcm_sfx.h foi gerado para outra taxa de amostragem\"",
+        "#endif",
+    ]
+    emit("CRUNCH", erase_crunch(), out)
+    emit("TICK", countdown_tick(), out)
+    emit("GAME_OVER", game_over(), out)
+    out.append("")
+    out.append("#endif // PCM_SFX_H")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,236 @@
+/**
+ * @file joystick_filter_bench.c
+ * @brief Bancada de host para ajustar o filtro One-Euro do joystick.
+ *
+ * Reproduz traços do ADC (gravados na placa ou sintéticos) através de
+ * `one_euro_filter` e mede, para cada combinação de parâmetros:
+ *  - jitter: RMS da variação amostra a amostra da saída nos trechos parados;
+ *  - latência: atraso, em ms, que melhor alinha a saída a uma referência
+ *    sem fase (média móvel centrada da entrada) nos trechos em movimento.
+ *
+ * Formato do traço (CSV, uma amostra por linha, '#' inicia comentário):
+ *     t_us,valor
+ * onde `valor` está na escala de 14 bits de `joystick_read_raw`.
+ *
+ * Compilação e uso:
+ *     cc -O2 -Ilib -o filter_bench tools/joystick_filter_bench.c lib/joystick_filter.c -lm
+ *     ./filter_bench traco.csv            # varre uma grade de parâmetros
+ *     ./filter_bench traco.csv 1000 256   # avalia min_cutoff (mHz) e beta (Q8)
+ *     ./filter_bench --synthetic > sint.csv
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "joystick_filter.h"
+
+/** @brief Número máximo de amostras de um traço. */
+#define MAX_SAMPLES 200000
+
+/** @brief Meia-janela da média móvel de referência, em amostras. */
+#define REF_HALF_WINDOW 4
+
+/** @brief Velocidade (contagens/s) abaixo da qual a referência é considerada parada. */
+#define STILL_SPEED 2000.0
+
+/** @brief Amostras paradas exigidas antes de medir jitter (exclui a acomodação após movimentos). */
+#define SETTLE_SAMPLES 40
+
+/** @brief Maior atraso testado na estimativa de latência, em amostras. */
+#define MAX_LAG 64
+
+static uint32_t trace_t[MAX_SAMPLES];
+static uint16_t trace_v[MAX_SAMPLES];
+static uint16_t filtered[MAX_SAMPLES];
+static double reference[MAX_SAMPLES];
+static size_t trace_len;
+
+/**
+ * @brief Lê um traço CSV no formato `t_us,valor`.
+ *
+ * @param path Caminho do arquivo.
+ * @return 0 em caso de sucesso.
+ */
+static int load_trace(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) { perror(path); return -1; }
+    char line[128];
+    while (fgets(line, sizeof(line), f) && trace_len < MAX_SAMPLES)
+    {
+        unsigned long t, v;
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%lu,%lu", &t, &v) != 2) continue;
+        trace_t[trace_len] = (uint32_t) t;
+        trace_v[trace_len] = (uint16_t) v;
+        trace_len++;
+    }
+    fclose(f);
+    return trace_len ? 0 : -1;
+}
+
+/**
+ * @brief Gera um traço sintético: repouso ruidoso, degraus, rampas e uma senoide.
+ *
+ * Simula uma leitura a cada 8 ms (ritmo do laço do jogo) com ruído gaussiano
+ * de desvio 6 contagens, próximo do observado após o oversampling.
+ */
+static void synthesize_trace(void)
+{
+    double value = 8192.0;
+    uint32_t t = 0;
+    srand(1);
+    for (size_t i = 0; i < 4000; i++, t += 8000)
+    {
+        double phase = (double) (i % 1000);
+        if (phase < 200) value = 8192.0;                                // repouso
+        else if (phase < 300) value = 14000.0;                          // degrau
+        else if (phase < 500) value = 14000.0 - (phase - 300) * 50.0;   // rampa lenta
+        else if (phase < 600) value = 4000.0;                           // degrau
+        else value = 8192.0 + 6000.0 * sin((phase - 600) * 0.05);       // movimento contínuo
+        double u1 = (rand() + 1.0) / (RAND_MAX + 2.0), u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+        double noise = 6.0 * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+        double v = value + noise;
+        if (v < 0) v = 0;
+        if (v > 16380) v = 16380;
+        trace_t[trace_len] = t;
+        trace_v[trace_len] = (uint16_t) v;
+        trace_len++;
+    }
+}
+
+/**
+ * @brief Calcula a referência sem fase (média móvel centrada) da entrada.
+ */
+static void build_reference(void)
+{
+    for (size_t i = 0; i < trace_len; i++)
+    {
+        double sum = 0;
+        int n = 0;
+        for (int k = -REF_HALF_WINDOW; k <= REF_HALF_WINDOW; k++)
+        {
+            long j = (long) i + k;
+            if (j < 0 || j >= (long) trace_len) continue;
+            sum += trace_v[j];
+            n++;
+        }
+        reference[i] = sum / n;
+    }
+}
+
+/**
+ * @brief Executa o filtro sobre o traço e mede jitter e latência.
+ *
+ * @param params Parâmetros do filtro.
+ * @param jitter Saída: RMS da variação da saída nos trechos parados (contagens).
+ * @param latency_ms Saída: atraso estimado nos trechos em movimento (ms).
+ */
+static void evaluate(const one_euro_params_t *params, double *jitter, double *latency_ms)
+{
+    one_euro_state_t state;
+    one_euro_reset(&state);
+    for (size_t i = 0; i < trace_len; i++)
+    {
+        filtered[i] = one_euro_filter(&state, params, trace_v[i], trace_t[i]);
+    }
+
+    double sq = 0;
+    size_t still = 0, still_run = 0;
+    for (size_t i = 1; i < trace_len; i++)
+    {
+        double dt = (trace_t[i] - trace_t[i - 1]) * 1e-6;
+        if (dt <= 0 || fabs(reference[i] - reference[i - 1]) / dt > STILL_SPEED)
+        {
+            still_run = 0;
+            continue;
+        }
+        if (++still_run < SETTLE_SAMPLES) continue;
+        double d = (double) filtered[i] - filtered[i - 1];
+        sq += d * d;
+        still++;
+    }
+    *jitter = still ? sqrt(sq / still) : 0.0;
+
+    // Atraso: deslocamento que minimiza o erro absoluto em relação à referência nos trechos em movimento
+    double best_err = INFINITY;
+    int best_lag = 0;
+    for (int lag = 0; lag < MAX_LAG; lag++)
+    {
+        double err = 0;
+        size_t n = 0;
+        for (size_t i = (size_t) lag + 1; i < trace_len; i++)
+        {
+            double dt = (trace_t[i] - trace_t[i - 1]) * 1e-6;
+            if (dt <= 0 || fabs(reference[i] - reference[i - 1]) / dt <= STILL_SPEED) continue;
+            err += fabs((double) filtered[i] - reference[i - lag]);
+            n++;
+        }
+        if (n && err / n < best_err) { best_err = err / n; best_lag = lag; }
+    }
+    double mean_dt_ms = trace_len > 1 ? (trace_t[trace_len - 1] - trace_t[0]) * 1e-3 / (trace_len - 1) : 0.0;
+    *latency_ms = best_lag * mean_dt_ms;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "uso: %s traco.csv [min_cutoff_mhz beta_q8 [d_cutoff_mhz]] | --synthetic\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (strcmp(argv[1], "--synthetic") == 0)
+    {
+        synthesize_trace();
+        printf("# t_us,valor\n");
+        for (size_t i = 0; i < trace_len; i++) printf("%u,%u\n", trace_t[i], trace_v[i]);
+        return EXIT_SUCCESS;
+    }
+    if (load_trace(argv[1]) != 0)
+    {
+        fprintf(stderr, "traço vazio ou ilegível: %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    build_reference();
+
+    one_euro_params_t params;
+    one_euro_params_default(&params);
+    double jitter, latency;
+
+    // Linha de base: sem filtro (corte máximo)
+    one_euro_params_t bypass = { ONE_EURO_MAX_CUTOFF_MHZ, 0, params.d_cutoff_mhz };
+    evaluate(&bypass, &jitter, &latency);
+    printf("%zu amostras; sem filtro: jitter %.2f, latência %.1f ms\n\n", trace_len, jitter, latency);
+
+    if (argc >= 4)
+    {
+        params.min_cutoff_mhz = (uint32_t) strtoul(argv[2], NULL, 0);
+        params.beta = (uint32_t) strtoul(argv[3], NULL, 0);
+        if (argc >= 5) params.d_cutoff_mhz = (uint32_t) strtoul(argv[4], NULL, 0);
+        evaluate(&params, &jitter, &latency);
+        printf("min_cutoff %u mHz, beta %u, d_cutoff %u mHz: jitter %.2f, latência %.1f ms\n",
+               params.min_cutoff_mhz, params.beta, params.d_cutoff_mhz, jitter, latency);
+        return EXIT_SUCCESS;
+    }
+
+    static const uint32_t cutoffs[] = { 500, 1000, 1500, 3000, 6000 };
+    static const uint32_t betas[] = { 16, 64, 256, 1024 };
+    printf("%12s %8s %10s %14s\n", "min_cutoff", "beta", "jitter", "latência(ms)");
+    for (size_t c = 0; c < sizeof(cutoffs) / sizeof(cutoffs[0]); c++)
+    {
+        for (size_t b = 0; b < sizeof(betas) / sizeof(betas[0]); b++)
+        {
+            params.min_cutoff_mhz = cutoffs[c];
+            params.beta = betas[b];
+            evaluate(&params, &jitter, &latency);
+            printf("%12u %8u %10.2f %14.1f\n", params.min_cutoff_mhz, params.beta, jitter, latency);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file profiler_decode.c
+ * @brief Decodificador de host para o registro binário de `profiler_dump`.
+ *
+ * Lê uma captura da serial (texto comum antes do registro é ignorado), procura
+ * a marca "PRF1", valida a soma de verificação e imprime, para cada zona,
+ * execuções, mínimo/média/máximo em microssegundos, percentis estimados pelo
+ * histograma e o próprio histograma.
+ *
+ * Compilação e uso:
+ *     cc -O2 -o profiler_decode tools/profiler_decode.c
+ *     ./profiler_decode captura.bin      # ou: ./profiler_decode < captura.bin
+ *
+ * Captura: envie 'p' pela serial durante a partida e grave a saída, por
+ * exemplo com `cat /dev/ttyACM0 > captura.bin`.
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/** @brief Cópia das constantes do formato (lib/profiler.h depende do SDK). */
+#define DUMP_MAGIC "PRF1"
+#define DUMP_VERSION 1
+#define MAX_CAPTURE (1 << 20)
+
+static uint8_t capture[MAX_CAPTURE];
+
+/** @brief Leitor sequencial sobre o registro. */
+typedef struct
+{
+    const uint8_t *p;
+    const uint8_t *end;
+    int error;
+} reader_t;
+
+static uint64_t read_le(reader_t *r, int bytes)
+{
+    uint64_t v = 0;
+    if (r->p + bytes > r->end) { r->error = 1; return 0; }
+    for (int i = 0; i < bytes; i++) v |= (uint64_t) r->p[i] << (8 * i);
+    r->p += bytes;
+    return v;
+}
+
+/**
+ * @brief Estima o percentil pelo histograma (limite superior da faixa).
+ *
+ * @return Ciclos do percentil.
+ */
+static uint32_t hist_percentile(const uint16_t *hist, int bins, uint32_t total, double q)
+{
+    uint32_t target = (uint32_t) (q * total + 0.5), seen = 0;
+    for (int b = 0; b < bins; b++)
+    {
+        seen += hist[b];
+        if (seen >= target && seen) return b ? (1u << b) - 1 : 0;
+    }
+    return (1u << (bins - 1)) - 1;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *f = (argc > 1) ? fopen(argv[1], "rb") : stdin;
+    if (!f) { perror(argv[1]); return EXIT_FAILURE; }
+    size_t len = fread(capture, 1, sizeof(capture), f);
+    if (f != stdin) fclose(f);
+
+    // O registro mais recente da captura
+    const uint8_t *start = NULL;
+    for (size_t i = 0; i + 4 <= len; i++)
+    {
+        if (memcmp(capture + i, DUMP_MAGIC, 4) == 0) start = capture + i + 4;
+    }
+    if (!start) { fprintf(stderr, "registro PRF1 não encontrado\n"); return EXIT_FAILURE; }
+
+    reader_t r = { start, capture + len, 0 };
+    unsigned version = (unsigned) read_le(&r, 1);
+    unsigned zones = (unsigned) read_le(&r, 1);
+    int bins = (int) read_le(&r, 1);
+    read_le(&r, 1);
+    double clock_hz = (double) read_le(&r, 4);
+    if (r.error || version != DUMP_VERSION || bins <= 0 || bins > 32 || clock_hz <= 0)
+    {
+        fprintf(stderr, "cabeçalho inválido (versão %u)\n", version);
+        return EXIT_FAILURE;
+    }
+    double us_per_cycle = 1e6 / clock_hz;
+
+    printf("clk_sys %.1f MHz, %u zonas\n\n", clock_hz / 1e6, zones);
+    // Larguras compensam os bytes extras dos acentos em UTF-8
+    printf("%-16s %10s %11s %11s %10s %10s %10s  histograma (log2 ciclos)\n",
+           "zona", "execuções", "mín(us)", "média(us)", "máx(us)", "p50(us)", "p99(us)");
+
+    for (unsigned z = 0; z < zones && !r.error; z++)
+    {
+        char name[256];
+        uint16_t hist[32];
+        read_le(&r, 1); // id
+        unsigned name_len = (unsigned) read_le(&r, 1);
+        if (r.p + name_len > r.end) { r.error = 1; break; }
+        memcpy(name, r.p, name_len);
+        name[name_len] = '\0';
+        r.p += name_len;
+        uint32_t count = (uint32_t) read_le(&r, 4);
+        uint32_t min = (uint32_t) read_le(&r, 4);
+        uint32_t max = (uint32_t) read_le(&r, 4);
+        uint64_t sum = read_le(&r, 8);
+        for (int b = 0; b < bins; b++) hist[b] = (uint16_t) read_le(&r, 2);
+        if (r.error) break;
+
+        double mean = count ? (double) sum / count : 0.0;
+        uint32_t p50 = hist_percentile(hist, bins, count, 0.50);
+        uint32_t p99 = hist_percentile(hist, bins, count, 0.99);
+        if (p50 > max) p50 = max; // A faixa só dá o limite superior
+        if (p99 > max) p99 = max;
+        printf("%-16s %8u %10.2f %10.2f %10.2f %10.2f %10.2f  ", name, count,
+               min * us_per_cycle, mean * us_per_cycle, max * us_per_cycle,
+               p50 * us_per_cycle, p99 * us_per_cycle);
+        for (int b = 0; b < bins; b++)
+        {
+            // Uma letra por faixa: '.' vazia, '1'-'9' proporcional, '#' dominante
+            uint32_t share = count ? (uint32_t) ((uint64_t) hist[b] * 10 / count) : 0;
+            putchar(hist[b] == 0 ? '.' : share >= 10 ? '#' : (char) ('0' + (share ? share : 1)));
+        }
+        putchar('\n');
+    }
+
+    if (r.error) { fprintf(stderr, "registro truncado\n"); return EXIT_FAILURE; }
+
+    // Fletcher-16 sobre os bytes após a marca
+    uint8_t s1 = 0, s2 = 0;
+    for (const uint8_t *p = start; p < r.p; p++)
+    {
+        s1 = (uint8_t) ((s1 + *p) % 255);
+        s2 = (uint8_t) ((s2 + s1) % 255);
+    }
+    if (r.p + 2 > r.end || r.p[0] != s1 || r.p[1] != s2)
+    {
+        fprintf(stderr, "soma de verificação inválida\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file telemetry_decode.c
+ * @brief Decodificador e gráfico de host para a telemetria de `lib/telemetry`.
+ *
+ * Lê uma captura da serial (as mensagens de texto entre os registros são
+ * ignoradas), encontra os registros de 16 bytes pela marca 0xA5 0x5A e pela
+ * soma de verificação e imprime um CSV:
+ *     partida,t_ms,seq,pixels,cursor_x,cursor_y,quadro_us
+ * Uma nova partida começa quando os pixels aumentam (tela preenchida de novo)
+ * ou após mais de um segundo sem registros. Com `--plot`, em vez do CSV,
+ * desenha no terminal os pixels restantes e o tempo de quadro da última
+ * partida (ou da escolhida com `--round N`).
+ *
+ * O resumo (registros, perdidos pela sequência, descartados pela soma de
+ * verificação e tempo de quadro) vai para stderr.
+ *
+ * Compilação e uso:
+ *     cc -O2 -o telemetry_decode tools/telemetry_decode.c
+ *     cat /dev/ttyACM0 > captura.bin      # jogue e interrompa
+ *     ./telemetry_decode captura.bin > telemetria.csv
+ *     ./telemetry_decode --plot captura.bin
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/** @brief Cópia das constantes do formato (lib/telemetry.h). */
+#define SYNC0 0xA5
+#define SYNC1 0x5A
+#define VERSION 1
+#define RECORD_BYTES 16
+#define MAX_CAPTURE (1 << 22)
+#define MAX_RECORDS (MAX_CAPTURE / RECORD_BYTES)
+#define ROUND_GAP_US 1000000u
+
+#define PLOT_WIDTH 64
+#define PLOT_PIXEL_ROWS 12
+#define PLOT_FRAME_ROWS 6
+
+/** @brief Um registro decodificado. */
+typedef struct
+{
+    unsigned round;
+    uint64_t time_us; /**< Sem as voltas do contador de 32 bits */
+    uint8_t seq;
+    uint16_t pixels;
+    uint8_t x, y;
+    uint16_t frame_us;
+} record_t;
+
+static uint8_t capture[MAX_CAPTURE];
+static record_t records[MAX_RECORDS];
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < bytes; i++) v |= (uint32_t) p[i] << (8 * i);
+    return v;
+}
+
+static int record_valid(const uint8_t *p)
+{
+    uint8_t s1 = 0, s2 = 0;
+    if (p[0] != SYNC0 || p[1] != SYNC1 || p[2] != VERSION) return 0;
+    for (int i = 2; i < 14; i++)
+    {
+        s1 = (uint8_t) ((s1 + p[i]) % 255);
+        s2 = (uint8_t) ((s2 + s1) % 255);
+    }
+    return p[14] == s1 && p[15] == s2;
+}
+
+/**
+ * @brief Desenha uma série como colunas de '#', com a escala à esquerda.
+ *
+ * Cada coluna do gráfico resume um intervalo de tempo igual; vale o máximo
+ * dos registros nele (colunas sem registro repetem a anterior).
+ */
+static void plot(const char *title, const record_t *r, size_t n, int rows, int pixels)
+{
+    uint32_t column[PLOT_WIDTH];
+    uint32_t top = 1;
+    uint64_t t0 = r[0].time_us, span = r[n - 1].time_us - t0 + 1;
+
+    memset(column, 0, sizeof column);
+    int filled[PLOT_WIDTH] = { 0 };
+    for (size_t i = 0; i < n; i++)
+    {
+        int c = (int) ((r[i].time_us - t0) * PLOT_WIDTH / span);
+        uint32_t v = pixels ? r[i].pixels : r[i].frame_us;
+        if (!filled[c] || v > column[c]) column[c] = v;
+        filled[c] = 1;
+    }
+    for (int c = 0; c < PLOT_WIDTH; c++)
+    {
+        if (!filled[c] && c) column[c] = column[c - 1];
+        if (column[c] > top) top = column[c];
+    }
+
+    printf("%s\n", title);
+    for (int row = rows; row >= 1; row--)
+    {
+        uint32_t level = (uint32_t) ((uint64_t) top * (2 * row - 1) / (2 * rows)); // Centro da faixa da linha
+        printf("%7u |", (unsigned) ((uint64_t) top * row / rows));
+        for (int c = 0; c < PLOT_WIDTH; c++) putchar(column[c] >= level && column[c] ? '#' : ' ');
+        putchar('\n');
+    }
+    printf("%7s +", "");
+    for (int c = 0; c < PLOT_WIDTH; c++) putchar('-');
+    printf("\n%7s  0 s%*s%.1f s\n\n", "", PLOT_WIDTH - 6, "", (double) span / 1e6);
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "uso: %s [--plot] [--round N] [captura.bin]\n", name);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    int want_plot = 0;
+    long want_round = -1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--plot") == 0) want_plot = 1;
+        else if (strcmp(argv[i], "--round") == 0 && i + 1 < argc) want_round = strtol(argv[++i], NULL, 0);
+        else if (argv[i][0] == '-' || path) usage(argv[0]);
+        else path = argv[i];
+    }
+
+    FILE *f = path ? fopen(path, "rb") : stdin;
+    if (!f) { perror(path); return EXIT_FAILURE; }
+    size_t len = fread(capture, 1, sizeof(capture), f);
+    if (f != stdin) fclose(f);
+
+    size_t n = 0, rejected = 0, lost = 0;
+    uint64_t wrap = 0;
+    uint32_t last_time = 0;
+    unsigned round = 0;
+
+    for (size_t i = 0; i + RECORD_BYTES <= len && n < MAX_RECORDS;)
+    {
+        const uint8_t *p = capture + i;
+        if (p[0] != SYNC0 || p[1] != SYNC1) { i++; continue; }
+        if (!record_valid(p))
+        {
+            rejected++; // Cortado por texto ou corrompido: procura a próxima marca
+            i++;
+            continue;
+        }
+
+        record_t *r = &records[n];
+        uint32_t t = get_le(p + 4, 4);
+        if (n && t < last_time) wrap += 1ull << 32;
+        last_time = t;
+        r->time_us = wrap + t;
+        r->seq = p[3];
+        r->pixels = (uint16_t) get_le(p + 8, 2);
+        r->x = p[10];
+        r->y = p[11];
+        r->frame_us = (uint16_t) get_le(p + 12, 2);
+        if (n)
+        {
+            const record_t *prev = &records[n - 1];
+            lost += (uint8_t) (r->seq - prev->seq - 1);
+            if (r->pixels > prev->pixels || r->time_us - prev->time_us > ROUND_GAP_US) round++;
+        }
+        r->round = round;
+        n++;
+        i += RECORD_BYTES;
+    }
+    if (!n) { fprintf(stderr, "nenhum registro de telemetria encontrado\n"); return EXIT_FAILURE; }
+
+    uint32_t frame_min = UINT32_MAX, frame_max = 0;
+    uint64_t frame_sum = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (records[i].frame_us < frame_min) frame_min = records[i].frame_us;
+        if (records[i].frame_us > frame_max) frame_max = records[i].frame_us;
+        frame_sum += records[i].frame_us;
+    }
+    fprintf(stderr, "%zu registros em %u partidas, %zu perdidos, %zu descartados\n", n, round + 1, lost, rejected);
+    fprintf(stderr, "quadro: mín %u us, média %.1f us, máx %u us\n",
+            (unsigned) frame_min, (double) frame_sum / n, (unsigned) frame_max);
+
+    if (!want_plot)
+    {
+        printf("partida,t_ms,seq,pixels,cursor_x,cursor_y,quadro_us\n");
+        for (size_t i = 0; i < n; i++)
+        {
+            const record_t *r = &records[i];
+            printf("%u,%.1f,%u,%u,%u,%u,%u\n", r->round, (double) (r->time_us - records[0].time_us) / 1e3,
+                   r->seq, r->pixels, r->x, r->y, r->frame_us);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    unsigned chosen = want_round < 0 ? round : (unsigned) want_round;
+    size_t first = 0, count = 0;
+    while (first < n && records[first].round != chosen) first++;
+    while (first + count < n && records[first + count].round == chosen) count++;
+    if (!count) { fprintf(stderr, "partida %ld não encontrada\n", want_round); return EXIT_FAILURE; }
+
+    printf("partida %u: %zu registros, %u -> %u pixels\n\n", chosen, count,
+           records[first].pixels, records[first + count - 1].pixels);
+    plot("pixels restantes", records + first, count, PLOT_PIXEL_ROWS, 1);
+    plot("tempo de quadro (us)", records + first, count, PLOT_FRAME_ROWS, 0);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file tlog_decode.c
+ * @brief Decodificador de host para as mensagens tokenizadas de `lib/tlog`.
+ *
+ * Lê uma captura da serial, encontra os quadros pela marca 0xA5 0xC3 e pela
+ * soma de verificação e refaz cada mensagem com o dicionário
+ * `lib/tlog_messages.h`, o mesmo do firmware, incluído na compilação:
+ *     [   12.345678] Game started
+ * Os registros de telemetria e o texto comum que dividem a serial são
+ * ignorados. Lacunas na sequência são mostradas como mensagens perdidas, e
+ * o hash enviado no boot é conferido com o do dicionário compilado.
+ *
+ * Compilação e uso:
+ *     cc -O2 -o tlog_decode tools/tlog_decode.c lib/fmt.c
+ *     cat /dev/ttyACM0 | ./tlog_decode          # ao vivo
+ *     ./tlog_decode captura.bin
+ *     ./tlog_decode --dict                      # lista o dicionário
+ *
+ * @author Carlos Valadão
+ * @date 2025-02-16
+ * @copyright
+ * Copyright (C) 2025 Carlos Valadão
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "../lib/fmt.h"
+#include "../lib/tlog.h"
+
+/** @brief Dicionário compilado a partir de lib/tlog_messages.h. */
+static const struct
+{
+    const char *name;
+    uint8_t argc;
+    const char *format;
+} dictionary[TLOG_COUNT] = {
+#define DICT_ENTRY(name, argc, format) { #name, argc, format },
+    TLOG_MESSAGES(DICT_ENTRY)
+#undef DICT_ENTRY
+};
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < bytes; i++) v |= (uint32_t) p[i] << (8 * i);
+    return v;
+}
+
+static uint32_t dictionary_hash(void)
+{
+    uint8_t argcs[TLOG_COUNT];
+    for (int m = 0; m < TLOG_COUNT; m++) argcs[m] = dictionary[m].argc;
+    return tlog_dictionary_hash(argcs, TLOG_COUNT);
+}
+
+/** @brief Estado da decodificação de um fluxo. */
+typedef struct
+{
+    uint8_t buf[TLOG_FRAME_MAX_BYTES];
+    size_t len;
+    int have_seq;
+    uint8_t next_seq;
+    uint64_t time_base;  /**< Voltas do contador de 32 bits */
+    uint32_t last_time;
+    unsigned long messages, lost, rejected;
+} decoder_t;
+
+/**
+ * @brief Tenta decodificar o quadro no início do buffer.
+ *
+ * @return Bytes consumidos (0 se o quadro ainda não chegou inteiro).
+ */
+static size_t decode_frame(decoder_t *d)
+{
+    const uint8_t *p = d->buf;
+    if (d->len < 2) return 0;
+    if (p[0] != TLOG_SYNC0 || p[1] != TLOG_SYNC1) return 1;
+    if (d->len < 6) return 0;
+
+    uint8_t argc = p[4];
+    size_t frame_len = 10 + 4u * argc + 2;
+    if (argc > TLOG_MAX_ARGS) { d->rejected++; return 1; }
+    if (d->len < frame_len) return 0;
+
+    uint8_t s1 = 0, s2 = 0;
+    for (size_t i = 2; i < frame_len - 2; i++)
+    {
+        s1 = (uint8_t) ((s1 + p[i]) % 255);
+        s2 = (uint8_t) ((s2 + s1) % 255);
+    }
+    if (p[frame_len - 2] != s1 || p[frame_len - 1] != s2) { d->rejected++; return 1; }
+
+    uint16_t id = (uint16_t) get_le(p + 2, 2);
+    uint8_t seq = p[5];
+    uint32_t time_us = get_le(p + 6, 4);
+    uint32_t args[TLOG_MAX_ARGS];
+    for (uint8_t i = 0; i < argc; i++) args[i] = get_le(p + 10 + 4 * i, 4);
+
+    if (id == TLOG_BOOT)
+    {
+        d->have_seq = 0; // Reinício: nova sequência e novo relógio
+        d->time_base = 0;
+        d->last_time = 0;
+    }
+    if (d->have_seq && seq != d->next_seq)
+    {
+        uint8_t gap = (uint8_t) (seq - d->next_seq);
+        d->lost += gap;
+        printf("[%12s] ... %u mensagens perdidas\n", "", gap);
+    }
+    d->have_seq = 1;
+    d->next_seq = (uint8_t) (seq + 1);
+    if (time_us < d->last_time) d->time_base += 1ull << 32;
+    d->last_time = time_us;
+    d->messages++;
+
+    double t = (double) (d->time_base + time_us) / 1e6;
+    char line[256];
+    if (id >= TLOG_COUNT || dictionary[id].argc != argc)
+    {
+        printf("[%12.6f] mensagem %u desconhecida (%u argumentos); dicionário desatualizado?\n", t, id, argc);
+    }
+    else
+    {
+        fmt_render(line, sizeof line, dictionary[id].format, args, argc);
+        printf("[%12.6f] %s\n", t, line);
+        if (id == TLOG_BOOT && args[0] != dictionary_hash())
+        {
+            fprintf(stderr, "aviso: o firmware usa outro dicionário (%08x, este é %08x)\n",
+                    (unsigned) args[0], (unsigned) dictionary_hash());
+        }
+    }
+    return frame_len;
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--dict") == 0)
+        {
+            printf("# dicionário %08x\n", (unsigned) dictionary_hash());
+            for (int m = 0; m < TLOG_COUNT; m++) printf("%d\t%s\t%u\t%s\n", m, dictionary[m].name, dictionary[m].argc, dictionary[m].format);
+            return EXIT_SUCCESS;
+        }
+        if (argv[i][0] == '-' || path)
+        {
+            fprintf(stderr, "uso: %s [--dict] [captura.bin]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+        path = argv[i];
+    }
+
+    FILE *f = path ? fopen(path, "rb") : stdin;
+    if (!f) { perror(path); return EXIT_FAILURE; }
+
+    setvbuf(stdout, NULL, _IOLBF, 0); // Ao vivo, cada mensagem aparece assim que chega
+
+    // Janela deslizante do tamanho do maior quadro: funciona também ao vivo, sem ler tudo antes
+    decoder_t d = { 0 };
+    int c;
+    while ((c = fgetc(f)) != EOF)
+    {
+        d.buf[d.len++] = (uint8_t) c;
+        size_t used;
+        while ((used = decode_frame(&d)) > 0)
+        {
+            memmove(d.buf, d.buf + used, d.len - used);
+            d.len -= used;
+        }
+    }
+    if (f != stdin) fclose(f);
+
+    fprintf(stderr, "%lu mensagens, %lu perdidas, %lu quadros inválidos\n", d.messages, d.lost, d.rejected);
+    return d.messages ? EXIT_SUCCESS : EXIT_FAILURE;
+}